@@ -49,6 +49,7 @@ add_executable(ftxui-tests
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/pixel_test.cpp
   src/ftxui/screen/string_test.cpp
   src/ftxui/util/ref_test.cpp
 )
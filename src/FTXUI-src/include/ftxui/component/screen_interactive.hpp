@@ -61,6 +61,11 @@ class ScreenInteractive : public Screen {
   void PostEvent(Event event);
   void RequestAnimationFrame();
 
+  // Forget what the terminal displays, so that the next frame is drawn
+  // entirely instead of only the changed cells. Call it from the loop (e.g. in
+  // a posted task) after something else may have written to the terminal.
+  void InvalidateFrame();
+
   CapturedMouse CaptureMouse();
 
   // Decorate a function. The outputted one will execute similarly to the
@@ -136,6 +141,15 @@ class ScreenInteractive : public Screen {
   bool mouse_captured = false;
   bool previous_frame_resized_ = false;
 
+  // The frame currently displayed by the terminal. Only the cells differing
+  // from it are written. Empty when the terminal content is unknown.
+  std::vector<Pixel> previous_pixels_;
+  std::vector<std::string> previous_hyperlinks_;
+
+  // The bytes of the frame being drawn. Its capacity is reused by the next
+  // frames.
+  std::string output_buffer_;
+
   bool frame_valid_ = false;
 
   bool force_handle_ctrl_c_ = true;
@@ -24,8 +24,8 @@ class Image {
   virtual ~Image() = default;
 
   // Access a character in the grid at a given position.
-  std::string& at(int x, int y);
-  const std::string& at(int x, int y) const;
+  Glyph& at(int x, int y);
+  const Glyph& at(int x, int y) const;
 
   // Access a cell (Pixel) in the grid at a given position.
   Pixel& PixelAt(int x, int y);
@@ -43,7 +43,8 @@ class Image {
  protected:
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  // The pixels, line after line, in a single allocation.
+  std::vector<Pixel> pixels_;
 };
 
 }  // namespace ftxui
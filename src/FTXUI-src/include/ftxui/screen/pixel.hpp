@@ -4,12 +4,67 @@
 #ifndef FTXUI_SCREEN_PIXEL_HPP
 #define FTXUI_SCREEN_PIXEL_HPP
 
+#include <cstddef>                 // for size_t
 #include <cstdint>                 // for uint8_t
+#include <iosfwd>                  // for ostream
 #include <string>                  // for string, basic_string, allocator
+#include <string_view>             // for string_view
 #include "ftxui/screen/color.hpp"  // for Color, Color::Default
 
 namespace ftxui {
 
+/// @brief The UTF-8 grapheme drawn into a Pixel, with its width.
+///
+/// Up to kInlineSize bytes are stored inline, which covers almost every
+/// glyph. Longer grapheme clusters are interned into a shared pool, and the
+/// Glyph refers to them.
+/// @ingroup screen
+class Glyph {
+ public:
+  static constexpr size_t kInlineSize = 14;
+
+  Glyph() = default;
+  Glyph(const char* str);         // NOLINT
+  Glyph(const std::string& str);  // NOLINT
+  explicit Glyph(std::string_view str);
+
+  std::string_view view() const;
+  std::string str() const { return std::string(view()); }
+  operator std::string_view() const { return view(); }  // NOLINT
+
+  const char* data() const;
+  size_t size() const;
+  bool empty() const { return size_ == 0; }
+
+  // The number of cells covered by the glyph, as given by string_width.
+  int width() const { return width_; }
+
+  bool operator==(const Glyph& other) const;
+  bool operator!=(const Glyph& other) const { return !(*this == other); }
+
+ private:
+  void Assign(std::string_view str);
+  bool IsPooled() const { return size_ == kPooled; }
+  const std::string* Pooled() const;
+
+  static constexpr uint8_t kPooled = 0xFF;
+
+  // The bytes of the glyph, or the address of the pooled string.
+  char bytes_[kInlineSize] = {};
+  uint8_t size_ = 0;
+  uint8_t width_ = 0;
+};
+
+bool operator==(const Glyph& glyph, const std::string& str);
+bool operator==(const Glyph& glyph, const char* str);
+bool operator!=(const Glyph& glyph, const std::string& str);
+bool operator!=(const Glyph& glyph, const char* str);
+bool operator==(const std::string& str, const Glyph& glyph);
+bool operator==(const char* str, const Glyph& glyph);
+bool operator!=(const std::string& str, const Glyph& glyph);
+bool operator!=(const char* str, const Glyph& glyph);
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph);
+
 /// @brief A Unicode character and its associated style.
 /// @ingroup screen
 struct Pixel {
@@ -42,7 +97,7 @@ struct Pixel {
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a?, this can potentially contain multiple codepoints.
-  std::string character = "";
+  Glyph character;
 
   // Colors:
   Color background_color = Color::Default;
@@ -34,6 +34,7 @@ class Screen : public Image {
   ~Screen() override = default;
 
   std::string ToString() const;
+  void AppendToString(std::string& output) const;
 
   // Print the Screen on to the terminal.
   void Print() const;
@@ -76,6 +77,10 @@ class Screen : public Image {
   void SetSelectionStyle(SelectionStyle decorator);
 
  protected:
+  void AppendDiffString(std::string& output,
+                        const std::vector<Pixel>& previous,
+                        int end_x) const;
+
   Cursor cursor_;
   std::vector<std::string> hyperlinks_ = {""};
 
@@ -91,6 +91,32 @@ void Flush() {
   std::cout << '\0' << std::flush;
 }
 
+// Write a whole frame to stdout. On POSIX, it bypasses the iostream buffering
+// and is handed to the terminal in a single write(2) call.
+void WriteFrame(const std::string& output) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  std::cout << output;
+#else
+  // Whatever was written through std::cout must be printed first.
+  std::cout << std::flush;
+  std::fflush(stdout);
+
+  const char* data = output.data();
+  size_t size = output.size();
+  while (size != 0) {
+    const ssize_t written = write(STDOUT_FILENO, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    data += written;
+    size -= size_t(written);
+  }
+#endif
+}
+
 constexpr int timeout_milliseconds = 20;
 [[maybe_unused]] constexpr int timeout_microseconds =
     timeout_milliseconds * 1000;
@@ -400,6 +426,15 @@ void ScreenInteractive::RequestAnimationFrame() {
   }
 }
 
+/// @brief Forget the frame displayed by the terminal. The next frame is drawn
+/// entirely.
+/// Text written to the terminal outside of FTXUI stays on screen when only the
+/// changed cells are drawn. Must be called from the thread running the loop.
+void ScreenInteractive::InvalidateFrame() {
+  previous_pixels_.clear();
+  frame_valid_ = false;
+}
+
 /// @brief Try to get the unique lock about behing able to capture the mouse.
 /// @return A unique lock if the mouse is not already captured, otherwise a
 /// null.
@@ -521,6 +556,9 @@ ScreenInteractive* ScreenInteractive::Active() {
 void ScreenInteractive::Install() {
   frame_valid_ = false;
 
+  // The terminal content is unknown, the next frame is drawn entirely.
+  previous_pixels_.clear();
+
   // Flush the buffer for stdout to ensure whatever the user has printed before
   // is fully applied before we start modifying the terminal configuration. This
   // is important, because we are using two different channels (stdout vs
@@ -879,21 +917,31 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   const bool resized = frame_count_ == 0 || (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+  // Hyperlinks are identified by their index, which is only meaningful within
+  // a frame.
+  const bool full_redraw = resized || previous_pixels_.empty() ||
+                           hyperlinks_ != previous_hyperlinks_;
+  // The frame is assembled in a buffer kept in between frames, and written at
+  // once.
+  output_buffer_.clear();
+  output_buffer_ += reset_cursor_position;
+  reset_cursor_position.clear();
+  if (full_redraw) {
+    output_buffer_ += ResetPosition(/*clear=*/resized);
+  }
 
   // If the terminal width decrease, the terminal emulator will start wrapping
   // lines and make the display dirty. We should clear it completely.
   if ((dimx < dimx_) && !use_alternative_screen_) {
-    std::cout << "\033[J";  // clear terminal output
-    std::cout << "\033[H";  // move cursor to home position
+    output_buffer_ += "\033[J";  // clear terminal output
+    output_buffer_ += "\033[H";  // move cursor to home position
   }
 
   // Resize the screen if needed.
   if (resized) {
     dimx_ = dimx;
     dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
+    pixels_ = std::vector<Pixel>(size_t(dimx) * size_t(dimy));
     cursor_.x = dimx_ - 1;
     cursor_.y = dimy_ - 1;
   }
@@ -911,14 +959,14 @@ void ScreenInteractive::Draw(Component component) {
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #else
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ &&
       (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #endif
   previous_frame_resized_ = resized;
@@ -957,8 +1005,25 @@ void ScreenInteractive::Draw(Component component) {
     }
   }
 
-  std::cout << ToString() << set_cursor_position;
+  // Only the cells that changed since the previous frame are written. The
+  // cursor ends where ToString() would have left it.
+  if (full_redraw) {
+    AppendToString(output_buffer_);
+  } else {
+    AppendDiffString(output_buffer_, previous_pixels_,
+                     dimx_ - 1 + int(dimx_ != terminal.dimx));
+  }
+  output_buffer_ += set_cursor_position;
+  WriteFrame(output_buffer_);
   Flush();
+
+  // Keep this frame to compare the next one with. The buffers are swapped to
+  // avoid reallocating the pixels.
+  previous_pixels_.swap(pixels_);
+  previous_hyperlinks_ = hyperlinks_;
+  if (resized || pixels_.empty()) {
+    pixels_ = std::vector<Pixel>(size_t(dimx_) * size_t(dimy_));
+  }
   Clear();
   frame_valid_ = true;
   frame_count_++;
@@ -242,4 +242,94 @@ TEST(ScreenInteractive, FixedSizeInitialFrame) {
 #endif
 }
 
+// Only the cells that changed since the previous frame are written.
+TEST(ScreenInteractive, FixedSizeDiffFrame) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+
+    auto screen = ScreenInteractive::FixedSize(2, 2);
+    std::string content = "AB";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "AC";
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+  }
+  using namespace std::string_view_literals;
+
+  auto expected =
+      // Reset cursor position.
+      "\x1B[1C"
+
+      // Request the cursor position, after the first frame.
+      "\x1B[6n"
+
+      // Move to the changed cell, from the beginning of the last line.
+      "\r"
+      "\x1B[A"  // Move cursor up one line.
+      "\x1B[C"  // Move cursor right one character.
+      "C"        // Print the changed cell.
+      "\r"      // Leave the last column.
+
+      // Move back to where the full frame would have left the cursor.
+      "\x1B[B"   // Move cursor down one line.
+      "\x1B[2C"  // Move cursor right two characters.
+
+      // Set cursor position.
+      "\x1B[1D"    // Move cursor left one character.
+      "\x1B[?25l"  // Hide cursor.
+
+      // Flush
+      "\0"sv;
+  EXPECT_NE(output.find(expected), std::string::npos) << output;
+  // The unchanged cells are not written again.
+  EXPECT_EQ(output.find("AC"), std::string::npos);
+#endif
+}
+
+// After InvalidateFrame(), the next frame is written entirely.
+TEST(ScreenInteractive, FixedSizeInvalidateFrame) {
+#if defined(__unix__)
+  std::string output;
+  {
+    auto capture = StdCapture(&output);
+
+    auto screen = ScreenInteractive::FixedSize(2, 2);
+    std::string content = "AB";
+    auto component = Renderer([&] { return text(content); });
+
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    content = "AC";
+    screen.Post([&] { screen.InvalidateFrame(); });
+    loop.RunOnce();
+  }
+  using namespace std::string_view_literals;
+
+  auto expected =
+      // Move back to the beginning of the frame.
+      "\r"
+      "\x1B[1A"  // Move cursor up one line.
+
+      // Request the cursor position, after the first frame.
+      "\x1B[6n"
+
+      // Print the whole document.
+      "AC\r\n"
+      "  "
+
+      // Set cursor position.
+      "\x1B[1D"    // Move cursor left one character.
+      "\x1B[?25l"  // Hide cursor.
+
+      // Flush
+      "\0"sv;
+  EXPECT_NE(output.find(expected), std::string::npos) << output;
+#endif
+}
+
 }  // namespace ftxui
@@ -6,6 +6,8 @@
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
 #include "ftxui/dom/node.hpp"      // for Render
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, CellToGlyphIndex
+#include "ftxui/screen/string_internal.hpp"  // for GlyphCount
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -82,5 +84,107 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+// A screen made of borders, styled text and fullwidth characters, printed once
+// per iteration.
+static Screen StyledScreen(int dimx, int dimy) {
+  Elements lines;
+  for (int i = 0; i < dimy; ++i) {
+    lines.push_back(hbox({
+        text("Test") | bold,
+        separator(),
+        text("ＨＥＬＬＯ world") | color(Color::Red),
+        separator(),
+        text("Test") | inverted,
+        filler(),
+    }));
+  }
+  auto document = vbox(std::move(lines)) | border;
+  Screen screen(dimx, dimy);
+  Render(screen, document);
+  return screen;
+}
+
+static void BenchmarkToString(benchmark::State& state) {
+  Screen screen = StyledScreen(state.range(0), state.range(0) / 2);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(screen.ToString());
+  }
+}
+BENCHMARK(BenchmarkToString)->RangeMultiplier(2)->Range(16, 256);
+
+static void BenchmarkAppendToString(benchmark::State& state) {
+  Screen screen = StyledScreen(state.range(0), state.range(0) / 2);
+  std::string output;
+  while (state.KeepRunning()) {
+    output.clear();
+    screen.AppendToString(output);
+    benchmark::DoNotOptimize(output.data());
+  }
+}
+BENCHMARK(BenchmarkAppendToString)->RangeMultiplier(2)->Range(16, 256);
+
+// Text made of ASCII borders, CJK text, or both, repeated |state.range(1)|
+// times.
+static std::string BenchmarkString(benchmark::State& state) {
+  static const char* const kinds[] = {
+      "+----------------------------------------------+ ",
+      "背包里有三把钥匙和一张地图。",
+      "| 背包: 钥匙 x3, 地图 x1 |----------------| ",
+  };
+  std::string content;
+  for (int i = 0; i < state.range(1); ++i) {
+    content += kinds[state.range(0)];
+  }
+  return content;
+}
+
+static void BenchmarkStringWidth(benchmark::State& state) {
+  const std::string content = BenchmarkString(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(string_width(content));
+  }
+}
+BENCHMARK(BenchmarkStringWidth)
+    ->ArgsProduct({
+        {0, 1, 2},     // ASCII, CJK, mixed.
+        {1, 16, 256},  // Repetitions.
+    });
+
+static void BenchmarkUtf8ToGlyphs(benchmark::State& state) {
+  const std::string content = BenchmarkString(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(Utf8ToGlyphs(content));
+  }
+}
+BENCHMARK(BenchmarkUtf8ToGlyphs)
+    ->ArgsProduct({
+        {0, 1, 2},     // ASCII, CJK, mixed.
+        {1, 16, 256},  // Repetitions.
+    });
+
+static void BenchmarkGlyphCount(benchmark::State& state) {
+  const std::string content = BenchmarkString(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(GlyphCount(content));
+  }
+}
+BENCHMARK(BenchmarkGlyphCount)
+    ->ArgsProduct({
+        {0, 1, 2},     // ASCII, CJK, mixed.
+        {1, 16, 256},  // Repetitions.
+    });
+
+static void BenchmarkCellToGlyphIndex(benchmark::State& state) {
+  const std::string content = BenchmarkString(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(CellToGlyphIndex(content));
+  }
+}
+BENCHMARK(BenchmarkCellToGlyphIndex)
+    ->ArgsProduct({
+        {0, 1, 2},     // ASCII, CJK, mixed.
+        {1, 16, 256},  // Repetitions.
+    });
+
 }  // namespace ftxui
 // NOLINTEND
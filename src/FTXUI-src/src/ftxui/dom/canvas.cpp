@@ -11,6 +11,7 @@
 #include <functional>              // for function
 #include <map>                     // for map
 #include <memory>                  // for make_shared
+#include <string>                  // for string
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
@@ -144,8 +145,10 @@ void Canvas::DrawPointOn(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character.str();
+  character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Erase a braille dot.
@@ -161,8 +164,10 @@ void Canvas::DrawPointOff(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  std::string character = cell.content.character.str();
+  character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
+  character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -179,8 +184,10 @@ void Canvas::DrawPointToggle(int x, int y) {
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  std::string character = cell.content.character.str();
+  character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
+  character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  cell.content.character = character;
 }
 
 /// @brief Draw a line made of braille dots.
@@ -477,7 +484,7 @@ void Canvas::DrawBlockOn(int x, int y) {
   }
 
   const uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = g_map_block_inversed.at(cell.content.character.str());
   value |= 1U << bit;
   cell.content.character = g_map_block[value];
 }
@@ -497,7 +504,7 @@ void Canvas::DrawBlockOff(int x, int y) {
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = g_map_block_inversed.at(cell.content.character.str());
   value &= ~(1U << bit);
   cell.content.character = g_map_block[value];
 }
@@ -518,7 +525,7 @@ void Canvas::DrawBlockToggle(int x, int y) {
   y /= 2;
 
   const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
+  uint8_t value = g_map_block_inversed.at(cell.content.character.str());
   value ^= 1U << bit;
   cell.content.character = g_map_block[value];
 }
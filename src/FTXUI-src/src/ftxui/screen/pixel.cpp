@@ -0,0 +1,154 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include <cstring>        // for memcpy, memcmp
+#include <deque>          // for deque
+#include <mutex>          // for mutex, lock_guard
+#include <ostream>        // for ostream
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+
+#include "ftxui/screen/pixel.hpp"
+#include "ftxui/screen/string.hpp"  // for string_width
+
+namespace ftxui {
+
+namespace {
+
+// The grapheme clusters too long to be stored inline. They are never released,
+// so that the Glyph referring to them can be copied freely. Identical clusters
+// are stored once, which bounds the pool to the distinct clusters displayed.
+class GlyphPool {
+ public:
+  const std::string* Intern(std::string_view str) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(str);
+    if (it != index_.end()) {
+      return it->second;
+    }
+    const std::string* interned = &strings_.emplace_back(str);
+    index_.emplace(*interned, interned);
+    return interned;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<std::string> strings_;  // Stable addresses.
+  std::unordered_map<std::string_view, const std::string*> index_;
+};
+
+GlyphPool& Pool() {
+  static GlyphPool pool;  // NOLINT
+  return pool;
+}
+
+int GlyphWidth(std::string_view str) {
+  // Printable ASCII.
+  if (str.size() == 1 && str[0] >= 0x20 && str[0] < 0x7F) {
+    return 1;
+  }
+  return string_width(std::string(str));
+}
+
+}  // namespace
+
+/// @brief Build a Glyph from UTF-8 bytes.
+Glyph::Glyph(const char* str) {
+  Assign(str);
+}
+
+/// @brief Build a Glyph from UTF-8 bytes.
+Glyph::Glyph(const std::string& str) {
+  Assign(str);
+}
+
+/// @brief Build a Glyph from UTF-8 bytes.
+Glyph::Glyph(std::string_view str) {
+  Assign(str);
+}
+
+void Glyph::Assign(std::string_view str) {
+  width_ = uint8_t(GlyphWidth(str));
+  if (str.size() <= kInlineSize) {
+    std::memcpy(bytes_, str.data(), str.size());
+    size_ = uint8_t(str.size());
+    return;
+  }
+  const std::string* pooled = Pool().Intern(str);
+  std::memcpy(bytes_, &pooled, sizeof(pooled));
+  size_ = kPooled;
+}
+
+const std::string* Glyph::Pooled() const {
+  const std::string* pooled = nullptr;
+  std::memcpy(&pooled, bytes_, sizeof(pooled));
+  return pooled;
+}
+
+/// @brief The UTF-8 bytes of the glyph.
+std::string_view Glyph::view() const {
+  if (IsPooled()) {
+    return *Pooled();
+  }
+  return {bytes_, size_};
+}
+
+/// @brief The UTF-8 bytes of the glyph. They are not null terminated.
+const char* Glyph::data() const {
+  return IsPooled() ? Pooled()->data() : bytes_;
+}
+
+/// @brief The number of UTF-8 bytes of the glyph.
+size_t Glyph::size() const {
+  return IsPooled() ? Pooled()->size() : size_;
+}
+
+bool Glyph::operator==(const Glyph& other) const {
+  if (size_ != other.size_) {
+    return false;
+  }
+  // Pooled strings are interned: equal content means equal address.
+  if (IsPooled()) {
+    return Pooled() == other.Pooled();
+  }
+  return std::memcmp(bytes_, other.bytes_, size_) == 0;
+}
+
+bool operator==(const Glyph& glyph, const std::string& str) {
+  return glyph.view() == std::string_view(str);
+}
+
+bool operator==(const Glyph& glyph, const char* str) {
+  return glyph.view() == std::string_view(str);
+}
+
+bool operator!=(const Glyph& glyph, const std::string& str) {
+  return !(glyph == str);
+}
+
+bool operator!=(const Glyph& glyph, const char* str) {
+  return !(glyph == str);
+}
+
+bool operator==(const std::string& str, const Glyph& glyph) {
+  return glyph == str;
+}
+
+bool operator==(const char* str, const Glyph& glyph) {
+  return glyph == str;
+}
+
+bool operator!=(const std::string& str, const Glyph& glyph) {
+  return glyph != str;
+}
+
+bool operator!=(const char* str, const Glyph& glyph) {
+  return glyph != str;
+}
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph) {
+  return out << glyph.view();
+}
+
+}  // namespace ftxui
@@ -1,5 +1,5 @@
 /// @module ftxui.screen.pixel
-/// @brief Module file for the Pixel struct of the Screen module
+/// @brief Module file for the Pixel struct and Glyph class of the Screen module
 
 module;
 
@@ -12,5 +12,6 @@ export module ftxui.screen.pixel;
  * @brief The FTXUI ftxui:: namespace
  */
 export namespace ftxui {
+    using ftxui::Glyph;
     using ftxui::Pixel;
 }
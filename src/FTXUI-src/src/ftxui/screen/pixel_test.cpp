@@ -0,0 +1,71 @@
+// Copyright 2024 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
+#include "ftxui/screen/pixel.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace ftxui {
+
+TEST(GlyphTest, Empty) {
+  const Glyph glyph;
+  EXPECT_TRUE(glyph.empty());
+  EXPECT_EQ(glyph.size(), 0u);
+  EXPECT_EQ(glyph.width(), 0);
+  EXPECT_EQ(glyph, "");
+}
+
+TEST(GlyphTest, Inline) {
+  const Glyph ascii = "a";
+  EXPECT_EQ(ascii, "a");
+  EXPECT_EQ(ascii.size(), 1u);
+  EXPECT_EQ(ascii.width(), 1);
+
+  const Glyph box = "│";
+  EXPECT_EQ(box, std::string("│"));
+  EXPECT_EQ(box.size(), 3u);
+  EXPECT_EQ(box.width(), 1);
+
+  const Glyph fullwidth = "测";
+  EXPECT_EQ(fullwidth, "测");
+  EXPECT_EQ(fullwidth.width(), 2);
+
+  // "e" followed by a combining acute accent.
+  const Glyph combining = "e\xCC\x81";
+  EXPECT_EQ(combining, "e\xCC\x81");
+  EXPECT_EQ(combining.width(), 1);
+}
+
+TEST(GlyphTest, Pooled) {
+  // A family emoji: 4 code points joined by 3 zero width joiners.
+  const std::string family = "👨‍👩‍👧‍👦";
+  ASSERT_GT(family.size(), Glyph::kInlineSize);
+
+  const Glyph glyph = family;
+  EXPECT_EQ(glyph, family);
+  EXPECT_EQ(glyph.size(), family.size());
+  EXPECT_EQ(glyph.str(), family);
+
+  const Glyph other = family;
+  EXPECT_EQ(glyph, other);
+  EXPECT_NE(glyph, Glyph("a"));
+}
+
+TEST(GlyphTest, Compare) {
+  EXPECT_EQ(Glyph("a"), Glyph("a"));
+  EXPECT_NE(Glyph("a"), Glyph("b"));
+  EXPECT_NE(Glyph("a"), Glyph("ab"));
+  EXPECT_EQ("a", Glyph("a"));
+  EXPECT_NE(std::string("b"), Glyph("a"));
+}
+
+TEST(GlyphTest, Copy) {
+  Pixel pixel;
+  pixel.character = "x";
+  Pixel copy = pixel;
+  pixel.character = "y";
+  EXPECT_EQ(copy.character, "x");
+  EXPECT_EQ(pixel.character, "y");
+}
+
+}  // namespace ftxui
@@ -5,9 +5,12 @@
 #include <cstdint>
 #include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
 #include <limits>
+#include <functional>  // for less
 #include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
 #include <sstream>  // IWYU pragma: keep
+#include <string>   // for string, to_string
 #include <utility>  // for pair
+#include <vector>
 
 #include "ftxui/screen/image.hpp"  // for Image
 #include "ftxui/screen/pixel.hpp"  // for Pixel
@@ -70,59 +73,77 @@ void WindowsEmulateVT100Terminal() {
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void UpdatePixelStyle(const Screen* screen,
-                      std::stringstream& ss,
+                      std::string& out,
                       const Pixel& prev,
                       const Pixel& next) {
   // See https://gist.github.com/egmontkob/eb114294efbcd5adb1944c9f3cb5feda
   if (FTXUI_UNLIKELY(next.hyperlink != prev.hyperlink)) {
-    ss << "\x1B]8;;" << screen->Hyperlink(next.hyperlink) << "\x1B\\";
+    out += "\x1B]8;;";
+    out += screen->Hyperlink(next.hyperlink);
+    out += "\x1B\\";
   }
 
   // Bold
   if (FTXUI_UNLIKELY((next.bold ^ prev.bold) | (next.dim ^ prev.dim))) {
     // BOLD_AND_DIM_RESET:
-    ss << ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
-                                                                : "");
-    ss << (next.bold ? "\x1B[1m" : "");  // BOLD_SET
-    ss << (next.dim ? "\x1B[2m" : "");   // DIM_SET
+    out += ((prev.bold && !next.bold) || (prev.dim && !next.dim) ? "\x1B[22m"
+                                                                 : "");
+    out += (next.bold ? "\x1B[1m" : "");  // BOLD_SET
+    out += (next.dim ? "\x1B[2m" : "");   // DIM_SET
   }
 
   // Underline
   if (FTXUI_UNLIKELY(next.underlined != prev.underlined ||
                      next.underlined_double != prev.underlined_double)) {
-    ss << (next.underlined          ? "\x1B[4m"     // UNDERLINE
-           : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
-                                    : "\x1B[24m");  // UNDERLINE_RESET
+    out += (next.underlined          ? "\x1B[4m"     // UNDERLINE
+            : next.underlined_double ? "\x1B[21m"    // UNDERLINE_DOUBLE
+                                     : "\x1B[24m");  // UNDERLINE_RESET
   }
 
   // Blink
   if (FTXUI_UNLIKELY(next.blink != prev.blink)) {
-    ss << (next.blink ? "\x1B[5m"     // BLINK_SET
-                      : "\x1B[25m");  // BLINK_RESET
+    out += (next.blink ? "\x1B[5m"     // BLINK_SET
+                       : "\x1B[25m");  // BLINK_RESET
   }
 
   // Inverted
   if (FTXUI_UNLIKELY(next.inverted != prev.inverted)) {
-    ss << (next.inverted ? "\x1B[7m"     // INVERTED_SET
-                         : "\x1B[27m");  // INVERTED_RESET
+    out += (next.inverted ? "\x1B[7m"     // INVERTED_SET
+                          : "\x1B[27m");  // INVERTED_RESET
   }
 
   // Italics
   if (FTXUI_UNLIKELY(next.italic != prev.italic)) {
-    ss << (next.italic ? "\x1B[3m"     // ITALIC_SET
-                       : "\x1B[23m");  // ITALIC_RESET
+    out += (next.italic ? "\x1B[3m"     // ITALIC_SET
+                        : "\x1B[23m");  // ITALIC_RESET
   }
 
   // StrikeThrough
   if (FTXUI_UNLIKELY(next.strikethrough != prev.strikethrough)) {
-    ss << (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
-                              : "\x1B[29m");  // CROSSED_OUT_RESET
+    out += (next.strikethrough ? "\x1B[9m"     // CROSSED_OUT
+                               : "\x1B[29m");  // CROSSED_OUT_RESET
   }
 
   if (FTXUI_UNLIKELY(next.foreground_color != prev.foreground_color ||
                      next.background_color != prev.background_color)) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+    out += "\x1B[";
+    out += next.foreground_color.Print(false);
+    out += "m\x1B[";
+    out += next.background_color.Print(true);
+    out += "m";
+  }
+}
+
+// Whether the glyph covers two cells.
+bool IsFullWidth(const Pixel& pixel) {
+  return pixel.character.width() == 2;
+}
+
+void AppendGlyph(std::string& out, const Pixel& pixel) {
+  if (pixel.character.empty()) {
+    out += ' ';
+  } else {
+    out.append(pixel.character.data(), pixel.character.size());
   }
 }
 
@@ -151,7 +172,7 @@ struct TileEncoding {
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+const std::map<std::string, TileEncoding, std::less<>> tile_encoding = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
     {"╍", {2, 0, 2, 0, 0}},
@@ -294,8 +315,8 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
+template <class A, class B, class Compare>
+std::map<B, A> InvertMap(const std::map<A, B, Compare>& input) {
   std::map<B, A> output;
   for (const auto& it : input) {
     output[it.second] = it.first;
@@ -306,12 +327,12 @@ std::map<B, A> InvertMap(const std::map<A, B> input) {
 const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
     InvertMap(tile_encoding);
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
+void UpgradeLeftRight(Glyph& left, Glyph& right) {
+  const auto it_left = tile_encoding.find(left.view());
   if (it_left == tile_encoding.end()) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
+  const auto it_right = tile_encoding.find(right.view());
   if (it_right == tile_encoding.end()) {
     return;
   }
@@ -335,12 +356,12 @@ void UpgradeLeftRight(std::string& left, std::string& right) {
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
+void UpgradeTopDown(Glyph& top, Glyph& down) {
+  const auto it_top = tile_encoding.find(top.view());
   if (it_top == tile_encoding.end()) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
+  const auto it_down = tile_encoding.find(down.view());
   if (it_down == tile_encoding.end()) {
     return;
   }
@@ -368,6 +389,52 @@ bool ShouldAttemptAutoMerge(Pixel& pixel) {
   return pixel.automerge && pixel.character.size() == 3;
 }
 
+bool SamePixel(const Pixel& a, const Pixel& b) {
+  return a.character == b.character &&                //
+         a.foreground_color == b.foreground_color &&  //
+         a.background_color == b.background_color &&  //
+         a.hyperlink == b.hyperlink &&                //
+         a.blink == b.blink &&                        //
+         a.bold == b.bold &&                          //
+         a.dim == b.dim &&                            //
+         a.italic == b.italic &&                      //
+         a.inverted == b.inverted &&                  //
+         a.underlined == b.underlined &&              //
+         a.underlined_double == b.underlined_double &&
+         a.strikethrough == b.strikethrough;
+}
+
+void MoveCursorBy(std::string& out, int n, char direction) {
+  out += "\x1B[";
+  if (n != 1) {
+    out += std::to_string(n);
+  }
+  out += direction;
+}
+
+// Move the cursor using relative sequences only, so that it works wherever the
+// frame is drawn on the terminal.
+void MoveCursor(std::string& out, int& x, int& y, int to_x, int to_y) {
+  if (to_y > y) {
+    MoveCursorBy(out, to_y - y, 'B');  // MOVE_DOWN
+  } else if (to_y < y) {
+    MoveCursorBy(out, y - to_y, 'A');  // MOVE_UP
+  }
+  y = to_y;
+
+  if (to_x == x) {
+    return;
+  }
+  if (to_x == 0) {
+    out += "\r";  // MOVE_LEFT
+  } else if (to_x > x) {
+    MoveCursorBy(out, to_x - x, 'C');  // MOVE_RIGHT
+  } else {
+    MoveCursorBy(out, x - to_x, 'D');  // MOVE_LEFT
+  }
+  x = to_x;
+}
+
 }  // namespace
 
 /// A fixed dimension.
@@ -413,40 +480,153 @@ Screen::Screen(int dimx, int dimy) : Image{dimx, dimy} {
 /// terminal.
 /// @note Don't forget to flush stdout. Alternatively, you can use
 /// Screen::Print();
+/// @see AppendToString to reuse the memory of a previous output.
 std::string Screen::ToString() const {
-  std::stringstream ss;
+  std::string output;
+  AppendToString(output);
+  return output;
+}
+
+/// Append to `output` the characters printing the Screen on the terminal.
+/// Unlike ToString(), the capacity of `output` is reused. Clearing it in
+/// between frames makes printing the next frame free of memory allocation.
+/// @param output The buffer to append to.
+void Screen::AppendToString(std::string& output) const {
+  // Most of the cells are a single byte, without style changes.
+  output.reserve(output.size() + size_t(dimx_ + 2) * size_t(dimy_));
 
   const Pixel default_pixel;
   const Pixel* previous_pixel_ref = &default_pixel;
 
   for (int y = 0; y < dimy_; ++y) {
+    const Pixel* line = &pixels_[size_t(y) * size_t(dimx_)];
+
     // New line in between two lines.
     if (y != 0) {
-      UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+      UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
       previous_pixel_ref = &default_pixel;
-      ss << "\r\n";
+      output += "\r\n";
     }
 
     // After printing a fullwith character, we need to skip the next cell.
     bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
+    for (int x = 0; x < dimx_; ++x) {
+      const Pixel& pixel = line[x];
       if (!previous_fullwidth) {
-        UpdatePixelStyle(this, ss, *previous_pixel_ref, pixel);
+        UpdatePixelStyle(this, output, *previous_pixel_ref, pixel);
         previous_pixel_ref = &pixel;
-        if (pixel.character.empty()) {
-          ss << " ";
-        } else {
-          ss << pixel.character;
+        AppendGlyph(output, pixel);
+      }
+      previous_fullwidth = IsFullWidth(pixel);
+    }
+  }
+
+  // Reset the style to default:
+  UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
+}
+
+/// Append to `output` the characters updating a terminal that currently
+/// displays `previous` into this screen. Only the runs of cells that differ
+/// are written, using relative cursor movements in between.
+/// @param output The buffer to append to.
+/// @param previous The pixels of the frame currently displayed. It must have
+///                 the same dimensions as this screen.
+/// @param end_x The column of the cursor on the last line, before and after
+///              the update. This is where ToString() leaves it.
+void Screen::AppendDiffString(std::string& output,
+                              const std::vector<Pixel>& previous,
+                              int end_x) const {
+  if (dimy_ == 0) {
+    return;
+  }
+
+  // Rewriting a few unchanged cells is cheaper than moving the cursor over
+  // them.
+  const int max_gap = 3;
+
+  const Pixel default_pixel;
+  const Pixel* previous_pixel_ref = &default_pixel;
+
+  // The cursor may be in the "pending wrap" state after the last column has
+  // been written. Returning to the first column clears it.
+  output += "\r";
+  int cursor_x = 0;
+  int cursor_y = dimy_ - 1;
+
+  std::vector<bool> changed(dimx_);
+  for (int y = 0; y < dimy_; ++y) {
+    const Pixel* line = &pixels_[size_t(y) * size_t(dimx_)];
+    const Pixel* previous_line = &previous[size_t(y) * size_t(dimx_)];
+    for (int x = 0; x < dimx_; ++x) {
+      changed[x] = !SamePixel(line[x], previous_line[x]);
+    }
+
+    // A fullwidth character and the cell it covers are updated together, in
+    // both frames: overwriting half of a fullwidth character erases it.
+    for (int pass = 0; pass < 2; ++pass) {
+      for (int i = 0; i + 1 < dimx_; ++i) {
+        const int x = pass == 0 ? i : dimx_ - 2 - i;
+        if (changed[x] == changed[x + 1]) {
+          continue;
+        }
+        if (IsFullWidth(line[x]) || IsFullWidth(previous_line[x])) {
+          changed[x] = true;
+          changed[x + 1] = true;
         }
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
+    }
+
+    int x = 0;
+    while (x < dimx_) {
+      if (!changed[x]) {
+        ++x;
+        continue;
+      }
+
+      // Extend the run over the next changed cells, merging short gaps.
+      int end = x + 1;
+      while (end < dimx_) {
+        if (changed[end]) {
+          ++end;
+          continue;
+        }
+        int next = end;
+        while (next < dimx_ && !changed[next] && next - end <= max_gap) {
+          ++next;
+        }
+        if (next == dimx_ || !changed[next]) {
+          break;
+        }
+        end = next;
+      }
+
+      MoveCursor(output, cursor_x, cursor_y, x, y);
+      bool previous_fullwidth = false;
+      for (int i = x; i < end; ++i) {
+        const Pixel& pixel = line[i];
+        if (!previous_fullwidth) {
+          UpdatePixelStyle(this, output, *previous_pixel_ref, pixel);
+          previous_pixel_ref = &pixel;
+          AppendGlyph(output, pixel);
+        }
+        previous_fullwidth = IsFullWidth(pixel);
+      }
+      cursor_x = end;
+
+      // Writing the last column leaves the cursor in the "pending wrap" state,
+      // where relative movements are unreliable.
+      if (cursor_x >= dimx_) {
+        output += "\r";
+        cursor_x = 0;
+      }
+      x = end;
     }
   }
 
   // Reset the style to default:
-  UpdatePixelStyle(this, ss, *previous_pixel_ref, default_pixel);
+  UpdatePixelStyle(this, output, *previous_pixel_ref, default_pixel);
 
-  return ss.str();
+  MoveCursor(output, cursor_x, cursor_y, end_x, dimy_ - 1);
 }
 
 // Print the Screen to the terminal.
@@ -509,19 +689,19 @@ void Screen::ApplyShader() {
   for (int y = 0; y < dimy_; ++y) {
     for (int x = 0; x < dimx_; ++x) {
       // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
+      Pixel& cur = pixels_[y * dimx_ + x];
       if (!ShouldAttemptAutoMerge(cur)) {
         continue;
       }
 
       if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
+        Pixel& left = pixels_[y * dimx_ + x - 1];
         if (ShouldAttemptAutoMerge(left)) {
           UpgradeLeftRight(left.character, cur.character);
         }
       }
       if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
+        Pixel& top = pixels_[(y - 1) * dimx_ + x];
         if (ShouldAttemptAutoMerge(top)) {
           UpgradeTopDown(top.character, cur.character);
         }
@@ -14,10 +14,23 @@
 #include <array>    // for array
 #include <cstddef>  // for size_t
 #include <cstdint>  // for uint32_t, uint8_t, uint16_t, int32_t
+#include <cstring>  // for memcpy
 #include <string>   // for string, basic_string, wstring
 #include <tuple>    // for _Swallow_assign, ignore
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FTXUI_STRING_SSE2
+#include <emmintrin.h>  // for _mm_loadu_si128, _mm_cmpgt_epi8, _mm_movemask_epi8
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>  // for _mm256_loadu_si256, _mm256_cmpgt_epi8, _mm256_movemask_epi8
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>  // for _BitScanForward
+#endif
+
 #include "ftxui/screen/deprecated.hpp"       // for wchar_width, wstring_width
 #include "ftxui/screen/string_internal.hpp"  // for WordBreakProperty, EatCodePoint, CodepointToWordBreakProperty, GlyphCount, GlyphIterate, GlyphNext, GlyphPrevious, IsCombining, IsControl, IsFullWidth, Utf8ToWordBreakProperty
 
@@ -1147,6 +1160,143 @@ bool Bisearch(uint32_t ucs, const std::array<C, N>& table, C* out) {
   return false;
 }
 
+// How the code points of a 256 code points block of the Basic Multilingual
+// Plane are covered by a table of intervals.
+enum class BlockCoverage : uint8_t {
+  None,   // No code point of the block is in the table.
+  Full,   // Every code point of the block is in the table.
+  Mixed,  // The table must be searched.
+};
+
+// Summarize a sorted list of disjoint Interval, one entry per block of the BMP.
+// Most scripts, and in particular the CJK ideographs and Hangul syllables, are
+// made of whole blocks and never reach the binary search.
+template <size_t N>
+constexpr std::array<BlockCoverage, 256> ComputeBlockCoverage(
+    const std::array<Interval, N>& table) {
+  std::array<uint16_t, 256> count{};
+  for (auto interval : table) {
+    if (interval.first > 0xFFFF) {  // NOLINT
+      break;
+    }
+    const uint32_t last = interval.last < 0xFFFF ? interval.last : 0xFFFF;
+    for (uint32_t block = interval.first >> 8; block <= last >> 8; ++block) {
+      const uint32_t block_first = block << 8;
+      const uint32_t block_last = block_first | 0xFF;  // NOLINT
+      const uint32_t first =
+          interval.first > block_first ? interval.first : block_first;
+      const uint32_t end = last < block_last ? last : block_last;
+      count[block] += uint16_t(end - first + 1);  // NOLINT
+    }
+  }
+
+  std::array<BlockCoverage, 256> result{};
+  for (size_t block = 0; block < 256; ++block) {
+    result[block] = count[block] == 0     ? BlockCoverage::None   // NOLINT
+                    : count[block] == 256 ? BlockCoverage::Full   // NOLINT
+                                          : BlockCoverage::Mixed;  // NOLINT
+  }
+  return result;
+}
+
+constexpr auto g_full_width_blocks =
+    ComputeBlockCoverage(g_full_width_characters);
+constexpr auto g_extend_blocks = ComputeBlockCoverage(g_extend_characters);
+
+// Find a codepoint inside a sorted list of Interval, summarized by
+// |blocks| for the BMP.
+template <size_t N>
+bool Lookup(uint32_t ucs,
+            const std::array<BlockCoverage, 256>& blocks,
+            const std::array<Interval, N>& table) {
+  if (ucs <= 0xFFFF) {  // NOLINT
+    switch (blocks[ucs >> 8]) {  // NOLINT
+      case BlockCoverage::None:
+        return false;
+      case BlockCoverage::Full:
+        return true;
+      case BlockCoverage::Mixed:
+        break;
+    }
+  }
+  return Bisearch(ucs, table);
+}
+
+// Printable ASCII characters are a glyph made of a single byte, taking one
+// cell. They are neither combining nor control characters.
+bool IsPrintableAscii(char c) {
+  return c >= 0x20 && c < 0x7F;  // NOLINT
+}
+
+[[maybe_unused]] int CountTrailingZeros(uint32_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index = 0;  // NOLINT
+  _BitScanForward(&index, value);
+  return int(index);
+#else
+  return __builtin_ctz(value);
+#endif
+}
+
+// Return the number of printable ASCII characters at the beginning of |data|.
+// Text is mostly made of such runs, they are classified in bulk.
+size_t PrintableAsciiPrefix(const char* data, size_t size) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  {
+    const __m256i lower = _mm256_set1_epi8(0x1F);  // NOLINT
+    const __m256i upper = _mm256_set1_epi8(0x7F);  // NOLINT
+    for (; i + 32 <= size; i += 32) {              // NOLINT
+      const __m256i bytes =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+      // Bytes above 0x7F are negative, and fail the first comparison.
+      const __m256i printable =
+          _mm256_and_si256(_mm256_cmpgt_epi8(bytes, lower),
+                           _mm256_cmpgt_epi8(upper, bytes));
+      const auto mask = uint32_t(_mm256_movemask_epi8(printable));
+      if (mask != 0xFFFFFFFF) {  // NOLINT
+        return i + size_t(CountTrailingZeros(~mask));
+      }
+    }
+  }
+#endif
+#if defined(FTXUI_STRING_SSE2)
+  {
+    const __m128i lower = _mm_set1_epi8(0x1F);  // NOLINT
+    const __m128i upper = _mm_set1_epi8(0x7F);  // NOLINT
+    for (; i + 16 <= size; i += 16) {           // NOLINT
+      const __m128i bytes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      // Bytes above 0x7F are negative, and fail the first comparison.
+      const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, lower),
+                                              _mm_cmpgt_epi8(upper, bytes));
+      const auto mask = uint32_t(_mm_movemask_epi8(printable));
+      if (mask != 0xFFFF) {  // NOLINT
+        return i + size_t(CountTrailingZeros(~mask));
+      }
+    }
+  }
+#else
+  // Eight bytes at a time, using the bit twiddling hacks from:
+  // https://graphics.stanford.edu/~seander/bithacks.html#HasLessInWord
+  constexpr uint64_t ones = 0x0101010101010101;  // NOLINT
+  constexpr uint64_t high = 0x8080808080808080;  // NOLINT
+  for (; i + 8 <= size; i += 8) {                // NOLINT
+    uint64_t word = 0;
+    std::memcpy(&word, data + i, sizeof(word));
+    const uint64_t below = (word - ones * 0x20) & ~word & high;  // NOLINT
+    const uint64_t above = (((word & ~high) + ones) | word) & high;
+    if ((below | above) != 0) {
+      break;
+    }
+  }
+#endif
+  while (i < size && IsPrintableAscii(data[i])) {
+    ++i;
+  }
+  return i;
+}
+
 int codepoint_width(uint32_t ucs) {
   if (ftxui::IsControl(ucs)) {
     return -1;
@@ -1280,7 +1430,7 @@ bool EatCodePoint(const std::wstring& input,
 }
 
 bool IsCombining(uint32_t ucs) {
-  return Bisearch(ucs, g_extend_characters);
+  return Lookup(ucs, g_extend_blocks, g_extend_characters);
 }
 
 bool IsFullWidth(uint32_t ucs) {
@@ -1288,7 +1438,7 @@ bool IsFullWidth(uint32_t ucs) {
     return false;
   }
 
-  return Bisearch(ucs, g_full_width_characters);
+  return Lookup(ucs, g_full_width_blocks, g_full_width_characters);
 }
 
 bool IsControl(uint32_t ucs) {
@@ -1332,6 +1482,14 @@ int string_width(const std::string& input) {
   int width = 0;
   size_t start = 0;
   while (start < input.size()) {
+    if (IsPrintableAscii(input[start])) {
+      const size_t run =
+          PrintableAsciiPrefix(input.data() + start, input.size() - start);
+      width += int(run);
+      start += run;
+      continue;
+    }
+
     uint32_t codepoint = 0;
     if (!EatCodePoint(input, start, &start, &codepoint)) {
       continue;
@@ -1361,6 +1519,16 @@ std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    if (IsPrintableAscii(input[start])) {
+      const size_t run =
+          PrintableAsciiPrefix(input.data() + start, input.size() - start);
+      for (size_t i = start; i < start + run; ++i) {
+        out.emplace_back(1, input[i]);
+      }
+      start += run;
+      continue;
+    }
+
     uint32_t codepoint = 0;
     if (!EatCodePoint(input, start, &end, &codepoint)) {
       start = end;
@@ -1469,6 +1637,16 @@ std::vector<int> CellToGlyphIndex(const std::string& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    if (IsPrintableAscii(input[start])) {
+      const size_t run =
+          PrintableAsciiPrefix(input.data() + start, input.size() - start);
+      for (size_t i = 0; i < run; ++i) {
+        out.push_back(++x);
+      }
+      start += run;
+      continue;
+    }
+
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
     start = end;
@@ -1508,6 +1686,14 @@ int GlyphCount(const std::string& input) {
   size_t start = 0;
   size_t end = 0;
   while (start < input.size()) {
+    if (IsPrintableAscii(input[start])) {
+      const size_t run =
+          PrintableAsciiPrefix(input.data() + start, input.size() - start);
+      size += int(run);
+      start += run;
+      continue;
+    }
+
     uint32_t codepoint = 0;
     const bool eaten = EatCodePoint(input, start, &end, &codepoint);
     start = end;
@@ -126,6 +126,65 @@ TEST(StringTest, CellToGlyphIndex) {
   EXPECT_EQ(combining[2], 2);
 }
 
+TEST(StringTest, AsciiRuns) {
+  // Long enough to be classified in bulk, with a non printable character at
+  // every position.
+  const std::string ascii(70, 'a');
+  EXPECT_EQ(string_width(ascii), 70);
+  EXPECT_EQ(GlyphCount(ascii), 70);
+  EXPECT_EQ(Utf8ToGlyphs(ascii).size(), 70u);
+  EXPECT_EQ(CellToGlyphIndex(ascii).back(), 69);
+
+  for (size_t i = 0; i < ascii.size(); ++i) {
+    std::string control = ascii;
+    control[i] = '\1';
+    EXPECT_EQ(string_width(control), 69);
+    EXPECT_EQ(GlyphCount(control), 69);
+    EXPECT_EQ(Utf8ToGlyphs(control).size(), 69u);
+    EXPECT_EQ(CellToGlyphIndex(control).size(), 69u);
+
+    std::string fullwidth = ascii;
+    fullwidth.replace(i, 1, "测");
+    EXPECT_EQ(string_width(fullwidth), 71);
+    EXPECT_EQ(GlyphCount(fullwidth), 70);
+    EXPECT_EQ(Utf8ToGlyphs(fullwidth).size(), 71u);
+    EXPECT_EQ(CellToGlyphIndex(fullwidth).size(), 71u);
+  }
+
+  // DEL is a control character:
+  EXPECT_EQ(string_width(std::string(40, '\x7F')), 0);
+
+  // A combining character modifies the last glyph of a run:
+  const auto glyphs = Utf8ToGlyphs(ascii + "\xCC\x81");
+  ASSERT_EQ(glyphs.size(), 70u);
+  EXPECT_EQ(glyphs.back(), "a\xCC\x81");
+  EXPECT_EQ(string_width(ascii + "\xCC\x81"), 70);
+}
+
+TEST(StringTest, BlockBoundaries) {
+  // Whole blocks of the BMP:
+  EXPECT_TRUE(IsFullWidth(0x4E00));
+  EXPECT_TRUE(IsFullWidth(0x9FFF));
+  EXPECT_TRUE(IsFullWidth(0xAC00));
+  EXPECT_FALSE(IsCombining(0x4E00));
+  EXPECT_FALSE(IsFullWidth(0x0400));
+
+  // Blocks partially covered:
+  EXPECT_TRUE(IsFullWidth(0xA48C));
+  EXPECT_FALSE(IsFullWidth(0xA48D));
+  EXPECT_TRUE(IsFullWidth(0xD7A3));
+  EXPECT_FALSE(IsFullWidth(0xD7A4));
+  EXPECT_TRUE(IsFullWidth(0xFF01));
+  EXPECT_FALSE(IsFullWidth(0xFF61));
+  EXPECT_TRUE(IsCombining(0x0300));
+  EXPECT_FALSE(IsCombining(0x0370));
+
+  // Outside of the BMP:
+  EXPECT_TRUE(IsFullWidth(0x1F600));
+  EXPECT_TRUE(IsFullWidth(0x20000));
+  EXPECT_TRUE(IsCombining(0xE0100));
+}
+
 TEST(StringTest, Utf8ToWordBreakProperty) {
   using T = std::vector<WordBreakProperty>;
   using P = WordBreakProperty;
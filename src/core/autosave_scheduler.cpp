@@ -0,0 +1,77 @@
+// =============================================
+// 文件: autosave_scheduler.cpp
+// 描述: 自动保存调度器实现。
+// =============================================
+#include "autosave_scheduler.h"
+
+void AutosaveScheduler::markSaved(uint64_t version) {
+    savedVersion_ = version;
+    hasSaved_ = true;
+    observedVersion_ = version;
+    changed_ = false;
+    flushPending_ = false;
+}
+
+void AutosaveScheduler::reset() {
+    hasSaved_ = false;
+    changed_ = false;
+    flushPending_ = false;
+}
+
+bool AutosaveScheduler::shouldSave(uint64_t version, Clock::time_point now, bool flush) {
+    if (!isDirty(version)) {
+        changed_ = false;
+        flushPending_ = false;
+        return false;
+    }
+
+    // 版本只在调用时采样，改动时间精确到调用间隔即可
+    if (!changed_ || version != observedVersion_) {
+        if (!changed_) {
+            firstChange_ = now;
+            changed_ = true;
+        }
+        observedVersion_ = version;
+        lastChange_ = now;
+    }
+
+    if (saving_) {
+        flushPending_ = flushPending_ || flush;
+        return false;
+    }
+
+    bool forced = flush || flushPending_;
+    if (!forced) {
+        if (now < nextAllowed_) {
+            return false;
+        }
+        bool settled = now - lastChange_ >= policy_.debounce;
+        bool overdue = now - firstChange_ >= policy_.interval;
+        if (!settled && !overdue) {
+            return false;
+        }
+    }
+
+    saving_ = true;
+    flushPending_ = false;
+    savingVersion_ = version;
+    nextAllowed_ = now + policy_.interval;
+    return true;
+}
+
+void AutosaveScheduler::saveFinished(bool success, Clock::time_point now) {
+    saving_ = false;
+    if (!success) {
+        nextAllowed_ = now + policy_.retryDelay;
+        return;
+    }
+
+    savedVersion_ = savingVersion_;
+    hasSaved_ = true;
+    // 保存期间又有改动时，从保存完成起重新计时
+    if (changed_ && observedVersion_ != savedVersion_) {
+        firstChange_ = now;
+    } else {
+        changed_ = false;
+    }
+}
@@ -0,0 +1,54 @@
+// =============================================
+// 文件: autosave_scheduler.h
+// 描述: 自动保存调度器。按状态版本（见 state_version.h）判断是否有未保存的改动，
+//       并按以下规则决定何时写盘：
+//       - 版本与上次保存时相同则从不保存，空闲时没有任何磁盘读写；
+//       - 改动后等待静默 debounce 再保存，持续改动时最迟在首次改动后 interval 内保存；
+//       - 两次保存的开始时间至少相隔 interval，一个窗口内的连续操作只产生一次保存；
+//       - 背压：上一次保存完成前不开始新的保存，失败后等待 retryDelay 再重试。
+// 说明: 调度器本身不读时钟也不执行保存，由调用方传入当前时间与版本。
+// =============================================
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+class AutosaveScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Policy {
+        Clock::duration interval = std::chrono::seconds(60);
+        Clock::duration debounce = std::chrono::seconds(2);
+        Clock::duration retryDelay = std::chrono::seconds(10);
+    };
+
+    void setPolicy(const Policy& policy) { policy_ = policy; }
+    const Policy& getPolicy() const { return policy_; }
+
+    // 自动存档的内容与该版本的状态一致（如刚加载了自动存档）
+    void markSaved(uint64_t version);
+    // 自动存档的内容未知或与当前状态无关（如新游戏、加载了其他存档）
+    void reset();
+
+    bool isDirty(uint64_t version) const { return !hasSaved_ || version != savedVersion_; }
+    bool isSaving() const { return saving_; }
+
+    // 现在是否应保存。返回 true 时调用方须开始保存，完成后调用 saveFinished。
+    // flush 为 true 时不等待防抖与间隔（如离开游戏界面），但仍受背压限制：
+    // 保存进行中时记下请求，完成后的下一次调用立即保存
+    bool shouldSave(uint64_t version, Clock::time_point now, bool flush = false);
+    void saveFinished(bool success, Clock::time_point now);
+
+private:
+    Policy policy_;
+    uint64_t savedVersion_ = 0;
+    bool hasSaved_ = false;
+    uint64_t observedVersion_ = 0;     // 最近一次看到的版本，用于判断是否仍在改动
+    uint64_t savingVersion_ = 0;
+    Clock::time_point firstChange_;    // 自上次保存以来首次看到改动的时间
+    Clock::time_point lastChange_;
+    Clock::time_point nextAllowed_;    // 下一次保存最早的开始时间（间隔或失败重试）
+    bool changed_ = false;
+    bool saving_ = false;
+    bool flushPending_ = false;
+};
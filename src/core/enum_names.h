@@ -0,0 +1,217 @@
+// =============================================
+// 文件: enum_names.h
+// 描述: 枚举与名称的编译期对照表。存档（JSON 字段值）与物品目录文件共用。
+// 说明: 名称 -> 枚举用编译期构建的完美哈希：一次哈希定位槽位，再比对一次名称；
+//       枚举 -> 名称按 (值 - 最小值) 直接下标。新增枚举值只需在对应表中加一行，
+//       表中名称或值重复会在编译期报错。
+// =============================================
+#pragma once
+#include "item.h"
+#include "team_member.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+template <typename Enum>
+struct EnumEntry {
+    std::string_view name;
+    Enum value;
+};
+
+template <typename Enum, size_t N>
+class EnumNames {
+public:
+    // 槽位数取不小于 2N 的 2 的幂，种子搜索很快收敛
+    static constexpr size_t kSlotCount = [] {
+        size_t count = 1;
+        while (count < 2 * N) {
+            count *= 2;
+        }
+        return count;
+    }();
+
+    constexpr explicit EnumNames(const EnumEntry<Enum> (&entries)[N]) : entries_{}, minValue_(0), valid_(true) {
+        for (size_t i = 0; i < N; ++i) {
+            entries_[i] = entries[i];
+        }
+
+        // 值必须互不相同且连续（允许不从 0 开始），才能直接下标
+        minValue_ = static_cast<int>(entries_[0].value);
+        for (size_t i = 1; i < N; ++i) {
+            int value = static_cast<int>(entries_[i].value);
+            minValue_ = value < minValue_ ? value : minValue_;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            byValue_[i] = N;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            int offset = static_cast<int>(entries_[i].value) - minValue_;
+            if (offset >= static_cast<int>(N) || byValue_[offset] != N) {
+                valid_ = false;
+                return;
+            }
+            byValue_[offset] = i;
+        }
+
+        // 搜索使所有名称落入不同槽位的种子；名称重复时找不到
+        for (seed_ = 0; seed_ < 4096; ++seed_) {
+            for (size_t i = 0; i < kSlotCount; ++i) {
+                slots_[i] = N;
+            }
+            bool placed = true;
+            for (size_t i = 0; i < N && placed; ++i) {
+                size_t slot = slotOf(entries_[i].name);
+                placed = slots_[slot] == N;
+                slots_[slot] = i;
+            }
+            if (placed) {
+                return;
+            }
+        }
+        valid_ = false;
+    }
+
+    constexpr bool valid() const { return valid_; }
+    constexpr size_t size() const { return N; }
+    constexpr const EnumEntry<Enum>& operator[](size_t index) const { return entries_[index]; }
+
+    // 未收录的值返回空串
+    constexpr std::string_view toString(Enum value) const {
+        int offset = static_cast<int>(value) - minValue_;
+        return offset >= 0 && offset < static_cast<int>(N) ? entries_[byValue_[offset]].name : std::string_view();
+    }
+
+    constexpr bool contains(int value) const {
+        return value >= minValue_ && value < minValue_ + static_cast<int>(N);
+    }
+
+    constexpr bool fromString(std::string_view name, Enum& value) const {
+        size_t index = slots_[slotOf(name)];
+        if (index == N || entries_[index].name != name) {
+            return false;
+        }
+        value = entries_[index].value;
+        return true;
+    }
+
+private:
+    // FNV-1a，种子混入初始值；低位只取决于输入的低位，先折叠高位
+    constexpr size_t slotOf(std::string_view name) const {
+        uint32_t hash = 2166136261u ^ (seed_ * 16777619u);
+        for (char ch : name) {
+            hash ^= static_cast<uint8_t>(ch);
+            hash *= 16777619u;
+        }
+        return (hash ^ (hash >> 16)) & (kSlotCount - 1);
+    }
+
+    std::array<EnumEntry<Enum>, N> entries_;
+    std::array<size_t, N> byValue_{};
+    std::array<size_t, kSlotCount> slots_{};
+    int minValue_;
+    uint32_t seed_ = 0;
+    bool valid_;
+};
+
+// 各枚举的名称表
+namespace enum_names {
+
+constexpr EnumEntry<ItemType> kItemType[] = {
+    {"WEAPON", ItemType::WEAPON},
+    {"ARTIFACT", ItemType::ARTIFACT},
+    {"FOOD", ItemType::FOOD},
+    {"MATERIAL", ItemType::MATERIAL},
+};
+
+constexpr EnumEntry<WeaponType> kWeaponType[] = {
+    {"ONE_HANDED_SWORD", WeaponType::ONE_HANDED_SWORD},
+    {"TWO_HANDED_SWORD", WeaponType::TWO_HANDED_SWORD},
+    {"BOW", WeaponType::BOW},
+    {"CATALYST", WeaponType::CATALYST},
+};
+
+constexpr EnumEntry<ArtifactType> kArtifactType[] = {
+    {"FLOWER_OF_LIFE", ArtifactType::FLOWER_OF_LIFE},
+    {"PLUME_OF_DEATH", ArtifactType::PLUME_OF_DEATH},
+    {"SANDS_OF_EON", ArtifactType::SANDS_OF_EON},
+    {"GOBLET_OF_EONOTHEM", ArtifactType::GOBLET_OF_EONOTHEM},
+    {"CIRCLET_OF_LOGOS", ArtifactType::CIRCLET_OF_LOGOS},
+};
+
+constexpr EnumEntry<FoodType> kFoodType[] = {
+    {"RECOVERY", FoodType::RECOVERY},
+    {"ATTACK", FoodType::ATTACK},
+    {"ADVENTURE", FoodType::ADVENTURE},
+    {"DEFENSE", FoodType::DEFENSE},
+};
+
+constexpr EnumEntry<MaterialType> kMaterialType[] = {
+    {"MONSTER_DROP", MaterialType::MONSTER_DROP},
+    {"COOKING_INGREDIENT", MaterialType::COOKING_INGREDIENT},
+};
+
+constexpr EnumEntry<Rarity> kRarity[] = {
+    {"ONE_STAR", Rarity::ONE_STAR},
+    {"TWO_STAR", Rarity::TWO_STAR},
+    {"THREE_STAR", Rarity::THREE_STAR},
+    {"FOUR_STAR", Rarity::FOUR_STAR},
+    {"FIVE_STAR", Rarity::FIVE_STAR},
+};
+
+constexpr EnumEntry<MemberStatus> kMemberStatus[] = {
+    {"ACTIVE", MemberStatus::ACTIVE},
+    {"STANDBY", MemberStatus::STANDBY},
+    {"INJURED", MemberStatus::INJURED},
+};
+
+} // namespace enum_names
+
+// namesOf 按枚举类型重载，供下方的通用函数查找对应的表
+inline constexpr EnumNames kItemTypeNames{enum_names::kItemType};
+inline constexpr EnumNames kWeaponTypeNames{enum_names::kWeaponType};
+inline constexpr EnumNames kArtifactTypeNames{enum_names::kArtifactType};
+inline constexpr EnumNames kFoodTypeNames{enum_names::kFoodType};
+inline constexpr EnumNames kMaterialTypeNames{enum_names::kMaterialType};
+inline constexpr EnumNames kRarityNames{enum_names::kRarity};
+inline constexpr EnumNames kMemberStatusNames{enum_names::kMemberStatus};
+
+constexpr const auto& namesOf(ItemType) { return kItemTypeNames; }
+constexpr const auto& namesOf(WeaponType) { return kWeaponTypeNames; }
+constexpr const auto& namesOf(ArtifactType) { return kArtifactTypeNames; }
+constexpr const auto& namesOf(FoodType) { return kFoodTypeNames; }
+constexpr const auto& namesOf(MaterialType) { return kMaterialTypeNames; }
+constexpr const auto& namesOf(Rarity) { return kRarityNames; }
+constexpr const auto& namesOf(MemberStatus) { return kMemberStatusNames; }
+
+// 名称或值重复时完美哈希或直接下标无法构建
+static_assert(kItemTypeNames.valid(), "ItemType 的名称表中有重复的名称或值");
+static_assert(kWeaponTypeNames.valid(), "WeaponType 的名称表中有重复的名称或值");
+static_assert(kArtifactTypeNames.valid(), "ArtifactType 的名称表中有重复的名称或值");
+static_assert(kFoodTypeNames.valid(), "FoodType 的名称表中有重复的名称或值");
+static_assert(kMaterialTypeNames.valid(), "MaterialType 的名称表中有重复的名称或值");
+static_assert(kRarityNames.valid(), "Rarity 的名称表中有重复的名称或值");
+static_assert(kMemberStatusNames.valid(), "MemberStatus 的名称表中有重复的名称或值");
+
+template <typename Enum>
+constexpr std::string_view enumName(Enum value) {
+    return namesOf(Enum{}).toString(value);
+}
+
+template <typename Enum>
+constexpr bool tryParseEnum(std::string_view name, Enum& value) {
+    return namesOf(Enum{}).fromString(name, value);
+}
+
+// 无法识别时返回 fallback
+template <typename Enum>
+constexpr Enum parseEnum(std::string_view name, Enum fallback) {
+    tryParseEnum(name, fallback);
+    return fallback;
+}
+
+// 按序号存储的枚举值是否有效
+template <typename Enum>
+constexpr bool isEnumValue(int value) {
+    return namesOf(Enum{}).contains(value);
+}
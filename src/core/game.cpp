@@ -5,21 +5,28 @@
 // 注意: 避免在此文件中引入与 UI 强耦合的头，以保持核心层纯净。
 // =============================================
 #include "game.h"
-#include <iostream>
+#include "item_catalog.h"
+#include "../utils/global_settings.hpp"
+#include <algorithm>
 
 // 构造函数：初始化玩家与状态。地图与队伍的完整初始化在 StartNewGame 中完成。
 Game::Game() 
     : player_("默认玩家", 1, 1), 
       currentState_(GameState::MAIN_MENU) {
-    // 预留：保存系统的初始化如需异步或检查磁盘，可在此扩展
+    // 加载物品目录文件；缺失或有无效条目时提示，缺失的部分沿用内置物品定义
+    std::string catalogError;
+    ItemCatalog::instance().loadFromFile("data/items.json", &catalogError);
+    reportStatus(catalogError);
+    ApplySaveSettings();
 }
 
 // 开始新游戏：重置玩家、队伍、背包，并将地图定位到默认区块
 void Game::StartNewGame() {
-    std::cout << "开始新游戏..." << std::endl;
     InitializeNewPlayer();
+    // 新玩家没有可接续的存档，首次自动保存会写完整快照
+    gameSave_.beginJournal(player_, mapManager_.getCurrentBlockId());
+    autosave_.reset();
     currentState_ = GameState::PLAYING;
-    std::cout << "新游戏开始！" << std::endl;
 }
 
 // 加载游戏：采用带地图状态的加载流程
@@ -29,32 +36,30 @@ void Game::LoadGame() {
 
 // 加载指定存档文件
 void Game::LoadGame(const std::string& saveFileName) {
-    std::cout << "正在加载游戏: " << saveFileName << std::endl;
-    
     int currentBlockId = 0;
     SaveResult result = gameSave_.loadGame(player_, currentBlockId, saveFileName);
     
     if (result == SaveResult::SUCCESS) {
-        std::cout << "游戏加载成功！" << std::endl;
-        
         // 初始化地图系统到保存的区块
         mapManager_.switchToBlock(currentBlockId, player_.x, player_.y);
+        // 之后的改动接着该存档的日志记录
+        gameSave_.beginJournal(player_, currentBlockId, saveFileName);
+        markLoaded(saveFileName);
         
         currentState_ = GameState::PLAYING;
-        std::cout << "地图状态已恢复到区块 " << currentBlockId << "，位置 (" << player_.x << ", " << player_.y << ")" << std::endl;
     } else {
-        std::cout << "游戏加载失败，错误代码: " << static_cast<int>(result) << std::endl;
+        reportStatus("游戏加载失败，错误代码: " + std::to_string(static_cast<int>(result)));
+        // 加载失败时玩家数据可能已部分改动，不再接续原有日志
+        gameSave_.beginJournal(player_, mapManager_.getCurrentBlockId());
+        autosave_.reset();
     }
 }
 
 // 加载游戏并恢复地图状态：若无存档则启动新游戏
 void Game::LoadGameWithMapState() {
-    std::cout << "正在加载游戏..." << std::endl;
-    
     // 检查是否有存档文件
     auto saveFiles = gameSave_.listSaveFiles();
     if (saveFiles.empty()) {
-        std::cout << "没有找到存档文件，将开始新游戏。" << std::endl;
         StartNewGame();
         return;
     }
@@ -65,17 +70,15 @@ void Game::LoadGameWithMapState() {
     SaveResult result = gameSave_.loadGame(player_, currentBlockId, saveFile);
     
     if (result == SaveResult::SUCCESS) {
-        std::cout << "游戏加载成功！" << std::endl;
-        
         // 初始化地图系统到保存的区块
         mapManager_.switchToBlock(currentBlockId, player_.x, player_.y);
+        gameSave_.beginJournal(player_, currentBlockId, saveFile);
+        markLoaded(saveFile);
         
         currentState_ = GameState::PLAYING;
-        std::cout << "地图状态已恢复到区块 " << currentBlockId << "，位置 (" << player_.x << ", " << player_.y << ")" << std::endl;
     } else {
-        std::cout << "游戏加载失败，错误代码: " << static_cast<int>(result) << std::endl;
-        std::cout << "将开始新游戏。" << std::endl;
         StartNewGame();
+        reportStatus("游戏加载失败，错误代码: " + std::to_string(static_cast<int>(result)) + "，已开始新游戏");
     }
 }
 
@@ -86,33 +89,119 @@ void Game::SaveGame() {
 
 // 保存到指定存档文件名
 void Game::SaveGame(const std::string& saveFileName) {
-    std::cout << "正在保存游戏: " << saveFileName << std::endl;
-    
     // 获取当前地图状态
     int currentBlockId = mapManager_.getCurrentBlockId();
-    std::cout << "当前区块ID: " << currentBlockId << std::endl;
-    std::cout << "玩家位置: (" << player_.x << ", " << player_.y << ")" << std::endl;
     
+    gameSave_.setCompressionEnabled(GlobalSettings::IsSaveCompressionEnabled());
     SaveResult result = gameSave_.saveGame(player_, currentBlockId, saveFileName);
     if (result == SaveResult::SUCCESS) {
-        std::cout << "游戏保存成功！当前区块: " << currentBlockId << std::endl;
+        reportStatus("游戏保存成功！当前区块: " + std::to_string(currentBlockId));
     } else {
-        std::cout << "游戏保存失败，错误代码: " << static_cast<int>(result) << std::endl;
+        reportStatus("游戏保存失败，错误代码: " + std::to_string(static_cast<int>(result)));
     }
 }
 
-// 自动保存到默认文件名（示例：autosave.json）
+// 后台保存到指定存档文件名：当前状态在此序列化，写盘不阻塞 UI
+void Game::SaveGameAsync(const std::string& saveFileName, std::function<void(bool)> onComplete) {
+    int currentBlockId = mapManager_.getCurrentBlockId();
+    gameSave_.setCompressionEnabled(GlobalSettings::IsSaveCompressionEnabled());
+    // 结果由调用方显示：回调在界面循环内派发，不向终端输出
+    gameSave_.saveGameAsync(player_, currentBlockId, saveFileName,
+        [onComplete](SaveResult result) {
+            if (onComplete) {
+                onComplete(result == SaveResult::SUCCESS);
+            }
+        });
+}
+
+// 自动保存到默认文件名（autosave.json 或 autosave.sav，取决于存档格式设置）
 void Game::SaveGameWithMapState() {
-    std::cout << "正在保存游戏..." << std::endl;
-    
-    // 获取当前地图状态
+    // 状态未变或上一次保存仍在进行时静默跳过；只有真正写入的保存才回报结果
+    if (!autosave_.shouldSave(getStateVersion(), AutosaveScheduler::Clock::now(), true)) {
+        return;
+    }
+    startAutosave();
+}
+
+// 定时自动保存：状态未变时只比较一次版本号
+void Game::TickAutosave() {
+    int intervalSeconds = GlobalSettings::GetAutosaveIntervalSeconds();
+    if (currentState_ != GameState::PLAYING || intervalSeconds <= 0) {
+        return;
+    }
+    AutosaveScheduler::Policy policy = autosave_.getPolicy();
+    policy.interval = std::chrono::seconds(intervalSeconds);
+    autosave_.setPolicy(policy);
+    if (autosave_.shouldSave(getStateVersion(), AutosaveScheduler::Clock::now())) {
+        startAutosave();
+    }
+}
+
+uint64_t Game::getStateVersion() const {
+    return std::max(player_.getStateVersion(), mapManager_.getVersion());
+}
+
+std::string Game::autosaveFileName() const {
+    SaveFormat format = GlobalSettings::IsBinarySaveEnabled() ? SaveFormat::BINARY : SaveFormat::JSON;
+    return GameSave::withFormat("autosave", format);
+}
+
+// 调度器已同意保存：写入自动存档，完成后回报结果
+void Game::startAutosave() {
+    // 自动保存使用日志存档：只追加上次保存以来的改动，日志过长时才重写快照
     int currentBlockId = mapManager_.getCurrentBlockId();
-    
-    SaveResult result = gameSave_.saveGame(player_, currentBlockId, "autosave.json");
-    if (result == SaveResult::SUCCESS) {
-        std::cout << "游戏保存成功！当前区块: " << currentBlockId << std::endl;
+    gameSave_.setCompressionEnabled(GlobalSettings::IsSaveCompressionEnabled());
+    gameSave_.saveGameJournaled(player_, currentBlockId, autosaveFileName(),
+        [this, currentBlockId](SaveResult result) {
+            autosave_.saveFinished(result == SaveResult::SUCCESS, AutosaveScheduler::Clock::now());
+            if (result == SaveResult::SUCCESS) {
+                reportStatus("游戏保存成功！当前区块: " + std::to_string(currentBlockId));
+            } else {
+                reportStatus("游戏保存失败，错误代码: " + std::to_string(static_cast<int>(result)));
+            }
+        });
+}
+
+void Game::setStatusHandler(std::function<void(const std::string&)> handler) {
+    statusHandler_ = std::move(handler);
+    if (statusHandler_) {
+        gameSave_.setErrorHandler([this](const std::string& message) { reportStatus(message); });
+        // 界面接管之前（如构造时加载物品目录）留下的提示
+        if (!pendingStatus_.empty()) {
+            statusHandler_(pendingStatus_);
+            pendingStatus_.clear();
+        }
+    } else {
+        gameSave_.setErrorHandler(nullptr);
+    }
+}
+
+// 提示交给界面显示；完成回调在界面循环内派发，直接写终端会破坏画面
+void Game::reportStatus(const std::string& message) const {
+    if (message.empty()) {
+        return;
+    }
+    if (statusHandler_) {
+        statusHandler_(message);
     } else {
-        std::cout << "游戏保存失败，错误代码: " << static_cast<int>(result) << std::endl;
+        pendingStatus_ = message;
+    }
+}
+
+// 刚加载的是自动存档时，其内容即当前状态；否则自动存档与当前状态无关。
+// 加载中跳过或自动修复的内容（见 GameSave::getLoadWarnings）一并提示
+void Game::markLoaded(const std::string& saveFileName) {
+    if (saveFileName == autosaveFileName()) {
+        autosave_.markSaved(getStateVersion());
+    } else {
+        autosave_.reset();
+    }
+    std::string warnings;
+    for (const std::string& warning : gameSave_.getLoadWarnings()) {
+        warnings += (warnings.empty() ? "" : "；") + warning;
+    }
+    if (!warnings.empty()) {
+        reportStatus(warnings);
     }
 }
 
@@ -128,18 +217,12 @@ void Game::InitializeNewPlayer() {
     setupInitialInventory();
     
     // 初始化地图系统 - 从第一个区块开始
-    std::cout << "初始化地图系统..." << std::endl;
-    bool switchResult = mapManager_.switchToBlock(0, 4, 4);
-    std::cout << "地图切换结果: " << (switchResult ? "成功" : "失败") << std::endl;
-    std::cout << "当前区块ID: " << mapManager_.getCurrentBlockId() << std::endl;
+    mapManager_.switchToBlock(0, 4, 4);
     
     // 同步玩家位置到地图管理器
     auto pos = mapManager_.getPlayerPosition();
     player_.x = pos.first;
     player_.y = pos.second;
-    std::cout << "玩家位置同步: (" << player_.x << ", " << player_.y << ")" << std::endl;
-    
-    std::cout << "新游戏初始化完成！" << std::endl;
 }
 
 // 列出存档文件
@@ -147,6 +230,11 @@ std::vector<std::string> Game::getSaveFiles() const {
     return gameSave_.listSaveFiles();
 }
 
+// 列出存档及其概要信息
+std::vector<GameSave::SaveListing> Game::listSaves() const {
+    return gameSave_.listSaves();
+}
+
 // 读取存档的概要信息（不加载完整游戏）
 GameSave::SaveInfo Game::getSaveInfo(const std::string& saveFileName) const {
     return gameSave_.getSaveInfo(saveFileName);
@@ -162,15 +250,48 @@ bool Game::deleteSave(const std::string& saveFileName) const {
     return gameSave_.deleteSave(saveFileName);
 }
 
+// 转换存档格式
+bool Game::convertSave(const std::string& sourceFileName, const std::string& targetFileName) {
+    // 失败原因由存档界面提示，此处不向终端输出（界面循环运行中）
+    return gameSave_.convertSave(sourceFileName, targetFileName) == SaveResult::SUCCESS;
+}
+
+// 重命名存档
+bool Game::renameSave(const std::string& fromFileName, const std::string& toFileName) {
+    return gameSave_.renameSave(fromFileName, toFileName);
+}
+
+// 复制存档
+bool Game::copySave(const std::string& fromFileName, const std::string& toFileName) {
+    return gameSave_.copySave(fromFileName, toFileName);
+}
+
+// 切换存档存放方式：迁移失败时保持原方式并同步回设置
+void Game::ApplySaveSettings() {
+    bool enabled = GlobalSettings::IsSlotStoreEnabled();
+    if (enabled == gameSave_.isSlotStoreEnabled()) {
+        return;
+    }
+    if (!gameSave_.setSlotStoreEnabled(enabled)) {
+        reportStatus(std::string("切换存档存放方式失败，继续使用") + (enabled ? "存档目录" : "单文件容器"));
+        GlobalSettings::SetSlotStoreEnabled(!enabled);
+        return;
+    }
+    // 自动存档已换到另一处存放，下次保存重新写入
+    autosave_.reset();
+}
+
 // 直接更新玩家坐标。若涉及地图规则与碰撞，请使用 movePlayer。
 void Game::updatePlayerPosition(int x, int y) {
     player_.x = x;
     player_.y = y;
+    player_.markModified();
 }
 
 // 增加经验并在达到阈值时自动升级
 void Game::addExperience(int exp) {
     player_.experience += exp;
+    player_.markModified();
     
     // 检查是否升级
     int requiredExp = player_.level * 100; // 简单的升级公式
@@ -183,6 +304,7 @@ void Game::addExperience(int exp) {
 void Game::levelUp() {
     player_.level++;
     player_.experience = 0; // 重置经验值
+    player_.markModified();
     
     // 提升队伍成员等级
     for (auto& member : player_.teamMembers) {
@@ -190,19 +312,15 @@ void Game::levelUp() {
         member->resetHealth(); // 升级时恢复生命值
     }
     
-    std::cout << "恭喜！玩家升级到 " << player_.level << " 级！" << std::endl;
+    reportStatus("恭喜！玩家升级到 " + std::to_string(player_.level) + " 级！");
 }
 
-// 初始化背包：可按需添加初始物品（示例保留注释以示用法）
+// 初始化背包：放入物品目录中标记为初始物品（starter）的条目
 void Game::setupInitialInventory() {
-    // 添加一些初始物品
-    //player_.addItemToInventory(ItemFactory::createWeapon("新手剑", WeaponType::ONE_HANDED_SWORD, Rarity::ONE_STAR));
-    // player_.addItemToInventory(ItemFactory::createWeapon("精钢剑", WeaponType::ONE_HANDED_SWORD, Rarity::THREE_STAR));
-    // player_.addItemToInventory(ItemFactory::createArtifact("冒险家尾羽", ArtifactType::PLUME_OF_DEATH, Rarity::THREE_STAR));
-    // player_.addItemToInventory(ItemFactory::createFood("苹果", FoodType::RECOVERY, Rarity::ONE_STAR));
-    // player_.addItemToInventory(ItemFactory::createFood("辣椒", FoodType::ATTACK, Rarity::TWO_STAR));
-    // player_.addItemToInventory(ItemFactory::createMaterial("史莱姆凝液", MaterialType::MONSTER_DROP, Rarity::ONE_STAR));
-    // player_.addItemToInventory(ItemFactory::createMaterial("胡萝卜", MaterialType::COOKING_INGREDIENT, Rarity::ONE_STAR));
+    const auto& catalog = ItemCatalog::instance();
+    for (const auto* definition : catalog.getStarterItems()) {
+        player_.addItemToInventory(catalog.create(definition->name));
+    }
 }
 
 // 初始化队伍：为首位成员装备基础武器并设为活跃
@@ -212,7 +330,7 @@ void Game::setupInitialTeam() {
     
     if (!player_.teamMembers.empty()) {
         // 为第一个队伍成员装备初始武器
-        auto sword = ItemFactory::createWeapon("新手剑", WeaponType::ONE_HANDED_SWORD, Rarity::ONE_STAR);
+        auto sword = ItemCatalog::instance().create("新手剑");
         if (sword) {
             auto weapon = std::dynamic_pointer_cast<Weapon>(sword);
             if (weapon) {
@@ -238,6 +356,7 @@ bool Game::movePlayer(int deltaX, int deltaY) {
         auto pos = mapManager_.getPlayerPosition();
         player_.x = pos.first;
         player_.y = pos.second;
+        player_.markModified();
         return true;
     }
     return false;
@@ -7,6 +7,8 @@
 #include "../player/player.h"
 #include "../storage/storage.h"
 #include "map_v2.h"
+#include "autosave_scheduler.h"
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -33,6 +35,15 @@ public:
     void SaveGame();
     void LoadGame(const std::string& saveFileName);
     void SaveGame(const std::string& saveFileName);
+    // 后台保存：立即返回，写盘完成后在 UI 线程回调（参数为是否成功）
+    void SaveGameAsync(const std::string& saveFileName, std::function<void(bool)> onComplete = nullptr);
+    // 在 UI 线程派发后台保存的完成回调
+    size_t dispatchSaveCompletions() { return gameSave_.dispatchSaveCompletions(); }
+    // 后台保存完成时的通知（在写入线程调用），用于唤醒 UI 线程
+    void setSaveNotifier(std::function<void()> notifier) { gameSave_.setSaveNotifier(std::move(notifier)); }
+    // 保存结果与存档错误（如后台写盘失败）等提示的去向（由界面设置为游戏消息栏）；
+    // 未设置时不写终端（避免写入全屏界面），最后一条提示留到设置时补发
+    void setStatusHandler(std::function<void(const std::string&)> handler);
     // 初始化新玩家（供 StartNewGame 内部调用）
     void InitializeNewPlayer();
     
@@ -46,14 +57,36 @@ public:
     
     // 存档管理 ---------------------------------------------------------------
     std::vector<std::string> getSaveFiles() const;
+    // 列出存档及摘要（走摘要缓存，不解析存档正文）
+    std::vector<GameSave::SaveListing> listSaves() const;
+    // 启动存档目录服务：后台扫描 saves/ 并监视变化，回调在后台线程调用（见 GameSave::startSaveCatalog）
+    void startSaveCatalog(std::function<void()> onChange, std::function<void(const std::string&)> onError) {
+        gameSave_.startSaveCatalog(std::move(onChange), std::move(onError));
+    }
+    void stopSaveCatalog() { gameSave_.stopSaveCatalog(); }
+    void setSaveCatalogVisible(bool visible) { gameSave_.setSaveCatalogVisible(visible); }
     GameSave::SaveInfo getSaveInfo(const std::string& saveFileName) const;
     bool saveExists(const std::string& saveFileName) const;
     bool deleteSave(const std::string& saveFileName) const;
+    // 存档格式互转（目标格式由目标文件扩展名决定）
+    bool convertSave(const std::string& sourceFileName, const std::string& targetFileName);
+    bool renameSave(const std::string& fromFileName, const std::string& toFileName);
+    bool copySave(const std::string& fromFileName, const std::string& toFileName);
+    // 应用存档存放方式设置（目录或单文件容器），切换时迁移现有存档
+    void ApplySaveSettings();
     
     // 带地图状态的保存和加载 -------------------------------------------------
+    // 保存到自动存档：没有未保存的改动时不写盘，上一次保存未完成时推迟到其完成后
     void SaveGameWithMapState();
     void LoadGameWithMapState();
     
+    // 自动保存 ---------------------------------------------------------------
+    // 可存档状态（玩家、背包、队伍、地图）的版本，任何改动都会使其增大
+    uint64_t getStateVersion() const;
+    bool hasUnsavedChanges() const { return autosave_.isDirty(getStateVersion()); }
+    // 由 UI 线程定时调用：有改动且满足间隔/防抖条件时写入自动存档（见 AutosaveScheduler）
+    void TickAutosave();
+    
     // 游戏逻辑 ---------------------------------------------------------------
     // 更新玩家坐标（会直接写入玩家对象；地图移动请优先使用 movePlayer）
     void updatePlayerPosition(int x, int y);
@@ -80,10 +113,20 @@ private:
     GameState currentState_;
     // 地图管理器（V2 版本：支持区块切换与交互）
     MapManagerV2 mapManager_;
+    // 自动保存调度：记录自动存档对应的状态版本
+    AutosaveScheduler autosave_;
+    // 提示消息的去向（见 setStatusHandler）；设置之前的最后一条提示暂存，设置时补发
+    std::function<void(const std::string&)> statusHandler_;
+    mutable std::string pendingStatus_;
     
     // 辅助方法 ---------------------------------------------------------------
     // 初始化背包基础物品（可根据设计需要扩展）
     void setupInitialInventory();
     // 初始化队伍并装备基础武器
     void setupInitialTeam();
+    // 当前格式设置下的自动存档文件名
+    std::string autosaveFileName() const;
+    void startAutosave();
+    void reportStatus(const std::string& message) const;
+    void markLoaded(const std::string& saveFileName);
 };
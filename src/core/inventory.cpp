@@ -12,6 +12,7 @@ Inventory::Inventory(size_t maxCapacity)
 }
 
 InventoryResult Inventory::addItem(std::shared_ptr<Item> item) {
+    ensureLoaded();
     if (!item) {
         return InventoryResult::INVALID_OPERATION;
     }
@@ -26,39 +27,39 @@ InventoryResult Inventory::addItem(std::shared_ptr<Item> item) {
         auto existingItem = findStackableItem(item);
         if (existingItem) {
             existingItem->setQuantity(existingItem->getQuantity() + item->getQuantity());
+            recordOp(InventoryOp::Kind::ADD, item.get(), item->getName(), item->getQuantity());
             notifyItemChange(item->getName(), item->getQuantity(), true);
             return InventoryResult::SUCCESS;
         }
     }
 
     // 添加新物品
-    items_.push_back(item);
+    indexItem(item);
+    recordOp(InventoryOp::Kind::ADD, item.get(), item->getName(), item->getQuantity());
     notifyItemChange(item->getName(), item->getQuantity(), true);
     return InventoryResult::SUCCESS;
 }
 
 InventoryResult Inventory::removeItem(const std::string& itemName, int quantity) {
-    auto it = std::find_if(items_.begin(), items_.end(),
-        [&itemName](const std::shared_ptr<Item>& item) {
-            return item->getName() == itemName;
-        });
-
-    if (it == items_.end()) {
+    ensureLoaded();
+    auto item = findFirstNamed(itemName);
+    if (!item) {
         return InventoryResult::NOT_FOUND;
     }
 
-    if ((*it)->getQuantity() < quantity) {
+    if (item->getQuantity() < quantity) {
         return InventoryResult::INSUFFICIENT_QUANTITY;
     }
 
-    if ((*it)->getQuantity() == quantity) {
-        // 移除整个物品
-        items_.erase(it);
+    if (item->getQuantity() == quantity) {
+        // 移除整个物品：各索引 O(log n) 删除，id 回收复用
+        unindexItem(item.get());
     } else {
         // 减少数量
-        (*it)->setQuantity((*it)->getQuantity() - quantity);
+        item->setQuantity(item->getQuantity() - quantity);
     }
 
+    recordOp(InventoryOp::Kind::REMOVE, nullptr, itemName, quantity);
     notifyItemChange(itemName, quantity, false);
     return InventoryResult::SUCCESS;
 }
@@ -68,21 +69,18 @@ InventoryResult Inventory::useItem(const std::string& itemName) {
 }
 
 std::shared_ptr<Item> Inventory::getItem(const std::string& itemName) const {
-    auto it = std::find_if(items_.begin(), items_.end(),
-        [&itemName](const std::shared_ptr<Item>& item) {
-            return item->getName() == itemName;
-        });
-
-    return (it != items_.end()) ? *it : nullptr;
+    ensureLoaded();
+    return findFirstNamed(itemName);
 }
 
 std::vector<std::shared_ptr<Item>> Inventory::getAllItems() const {
-    return items_;
+    return getItemsInOrder(InventoryOrder::ACQUIRED);
 }
 
 std::vector<std::shared_ptr<Item>> Inventory::getItemsByType(ItemType type) const {
+    ensureLoaded();
     std::vector<std::shared_ptr<Item>> result;
-    for (const auto& item : items_) {
+    for (const auto& item : getAllItems()) {
         if (item->getType() == type) {
             result.push_back(item);
         }
@@ -91,8 +89,9 @@ std::vector<std::shared_ptr<Item>> Inventory::getItemsByType(ItemType type) cons
 }
 
 std::vector<std::shared_ptr<Item>> Inventory::getItemsByRarity(Rarity rarity) const {
+    ensureLoaded();
     std::vector<std::shared_ptr<Item>> result;
-    for (const auto& item : items_) {
+    for (const auto& item : getAllItems()) {
         if (item->getRarity() == rarity) {
             result.push_back(item);
         }
@@ -101,92 +100,342 @@ std::vector<std::shared_ptr<Item>> Inventory::getItemsByRarity(Rarity rarity) co
 }
 
 void Inventory::sortByName(bool ascending) {
-    std::sort(items_.begin(), items_.end(),
-        [ascending](const std::shared_ptr<Item>& a, const std::shared_ptr<Item>& b) {
-            if (ascending) {
-                return a->getName() < b->getName();
-            } else {
-                return a->getName() > b->getName();
-            }
-        });
+    setOrder(InventoryOrder::NAME, !ascending);
 }
 
 void Inventory::sortByType() {
-    std::sort(items_.begin(), items_.end(),
-        [](const std::shared_ptr<Item>& a, const std::shared_ptr<Item>& b) {
-            return static_cast<int>(a->getType()) < static_cast<int>(b->getType());
-        });
+    setOrder(InventoryOrder::TYPE);
 }
 
 void Inventory::sortByRarity(bool ascending) {
-    std::sort(items_.begin(), items_.end(),
-        [ascending](const std::shared_ptr<Item>& a, const std::shared_ptr<Item>& b) {
-            if (ascending) {
-                return static_cast<int>(a->getRarity()) < static_cast<int>(b->getRarity());
-            } else {
-                return static_cast<int>(a->getRarity()) > static_cast<int>(b->getRarity());
-            }
-        });
+    setOrder(InventoryOrder::RARITY, !ascending);
 }
 
-std::vector<std::shared_ptr<Item>> Inventory::searchItems(const std::string& keyword) const {
+void Inventory::setOrder(InventoryOrder order, bool reversed) {
+    order_ = order;
+    orderReversed_ = reversed;
+}
+
+std::vector<std::shared_ptr<Item>> Inventory::getItemsInOrder(InventoryOrder order, bool reversed) const {
+    ensureLoaded();
+    return getItemPage(order, 0, acquiredOrder_.size(), reversed);
+}
+
+std::vector<std::shared_ptr<Item>> Inventory::getItemPage(InventoryOrder order, size_t offset, size_t count,
+                                                          bool reversed) const {
+    ensureLoaded();
     std::vector<std::shared_ptr<Item>> result;
-    std::string lowerKeyword = keyword;
-    std::transform(lowerKeyword.begin(), lowerKeyword.end(), lowerKeyword.begin(), ::tolower);
+    auto ids = orderedIds(order, offset, count, reversed);
+    result.reserve(ids.size());
+    for (uint32_t id : ids) {
+        result.push_back(slots_[id].item);
+    }
+    return result;
+}
 
-    for (const auto& item : items_) {
-        std::string itemName = item->getName();
-        std::transform(itemName.begin(), itemName.end(), itemName.begin(), ::tolower);
+std::shared_ptr<Item> Inventory::getItemAt(InventoryOrder order, size_t position, bool reversed) const {
+    ensureLoaded();
+    auto ids = orderedIds(order, position, 1, reversed);
+    return ids.empty() ? nullptr : slots_[ids.front()].item;
+}
 
-        std::string itemDesc = item->getDescription();
-        std::transform(itemDesc.begin(), itemDesc.end(), itemDesc.begin(), ::tolower);
+size_t Inventory::getItemPosition(InventoryOrder order, const std::shared_ptr<Item>& item, bool reversed) const {
+    ensureLoaded();
+    if (!item) {
+        return static_cast<size_t>(-1);
+    }
+    auto it = itemIds_.find(item.get());
+    if (it == itemIds_.end()) {
+        return static_cast<size_t>(-1);
+    }
 
-        if (itemName.find(lowerKeyword) != std::string::npos ||
-            itemDesc.find(lowerKeyword) != std::string::npos) {
-            result.push_back(item);
+    uint32_t id = it->second;
+    uint64_t sequence = slots_[id].sequence;
+    size_t position = static_cast<size_t>(-1);
+    switch (order) {
+        case InventoryOrder::ACQUIRED:
+            position = acquiredOrder_.rank(sequence, id);
+            break;
+        case InventoryOrder::NAME:
+            position = nameOrder_.rank({item->getName(), sequence}, id);
+            break;
+        case InventoryOrder::TYPE:
+            position = typeOrder_.rank({static_cast<int>(item->getType()), sequence}, id);
+            break;
+        case InventoryOrder::RARITY:
+            position = rarityOrder_.rank({static_cast<int>(item->getRarity()), sequence}, id);
+            break;
+    }
+    if (position == static_cast<size_t>(-1) || !reversed) {
+        return position;
+    }
+    return acquiredOrder_.size() - 1 - position;
+}
+
+std::vector<std::shared_ptr<Item>> Inventory::searchItems(const std::string& keyword) const {
+    ensureLoaded();
+    std::vector<std::shared_ptr<Item>> result;
+    auto ids = searchIndex_.search(keyword);
+    // 索引按 id 返回，id 会被复用，因此再按获得序号排列
+    std::sort(ids.begin(), ids.end(), [this](uint32_t a, uint32_t b) {
+        return slots_[a].sequence < slots_[b].sequence;
+    });
+    result.reserve(ids.size());
+    for (uint32_t id : ids) {
+        result.push_back(slots_[id].item);
+    }
+    return result;
+}
+
+std::vector<std::shared_ptr<Item>> Inventory::fuzzySearchItems(const std::string& query, size_t limit) const {
+    ensureLoaded();
+    std::vector<std::shared_ptr<Item>> result;
+    auto matches = fuzzyIndex_.search(query, limit);
+    // 同分时按获得顺序排列
+    std::sort(matches.begin(), matches.end(), [this](const FuzzyIndex::Match& a, const FuzzyIndex::Match& b) {
+        if (a.score != b.score) {
+            return a.score > b.score;
         }
+        return slots_[a.id].sequence < slots_[b.id].sequence;
+    });
+    result.reserve(matches.size());
+    for (const auto& match : matches) {
+        result.push_back(slots_[match.id].item);
     }
     return result;
 }
 
 std::unordered_map<ItemType, int> Inventory::getItemTypeCounts() const {
+    ensureLoaded();
     std::unordered_map<ItemType, int> counts;
-    for (const auto& item : items_) {
+    for (const auto& item : getAllItems()) {
         counts[item->getType()]++;
     }
     return counts;
 }
 
 std::unordered_map<Rarity, int> Inventory::getRarityCounts() const {
+    ensureLoaded();
     std::unordered_map<Rarity, int> counts;
-    for (const auto& item : items_) {
+    for (const auto& item : getAllItems()) {
         counts[item->getRarity()]++;
     }
     return counts;
 }
 
 InventoryResult Inventory::addItems(const std::vector<std::shared_ptr<Item>>& items) {
-    for (const auto& item : items) {
-        InventoryResult result = addItem(item);
-        if (result != InventoryResult::SUCCESS) {
-            return result; // 如果添加任何一个物品失败，整个操作失败
+    ensureLoaded();
+    // 预检：统计需要的新格子数，可堆叠物品并入已有格子或本批次中更早的同类物品
+    std::vector<std::shared_ptr<Item>> stackTargets(items.size());
+    std::vector<size_t> newSlotIndices;
+    // 本批次中作为新格子放入的可堆叠物品，按名称索引，避免逐个回扫
+    std::unordered_multimap<std::string, size_t> pendingStacks;
+    for (size_t i = 0; i < items.size(); ++i) {
+        const auto& item = items[i];
+        if (!item) {
+            return InventoryResult::INVALID_OPERATION;
+        }
+        if (canStackItem(item)) {
+            stackTargets[i] = findStackableItem(item);
+            if (!stackTargets[i]) {
+                auto range = pendingStacks.equal_range(item->getName());
+                for (auto it = range.first; it != range.second; ++it) {
+                    const auto& pending = items[it->second];
+                    if (pending->getType() == item->getType() &&
+                        pending->getRarity() == item->getRarity()) {
+                        stackTargets[i] = pending;
+                        break;
+                    }
+                }
+                if (!stackTargets[i]) {
+                    pendingStacks.emplace(item->getName(), i);
+                }
+            }
+        }
+        if (!stackTargets[i]) {
+            newSlotIndices.push_back(i);
         }
     }
+
+    if (acquiredOrder_.size() + newSlotIndices.size() > maxCapacity_) {
+        return InventoryResult::FULL;
+    }
+
+    // 提交：一次性预留空间，再逐个放入并聚合变化
+    if (freeIds_.size() < newSlotIndices.size()) {
+        slots_.reserve(slots_.size() + newSlotIndices.size() - freeIds_.size());
+    }
+    ItemChangeSet changes;
+    std::unordered_map<std::string, size_t> changeIndex;
+    for (size_t i = 0; i < items.size(); ++i) {
+        const auto& item = items[i];
+        int quantity = item->getQuantity();
+        if (stackTargets[i]) {
+            stackTargets[i]->setQuantity(stackTargets[i]->getQuantity() + quantity);
+        } else {
+            indexItem(item);
+        }
+        recordOp(InventoryOp::Kind::ADD, item.get(), item->getName(), quantity);
+
+        auto inserted = changeIndex.emplace(item->getName(), changes.size());
+        if (inserted.second) {
+            changes.push_back({item->getName(), quantity, true});
+        } else {
+            changes[inserted.first->second].quantity += quantity;
+        }
+    }
+
+    notifyChanges(changes);
     return InventoryResult::SUCCESS;
 }
 
 std::vector<std::shared_ptr<Item>> Inventory::removeAllItems() {
-    std::vector<std::shared_ptr<Item>> removedItems = items_;
-    items_.clear();
+    // 尚未解码的物品直接丢弃，不必为清空而解码
+    pendingLoader_ = nullptr;
+    pendingCount_ = 0;
+    std::vector<std::shared_ptr<Item>> removedItems = getAllItems();
+    searchIndex_.clear();
+    fuzzyIndex_.clear();
+    acquiredOrder_.clear();
+    nameOrder_.clear();
+    typeOrder_.clear();
+    rarityOrder_.clear();
+    itemIds_.clear();
+    slots_.clear();
+    freeIds_.clear();
+    recordOp(InventoryOp::Kind::CLEAR, nullptr, std::string(), 0);
     return removedItems;
 }
 
+void Inventory::setPendingItems(size_t count, ItemLoader loader) {
+    removeAllItems();
+    pendingCount_ = count;
+    pendingLoader_ = std::move(loader);
+}
+
+void Inventory::ensureLoaded() const {
+    if (!pendingLoader_) {
+        return;
+    }
+    ItemLoader loader = std::move(pendingLoader_);
+    pendingLoader_ = nullptr;
+    pendingCount_ = 0;
+
+    // 放入的是存档中已有的物品：只填物品槽与索引，不记录操作、不发通知、不推进版本。
+    // 与 addItem 一样合并可堆叠物品，超出容量的物品丢弃
+    for (const auto& item : loader()) {
+        if (!item) {
+            continue;
+        }
+        if (canStackItem(item)) {
+            auto existingItem = findStackableItem(item);
+            if (existingItem) {
+                existingItem->setQuantity(existingItem->getQuantity() + item->getQuantity());
+                continue;
+            }
+        }
+        if (acquiredOrder_.size() < maxCapacity_) {
+            indexItem(item);
+        }
+    }
+}
+
 void Inventory::notifyItemChange(const std::string& itemName, int quantity, bool added) {
+    notifyChanges({{itemName, quantity, added}});
+}
+
+void Inventory::notifyChanges(const ItemChangeSet& changes) {
+    if (changes.empty()) {
+        return;
+    }
+    if (itemChangeSetCallback_) {
+        itemChangeSetCallback_(changes);
+    }
     if (itemChangeCallback_) {
-        itemChangeCallback_(itemName, quantity, added);
+        for (const auto& change : changes) {
+            itemChangeCallback_(change.itemName, change.quantity, change.added);
+        }
     }
 }
 
+void Inventory::recordOp(InventoryOp::Kind kind, const Item* item, const std::string& itemName, int quantity) {
+    // 每次成功的增删都经过这里，顺带推进状态版本
+    version_.bump();
+    if (itemOpCallback_) {
+        itemOpCallback_(InventoryOp{kind, item, itemName, quantity});
+    }
+}
+
+std::shared_ptr<Item> Inventory::findFirstNamed(const std::string& itemName) const {
+    // 名称索引以 (名称, 获得序号) 排序，因此第一个同名条目就是最早获得的物品
+    size_t id = nameOrder_.at(nameOrder_.lowerBound({itemName, 0}, 0));
+    if (id == decltype(nameOrder_)::npos || slots_[id].item->getName() != itemName) {
+        return nullptr;
+    }
+    return slots_[id].item;
+}
+
+void Inventory::indexItem(const std::shared_ptr<Item>& item) const {
+    // 优先复用已移除物品的 id，槽位数不超过背包曾同时容纳的物品数
+    uint32_t id;
+    if (!freeIds_.empty()) {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    } else {
+        id = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    uint64_t sequence = nextSequence_++;
+    slots_[id] = Slot{item, sequence};
+    itemIds_[item.get()] = id;
+    searchIndex_.add(id, item->getName(), item->getDescription());
+    fuzzyIndex_.add(id, item->getName());
+    acquiredOrder_.insert(sequence, id);
+    nameOrder_.insert({item->getName(), sequence}, id);
+    typeOrder_.insert({static_cast<int>(item->getType()), sequence}, id);
+    rarityOrder_.insert({static_cast<int>(item->getRarity()), sequence}, id);
+}
+
+std::vector<uint32_t> Inventory::orderedIds(InventoryOrder order, size_t offset, size_t count, bool reversed) const {
+    size_t total = acquiredOrder_.size();
+    if (offset >= total || count == 0) {
+        return {};
+    }
+    count = std::min(count, total - offset);
+
+    // 反向视图的 [offset, offset + count) 对应正向的 [total - offset - count, total - offset)
+    size_t start = reversed ? total - offset - count : offset;
+    std::vector<uint32_t> ids;
+    switch (order) {
+        case InventoryOrder::ACQUIRED: ids = acquiredOrder_.range(start, count); break;
+        case InventoryOrder::NAME:     ids = nameOrder_.range(start, count); break;
+        case InventoryOrder::TYPE:     ids = typeOrder_.range(start, count); break;
+        case InventoryOrder::RARITY:   ids = rarityOrder_.range(start, count); break;
+    }
+    if (reversed) {
+        std::reverse(ids.begin(), ids.end());
+    }
+    return ids;
+}
+
+void Inventory::unindexItem(const Item* item) {
+    auto it = itemIds_.find(item);
+    if (it == itemIds_.end()) {
+        return;
+    }
+    uint32_t id = it->second;
+    uint64_t sequence = slots_[id].sequence;
+    searchIndex_.remove(id);
+    fuzzyIndex_.remove(id);
+    acquiredOrder_.erase(sequence, id);
+    nameOrder_.erase({item->getName(), sequence}, id);
+    typeOrder_.erase({static_cast<int>(item->getType()), sequence}, id);
+    rarityOrder_.erase({static_cast<int>(item->getRarity()), sequence}, id);
+    itemIds_.erase(it);
+    slots_[id].item.reset();
+    freeIds_.push_back(id);
+}
+
 bool Inventory::canStackItem(const std::shared_ptr<Item>& item) const {
     // 只有材料类型的物品可以堆叠
     if (item->getType() != ItemType::MATERIAL) {
@@ -199,12 +448,19 @@ bool Inventory::canStackItem(const std::shared_ptr<Item>& item) const {
 }
 
 std::shared_ptr<Item> Inventory::findStackableItem(const std::shared_ptr<Item>& item) const {
-    for (const auto& existingItem : items_) {
-        if (existingItem->getName() == item->getName() &&
-            existingItem->getType() == item->getType() &&
+    // 只需检查同名物品，按获得顺序依次比较类型与稀有度
+    for (size_t position = nameOrder_.lowerBound({item->getName(), 0}, 0);; ++position) {
+        size_t id = nameOrder_.at(position);
+        if (id == decltype(nameOrder_)::npos) {
+            return nullptr;
+        }
+        const auto& existingItem = slots_[id].item;
+        if (existingItem->getName() != item->getName()) {
+            return nullptr;
+        }
+        if (existingItem->getType() == item->getType() &&
             existingItem->getRarity() == item->getRarity()) {
             return existingItem;
         }
     }
-    return nullptr;
 }
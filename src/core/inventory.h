@@ -4,10 +4,15 @@
 // =============================================
 #pragma once
 #include "item.h"
+#include "item_search_index.h"
+#include "order_index.h"
+#include "state_version.h"
+#include "../utils/fuzzy_index.hpp"
 #include <vector>
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <utility>
 #include <functional>
 
 // 背包操作结果枚举
@@ -19,6 +24,36 @@ enum class InventoryResult {
     INVALID_OPERATION
 };
 
+// 背包排序方式：每种排序都以顺序统计索引常驻维护
+enum class InventoryOrder {
+    ACQUIRED,   // 获得顺序（反向即"最近获得"）
+    NAME,
+    TYPE,
+    RARITY
+};
+
+// 物品变化记录：批量操作以变化集的形式一次性通知
+struct ItemChange {
+    std::string itemName;
+    int quantity;
+    bool added;
+};
+using ItemChangeSet = std::vector<ItemChange>;
+
+// 背包操作记录：按发生顺序描述每次成功的增删，
+// 对同一初始背包重放同样的操作可得到相同的结果（存档日志依赖这一点）
+struct InventoryOp {
+    enum class Kind {
+        ADD,     // item 为放入的物品，数量即本次放入数量
+        REMOVE,  // 按名称移除 quantity 个
+        CLEAR    // 清空背包
+    };
+    Kind kind;
+    const Item* item;
+    std::string itemName;
+    int quantity;
+};
+
 // 背包类
 class Inventory {
 public:
@@ -35,46 +70,129 @@ public:
     std::vector<std::shared_ptr<Item>> getAllItems() const;
     std::vector<std::shared_ptr<Item>> getItemsByType(ItemType type) const;
     std::vector<std::shared_ptr<Item>> getItemsByRarity(Rarity rarity) const;
-    size_t getCurrentSize() const { return items_.size(); }
+    // 数量查询不会触发延迟加载
+    size_t getCurrentSize() const { return pendingLoader_ ? pendingCount_ : acquiredOrder_.size(); }
     size_t getMaxCapacity() const { return maxCapacity_; }
-    bool isFull() const { return items_.size() >= maxCapacity_; }
-    bool isEmpty() const { return items_.empty(); }
+    bool isFull() const { return getCurrentSize() >= maxCapacity_; }
+    bool isEmpty() const { return getCurrentSize() == 0; }
 
-    // 排序功能
+    // 排序功能：只切换当前排序视图，不改变物品的获得顺序
     void sortByName(bool ascending = true);
     void sortByType();
     void sortByRarity(bool ascending = true);
+    void setOrder(InventoryOrder order, bool reversed = false);
+    InventoryOrder getOrder() const { return order_; }
+    bool isOrderReversed() const { return orderReversed_; }
+    std::vector<std::shared_ptr<Item>> getSortedItems() const { return getItemsInOrder(order_, orderReversed_); }
+
+    // 排序视图访问：增删物品时各排序索引 O(log n) 更新，
+    // 按位置取值/翻页同为 O(log n)（翻页另加页大小）
+    std::vector<std::shared_ptr<Item>> getItemsInOrder(InventoryOrder order, bool reversed = false) const;
+    std::vector<std::shared_ptr<Item>> getItemPage(InventoryOrder order, size_t offset, size_t count,
+                                                   bool reversed = false) const;
+    std::shared_ptr<Item> getItemAt(InventoryOrder order, size_t position, bool reversed = false) const;
+    // 物品在指定排序中的位置；不在背包中时返回 static_cast<size_t>(-1)
+    size_t getItemPosition(InventoryOrder order, const std::shared_ptr<Item>& item, bool reversed = false) const;
 
-    // 搜索功能
+    // 搜索功能：名称或描述包含关键字（UTF-8 按字符匹配，拉丁字母不区分大小写），
+    // 结果按获得顺序排列
     std::vector<std::shared_ptr<Item>> searchItems(const std::string& keyword) const;
+    // 模糊搜索：按名称的原文/拼音首字母/全拼做子序列匹配（如 "fyj" 匹配 "风鹰剑"），
+    // 结果按匹配得分从高到低排列；limit 为 0 表示不限数量
+    std::vector<std::shared_ptr<Item>> fuzzySearchItems(const std::string& query, size_t limit = 0) const;
 
     // 统计信息
     std::unordered_map<ItemType, int> getItemTypeCounts() const;
     std::unordered_map<Rarity, int> getRarityCounts() const;
 
     // 容量管理
-    void setMaxCapacity(size_t capacity) { maxCapacity_ = capacity; }
-    void expandCapacity(size_t additionalSlots) { maxCapacity_ += additionalSlots; }
+    void setMaxCapacity(size_t capacity) { maxCapacity_ = capacity; version_.bump(); }
+    void expandCapacity(size_t additionalSlots) { maxCapacity_ += additionalSlots; version_.bump(); }
+
+    // 状态版本：物品增删或容量变化时增大；排序视图与延迟加载不算修改（见 state_version.h）
+    uint64_t getVersion() const { return version_.get(); }
 
     // 批量操作
+    // addItems 为全有或全无：先预检容量，空间不足时背包保持不变并返回 FULL；
+    // 成功后只发出一次聚合通知
     InventoryResult addItems(const std::vector<std::shared_ptr<Item>>& items);
     std::vector<std::shared_ptr<Item>> removeAllItems();
 
+    // 延迟加载：清空背包后先按 count 个物品计数，首次访问物品时才调用 loader 生成并放入。
+    // 加载存档时用于推迟解码背包；这些物品本就属于存档，放入时不记录操作、不发通知
+    using ItemLoader = std::function<std::vector<std::shared_ptr<Item>>()>;
+    void setPendingItems(size_t count, ItemLoader loader);
+    bool hasPendingItems() const { return static_cast<bool>(pendingLoader_); }
+
     // 回调函数类型，用于物品变化通知
     using ItemChangeCallback = std::function<void(const std::string& itemName, int quantity, bool added)>;
 
+    // 变化集回调类型：每次操作（含批量操作）只调用一次
+    using ItemChangeSetCallback = std::function<void(const ItemChangeSet& changes)>;
+
     // 设置物品变化回调
     void setItemChangeCallback(ItemChangeCallback callback) {
         itemChangeCallback_ = callback;
     }
 
+    // 设置变化集回调
+    void setItemChangeSetCallback(ItemChangeSetCallback callback) {
+        itemChangeSetCallback_ = callback;
+    }
+
+    // 操作记录回调：每次成功的增删操作调用一次，批量放入时按物品逐个调用
+    using ItemOpCallback = std::function<void(const InventoryOp& op)>;
+    void setItemOpCallback(ItemOpCallback callback) {
+        itemOpCallback_ = callback;
+    }
+
 private:
-    std::vector<std::shared_ptr<Item>> items_;
     size_t maxCapacity_;
     ItemChangeCallback itemChangeCallback_;
+    ItemChangeSetCallback itemChangeSetCallback_;
+    ItemOpCallback itemOpCallback_;
+    StateVersion version_;
+
+    // 延迟加载的物品（见 setPendingItems）。延迟的物品在逻辑上早已在背包中，
+    // 首次访问（可能是 const 访问）时才补做解码并填入下面的物品槽与索引，因此这些状态为 mutable
+    mutable ItemLoader pendingLoader_;
+    mutable size_t pendingCount_ = 0;
+
+    // 物品槽：物品放入背包时占用一个 id（优先复用已移除物品的 id），
+    // 并记下递增的获得序号；id 只用于索引寻址，先后顺序一律看序号
+    struct Slot {
+        std::shared_ptr<Item> item;
+        uint64_t sequence = 0;
+    };
+    mutable std::vector<Slot> slots_;         // 下标即 id，移除后置空
+    mutable std::vector<uint32_t> freeIds_;   // 已置空、可复用的 id
+    mutable uint64_t nextSequence_ = 0;
+    mutable std::unordered_map<const Item*, uint32_t> itemIds_;
+
+    // 搜索索引
+    mutable ItemSearchIndex searchIndex_;
+    mutable FuzzyIndex fuzzyIndex_;
+
+    // 排序索引：键相同时按获得序号排列
+    mutable OrderIndex<uint64_t> acquiredOrder_;
+    mutable OrderIndex<std::pair<std::string, uint64_t>> nameOrder_;
+    mutable OrderIndex<std::pair<int, uint64_t>> typeOrder_;
+    mutable OrderIndex<std::pair<int, uint64_t>> rarityOrder_;
+    InventoryOrder order_ = InventoryOrder::ACQUIRED;
+    bool orderReversed_ = false;
+
 
     // 内部辅助函数
+    void ensureLoaded() const;
     void notifyItemChange(const std::string& itemName, int quantity, bool added);
+    void notifyChanges(const ItemChangeSet& changes);
+    void recordOp(InventoryOp::Kind kind, const Item* item, const std::string& itemName, int quantity);
+    // 按名称查找第一个（最早获得的）物品：经名称排序索引 O(log n)
+    std::shared_ptr<Item> findFirstNamed(const std::string& itemName) const;
+    // 只改动 mutable 的物品槽与索引，延迟加载时在 const 访问中调用
+    void indexItem(const std::shared_ptr<Item>& item) const;
+    void unindexItem(const Item* item);
+    std::vector<uint32_t> orderedIds(InventoryOrder order, size_t offset, size_t count, bool reversed) const;
     bool canStackItem(const std::shared_ptr<Item>& item) const;
     std::shared_ptr<Item> findStackableItem(const std::shared_ptr<Item>& item) const;
 };
@@ -0,0 +1,278 @@
+// =============================================
+// 文件: item_catalog.cpp
+// 描述: 物品目录实现。内置定义表、目录文件解析与完美哈希构建。
+// =============================================
+#include "item_catalog.h"
+#include "enum_names.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <fstream>
+
+namespace {
+
+// 内置物品定义（编译期常量表）
+struct BuiltinItem {
+    const char* name;
+    ItemType type;
+    int subType;
+    Rarity rarity;
+};
+
+constexpr BuiltinItem kBuiltinItems[] = {
+    {"新手剑", ItemType::WEAPON, static_cast<int>(WeaponType::ONE_HANDED_SWORD), Rarity::ONE_STAR},
+    {"精钢剑", ItemType::WEAPON, static_cast<int>(WeaponType::ONE_HANDED_SWORD), Rarity::THREE_STAR},
+    {"铁影阔剑", ItemType::WEAPON, static_cast<int>(WeaponType::ONE_HANDED_SWORD), Rarity::TWO_STAR},
+    {"飞天御剑", ItemType::WEAPON, static_cast<int>(WeaponType::ONE_HANDED_SWORD), Rarity::THREE_STAR},
+    {"风鹰剑", ItemType::WEAPON, static_cast<int>(WeaponType::ONE_HANDED_SWORD), Rarity::FOUR_STAR},
+    {"冒险家尾羽", ItemType::ARTIFACT, static_cast<int>(ArtifactType::PLUME_OF_DEATH), Rarity::THREE_STAR},
+    {"翠绿之影", ItemType::ARTIFACT, static_cast<int>(ArtifactType::FLOWER_OF_LIFE), Rarity::FOUR_STAR},
+    {"苹果", ItemType::FOOD, static_cast<int>(FoodType::RECOVERY), Rarity::ONE_STAR},
+    {"辣椒", ItemType::FOOD, static_cast<int>(FoodType::ATTACK), Rarity::TWO_STAR},
+    {"史莱姆凝液", ItemType::MATERIAL, static_cast<int>(MaterialType::MONSTER_DROP), Rarity::ONE_STAR},
+    {"史莱姆原浆", ItemType::MATERIAL, static_cast<int>(MaterialType::MONSTER_DROP), Rarity::TWO_STAR},
+    {"风之印", ItemType::MATERIAL, static_cast<int>(MaterialType::MONSTER_DROP), Rarity::THREE_STAR},
+    {"胡萝卜", ItemType::MATERIAL, static_cast<int>(MaterialType::COOKING_INGREDIENT), Rarity::ONE_STAR},
+};
+
+// 编译期检查：内置名称互不相同（哈希不同即名称不同）
+constexpr bool builtinNamesDistinct() {
+    constexpr size_t count = sizeof(kBuiltinItems) / sizeof(kBuiltinItems[0]);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = i + 1; j < count; ++j) {
+            if (ItemCatalog::hashName(kBuiltinItems[i].name) == ItemCatalog::hashName(kBuiltinItems[j].name)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+static_assert(builtinNamesDistinct(), "内置物品名称重复");
+
+// 子类型名称按物品类型查对应的枚举表
+bool parseSubType(ItemType type, std::string_view name, int& subType) {
+    auto parse = [&](auto value) {
+        bool found = tryParseEnum(name, value);
+        subType = static_cast<int>(value);
+        return found;
+    };
+    switch (type) {
+        case ItemType::WEAPON: return parse(WeaponType{});
+        case ItemType::ARTIFACT: return parse(ArtifactType{});
+        case ItemType::FOOD: return parse(FoodType{});
+        case ItemType::MATERIAL: return parse(MaterialType{});
+    }
+    return false;
+}
+
+} // namespace
+
+ItemCatalog& ItemCatalog::instance() {
+    static ItemCatalog catalog;
+    return catalog;
+}
+
+ItemCatalog::ItemCatalog() {
+    for (const auto& builtin : kBuiltinItems) {
+        definitions_.push_back({builtin.name, builtin.type, builtin.subType, builtin.rarity, false});
+    }
+    rebuildIndex();
+}
+
+bool ItemCatalog::loadFromFile(const std::string& path, std::string* error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        if (error) {
+            *error = "无法打开物品目录: " + path;
+        }
+        return false;
+    }
+
+    try {
+        nlohmann::json catalogJson;
+        file >> catalogJson;
+        if (!catalogJson.contains("items") || !catalogJson["items"].is_array()) {
+            if (error) {
+                *error = "物品目录缺少 items 数组: " + path;
+            }
+            return false;
+        }
+
+        std::string invalidEntries;
+        for (const auto& itemJson : catalogJson["items"]) {
+            ItemDefinition definition;
+            definition.name = itemJson.value("name", "");
+            if (definition.name.empty() ||
+                !tryParseEnum(itemJson.value("type", ""), definition.type) ||
+                !parseSubType(definition.type, itemJson.value("subType", ""), definition.subType) ||
+                !tryParseEnum(itemJson.value("rarity", ""), definition.rarity)) {
+                invalidEntries += (invalidEntries.empty() ? "" : " ") + itemJson.dump();
+                continue;
+            }
+            definition.starter = itemJson.value("starter", false);
+            addOrReplace(definition);
+        }
+        if (error && !invalidEntries.empty()) {
+            *error = "物品目录中存在无效条目，已跳过: " + invalidEntries;
+        }
+    } catch (const std::exception& e) {
+        if (error) {
+            *error = std::string("加载物品目录时发生错误: ") + e.what();
+        }
+        // 出错前已合并的条目保留，索引同样要覆盖它们
+        rebuildIndex();
+        return false;
+    }
+
+    rebuildIndex();
+    return true;
+}
+
+const ItemDefinition* ItemCatalog::find(std::string_view name) const {
+    if (slots_.empty()) {
+        return nullptr;
+    }
+    uint32_t bucket = hashName(name) % bucketSeeds_.size();
+    uint32_t slot = hashName(name, bucketSeeds_[bucket]) % slots_.size();
+    int32_t index = slots_[slot];
+    // 完美哈希只保证已收录名称无冲突，未收录名称需比对一次确认
+    if (index < 0 || definitions_[index].name != name) {
+        return nullptr;
+    }
+    return &definitions_[index];
+}
+
+bool ItemCatalog::verifyIndex() const {
+    std::vector<bool> used(slots_.size(), false);
+    for (size_t i = 0; i < definitions_.size(); ++i) {
+        std::string_view name = definitions_[i].name;
+        uint32_t bucket = hashName(name) % bucketSeeds_.size();
+        uint32_t slot = hashName(name, bucketSeeds_[bucket]) % slots_.size();
+        if (used[slot] || slots_[slot] != static_cast<int32_t>(i) || find(name) != &definitions_[i]) {
+            return false;
+        }
+        used[slot] = true;
+    }
+    return true;
+}
+
+std::shared_ptr<Item> ItemCatalog::create(std::string_view name, int quantity) const {
+    const ItemDefinition* definition = find(name);
+    if (!definition) {
+        return nullptr;
+    }
+
+    std::shared_ptr<Item> item;
+    switch (definition->type) {
+        case ItemType::WEAPON:
+            item = ItemFactory::createWeapon(definition->name, static_cast<WeaponType>(definition->subType), definition->rarity);
+            break;
+        case ItemType::ARTIFACT:
+            item = ItemFactory::createArtifact(definition->name, static_cast<ArtifactType>(definition->subType), definition->rarity);
+            break;
+        case ItemType::FOOD:
+            item = ItemFactory::createFood(definition->name, static_cast<FoodType>(definition->subType), definition->rarity);
+            break;
+        case ItemType::MATERIAL:
+            item = ItemFactory::createMaterial(definition->name, static_cast<MaterialType>(definition->subType), definition->rarity);
+            break;
+    }
+
+    if (item) {
+        item->setQuantity(quantity);
+    }
+    return item;
+}
+
+std::vector<const ItemDefinition*> ItemCatalog::getStarterItems() const {
+    std::vector<const ItemDefinition*> starters;
+    for (const auto& definition : definitions_) {
+        if (definition.starter) {
+            starters.push_back(&definition);
+        }
+    }
+    return starters;
+}
+
+void ItemCatalog::addOrReplace(const ItemDefinition& definition) {
+    size_t index = linearFind(definition.name);
+    if (index < definitions_.size()) {
+        definitions_[index] = definition;
+    } else {
+        definitions_.push_back(definition);
+    }
+}
+
+size_t ItemCatalog::linearFind(std::string_view name) const {
+    // 仅在加载阶段使用；索引重建前无法走完美哈希
+    for (size_t i = 0; i < definitions_.size(); ++i) {
+        if (definitions_[i].name == name) {
+            return i;
+        }
+    }
+    return definitions_.size();
+}
+
+void ItemCatalog::rebuildIndex() {
+    size_t count = definitions_.size();
+    size_t bucketCount = std::max<size_t>(1, count);
+    size_t slotCount = std::max<size_t>(1, count);
+
+    // 种子搜索失败时放大槽位表重试（名称很多时极少发生）
+    while (true) {
+        std::vector<std::vector<uint32_t>> buckets(bucketCount);
+        for (uint32_t i = 0; i < count; ++i) {
+            buckets[hashName(definitions_[i].name) % bucketCount].push_back(i);
+        }
+
+        // 先放置大桶，空槽越多越容易找到种子
+        std::vector<size_t> order(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        bucketSeeds_.assign(bucketCount, 0);
+        slots_.assign(slotCount, -1);
+        bool success = true;
+
+        for (size_t bucketIndex : order) {
+            const auto& bucket = buckets[bucketIndex];
+            if (bucket.empty()) {
+                break;
+            }
+
+            bool placed = false;
+            std::vector<uint32_t> candidate(bucket.size());
+            for (uint32_t seed = 1; seed < (1u << 16) && !placed; ++seed) {
+                placed = true;
+                for (size_t k = 0; k < bucket.size(); ++k) {
+                    uint32_t slot = hashName(definitions_[bucket[k]].name, seed) % slotCount;
+                    if (slots_[slot] >= 0 ||
+                        std::find(candidate.begin(), candidate.begin() + k, slot) != candidate.begin() + k) {
+                        placed = false;
+                        break;
+                    }
+                    candidate[k] = slot;
+                }
+                if (placed) {
+                    bucketSeeds_[bucketIndex] = seed;
+                    for (size_t k = 0; k < bucket.size(); ++k) {
+                        slots_[candidate[k]] = static_cast<int32_t>(bucket[k]);
+                    }
+                }
+            }
+
+            if (!placed) {
+                success = false;
+                break;
+            }
+        }
+
+        if (success) {
+            return;
+        }
+        slotCount += slotCount / 4 + 1;
+    }
+}
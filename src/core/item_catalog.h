@@ -0,0 +1,82 @@
+// =============================================
+// 文件: item_catalog.h
+// 描述: 物品目录声明。内置物品定义 + 启动时加载的目录文件，
+//       以完美哈希按名称 O(1) 解析物品定义并创建实例。
+// =============================================
+#pragma once
+#include "item.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 物品定义：目录中的一条声明式记录
+struct ItemDefinition {
+    std::string name;
+    ItemType type;
+    int subType;     // WeaponType/ArtifactType/FoodType/MaterialType 的序数
+    Rarity rarity;
+    bool starter;    // 新游戏时是否放入初始背包
+};
+
+// 物品目录（全局唯一）
+// 目录文件 data/items.json（随程序发布，构建时复制到构建目录；程序从工作目录读取），格式（JSON）：
+// { "items": [ { "name": "风鹰剑", "type": "WEAPON", "subType": "ONE_HANDED_SWORD",
+//                "rarity": "FOUR_STAR", "starter": false } ] }
+//   name     必填，物品名称，即查找与存档使用的键
+//   type     必填，WEAPON / ARTIFACT / FOOD / MATERIAL
+//   subType  必填，取值随 type：WEAPON 为 WeaponType（ONE_HANDED_SWORD、TWO_HANDED_SWORD、BOW、CATALYST），
+//            ARTIFACT 为 ArtifactType（FLOWER_OF_LIFE、PLUME_OF_DEATH、SANDS_OF_EON、GOBLET_OF_EONOTHEM、
+//            CIRCLET_OF_LOGOS），FOOD 为 FoodType（RECOVERY、ATTACK、ADVENTURE、DEFENSE），
+//            MATERIAL 为 MaterialType（MONSTER_DROP、COOKING_INGREDIENT）
+//   rarity   必填，ONE_STAR ~ FIVE_STAR
+//   starter  可选，默认 false；为 true 时新游戏放入初始背包
+// 文件中的同名条目覆盖内置定义，其余条目追加。发布的文件与内置定义表一致，修改物品只需改文件。
+class ItemCatalog {
+public:
+    static ItemCatalog& instance();
+
+    // 加载目录文件并与现有定义合并；文件不存在或无法解析时返回 false 且保持现有定义。
+    // 无效条目被跳过，不影响其余条目；跳过的条目与解析错误的说明写入 error（非空时）
+    bool loadFromFile(const std::string& path, std::string* error = nullptr);
+
+    // 按名称查找定义，未收录返回 nullptr
+    const ItemDefinition* find(std::string_view name) const;
+    bool contains(std::string_view name) const { return find(name) != nullptr; }
+
+    // 按名称创建物品实例（属性由 ItemFactory 按类型与稀有度生成）
+    std::shared_ptr<Item> create(std::string_view name, int quantity = 1) const;
+
+    // 初始背包物品
+    std::vector<const ItemDefinition*> getStarterItems() const;
+
+    const std::vector<ItemDefinition>& getDefinitions() const { return definitions_; }
+    size_t size() const { return definitions_.size(); }
+
+    // 完美哈希自检：每个已收录名称都落在各自独占的槽位并能查回自身定义
+    bool verifyIndex() const;
+
+    // 名称哈希（FNV-1a，可在编译期求值）
+    static constexpr uint32_t hashName(std::string_view name, uint32_t seed = 0) {
+        uint32_t hash = 2166136261u ^ (seed * 16777619u);
+        for (char ch : name) {
+            hash ^= static_cast<uint8_t>(ch);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+private:
+    ItemCatalog();
+
+    void addOrReplace(const ItemDefinition& definition);
+    void rebuildIndex();
+    size_t linearFind(std::string_view name) const;
+
+    std::vector<ItemDefinition> definitions_;
+
+    // 完美哈希（哈希-位移法）：名称先落入桶，再以桶的种子映射到唯一槽位
+    std::vector<uint32_t> bucketSeeds_;
+    std::vector<int32_t> slots_;   // 槽位 -> definitions_ 下标，-1 表示空槽
+};
@@ -0,0 +1,141 @@
+// =============================================
+// 文件: item_search_index.cpp
+// 描述: 物品搜索索引实现。n 元组按码点打包为 64 位键，
+//       长关键字先求三元组倒排表交集，再对候选做一次子串校验。
+// =============================================
+#include "item_search_index.h"
+#include "../utils/utf8.hpp"
+#include <algorithm>
+#include <iterator>
+
+uint64_t ItemSearchIndex::gramKey(const char32_t* codePoints, size_t length) {
+    // 每个码点 21 位；文本中不含 U+0000，因此不同长度的元组不会冲突
+    uint64_t key = 0;
+    for (size_t i = 0; i < length; ++i) {
+        key |= static_cast<uint64_t>(codePoints[i] & 0x1FFFFF) << (21 * i);
+    }
+    return key;
+}
+
+void ItemSearchIndex::collectGrams(const std::u32string& text, std::vector<uint64_t>& grams) {
+    for (size_t start = 0; start < text.size(); ++start) {
+        for (size_t length = 1; length <= kMaxGram && start + length <= text.size(); ++length) {
+            grams.push_back(gramKey(text.data() + start, length));
+        }
+    }
+}
+
+bool ItemSearchIndex::contains(const std::u32string& text, const std::u32string& pattern) {
+    return text.find(pattern) != std::u32string::npos;
+}
+
+void ItemSearchIndex::add(uint32_t id, const std::string& name, const std::string& description) {
+    remove(id);
+
+    Document document;
+    document.name = Utf8::DecodeFolded(name);
+    document.description = Utf8::DecodeFolded(description);
+    document.name.erase(std::remove(document.name.begin(), document.name.end(), U'\0'), document.name.end());
+    document.description.erase(std::remove(document.description.begin(), document.description.end(), U'\0'),
+                               document.description.end());
+
+    // 名称与描述分别取元组，避免跨字段拼接出虚假匹配
+    collectGrams(document.name, document.grams);
+    collectGrams(document.description, document.grams);
+    std::sort(document.grams.begin(), document.grams.end());
+    document.grams.erase(std::unique(document.grams.begin(), document.grams.end()), document.grams.end());
+
+    for (uint64_t gram : document.grams) {
+        auto& posting = postings_[gram];
+        // id 单调递增时直接追加，否则按序插入
+        if (posting.empty() || posting.back() < id) {
+            posting.push_back(id);
+        } else {
+            posting.insert(std::lower_bound(posting.begin(), posting.end(), id), id);
+        }
+    }
+
+    documents_.emplace(id, std::move(document));
+}
+
+void ItemSearchIndex::remove(uint32_t id) {
+    auto it = documents_.find(id);
+    if (it == documents_.end()) {
+        return;
+    }
+
+    for (uint64_t gram : it->second.grams) {
+        auto postingIt = postings_.find(gram);
+        if (postingIt == postings_.end()) {
+            continue;
+        }
+        auto& posting = postingIt->second;
+        auto pos = std::lower_bound(posting.begin(), posting.end(), id);
+        if (pos != posting.end() && *pos == id) {
+            posting.erase(pos);
+        }
+        if (posting.empty()) {
+            postings_.erase(postingIt);
+        }
+    }
+    documents_.erase(it);
+}
+
+void ItemSearchIndex::clear() {
+    documents_.clear();
+    postings_.clear();
+}
+
+std::vector<uint32_t> ItemSearchIndex::search(const std::string& keyword) const {
+    std::u32string pattern = Utf8::DecodeFolded(keyword);
+    pattern.erase(std::remove(pattern.begin(), pattern.end(), U'\0'), pattern.end());
+
+    std::vector<uint32_t> result;
+    if (pattern.empty()) {
+        result.reserve(documents_.size());
+        for (const auto& entry : documents_) {
+            result.push_back(entry.first);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // 短关键字本身就是一个已索引的元组，倒排表即为精确结果
+    if (pattern.size() <= kMaxGram) {
+        auto it = postings_.find(gramKey(pattern.data(), pattern.size()));
+        if (it != postings_.end()) {
+            result = it->second;
+        }
+        return result;
+    }
+
+    // 长关键字：收集三元组倒排表，从最短的开始求交集
+    std::vector<const std::vector<uint32_t>*> lists;
+    for (size_t start = 0; start + kMaxGram <= pattern.size(); ++start) {
+        auto it = postings_.find(gramKey(pattern.data() + start, kMaxGram));
+        if (it == postings_.end()) {
+            return result;
+        }
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+        [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b) { return a->size() < b->size(); });
+
+    std::vector<uint32_t> candidates = *lists.front();
+    std::vector<uint32_t> scratch;
+    for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+        scratch.clear();
+        std::set_intersection(candidates.begin(), candidates.end(),
+                              lists[i]->begin(), lists[i]->end(), std::back_inserter(scratch));
+        candidates.swap(scratch);
+    }
+
+    // 三元组全部命中不代表连续出现，逐个校验
+    for (uint32_t id : candidates) {
+        const Document& document = documents_.at(id);
+        if (contains(document.name, pattern) || contains(document.description, pattern)) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
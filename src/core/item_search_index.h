@@ -0,0 +1,40 @@
+// =============================================
+// 文件: item_search_index.h
+// 描述: 物品搜索索引声明。按 UTF-8 码点建立 1~3 元组倒排索引，
+//       随背包增删增量维护，查询不再逐个扫描物品文本。
+// =============================================
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ItemSearchIndex {
+public:
+    // 建立/移除索引；id 由调用方分配，可复用已移除的 id
+    void add(uint32_t id, const std::string& name, const std::string& description);
+    void remove(uint32_t id);
+    void clear();
+
+    // 子串搜索（大小写折叠后比较名称与描述），返回按 id 升序排列的结果；
+    // 关键字为空时返回全部
+    std::vector<uint32_t> search(const std::string& keyword) const;
+
+    size_t size() const { return documents_.size(); }
+
+private:
+    static constexpr size_t kMaxGram = 3;
+
+    struct Document {
+        std::u32string name;
+        std::u32string description;
+        std::vector<uint64_t> grams;   // 去重后的 n 元组，移除时据此清理倒排表
+    };
+
+    static uint64_t gramKey(const char32_t* codePoints, size_t length);
+    static void collectGrams(const std::u32string& text, std::vector<uint64_t>& grams);
+    static bool contains(const std::u32string& text, const std::u32string& pattern);
+
+    std::unordered_map<uint32_t, Document> documents_;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> postings_;   // n 元组 -> 升序 id 列表
+};
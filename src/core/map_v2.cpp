@@ -3,6 +3,7 @@
 // 描述: 地图系统实现。区块网格渲染、交互处理、区块切换与总览输出。
 // =============================================
 #include "map_v2.h"
+#include "item_catalog.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
@@ -39,6 +40,7 @@ const MapCell& MapBlock::getCell(int x, int y) const {
 void MapBlock::setCell(int x, int y, const MapCell& cell) {
     if (isValidPosition(x, y)) {
         grid_[y][x] = cell;
+        version_.bump();
     }
 }
 
@@ -50,6 +52,7 @@ void MapBlock::setPlayerPosition(int x, int y) {
     if (isValidPosition(x, y)) {
         playerX_ = x;
         playerY_ = y;
+        version_.bump();
     }
 }
 
@@ -69,6 +72,7 @@ bool MapBlock::movePlayer(int deltaX, int deltaY) {
     if (canMoveTo(newX, newY)) {
         playerX_ = newX;
         playerY_ = newY;
+        version_.bump();
         return true;
     }
     return false;
@@ -90,6 +94,8 @@ int MapBlock::getExitTarget(int x, int y) const {
 InteractionResult MapBlock::interact(Player& player, InteractionType interactionType) {
     auto it = interactionHandlers_.find(interactionType);
     if (it != interactionHandlers_.end()) {
+        // 处理函数可能直接改动格子与区块内的进度标记
+        version_.bump();
         return it->second(player, playerX_, playerY_);
     }
     return InteractionResult(false, "无法进行此交互");
@@ -205,7 +211,7 @@ void TutorialBlock::initializeGrid() {
     // 放置一些物品
     MapCell itemCell(CellType::ITEM, "I", "苹果");
     itemCell.interactions.push_back(InteractionType::PICKUP);
-    itemCell.item = ItemFactory::createFood("苹果", FoodType::RECOVERY, Rarity::ONE_STAR);
+    itemCell.item = ItemCatalog::instance().create("苹果");
     setCell(3, 3, itemCell);
     
     // 设置东出口
@@ -332,22 +338,20 @@ InteractionResult StatueOfSevenBlock::handleActivate(Player& player, int x, int
 InteractionResult StatueOfSevenBlock::handleChest(Player& player, int x, int y) {
     MapCell& cell = getCell(x, y);
     if (cell.type == CellType::ITEM && !chestOpened_) {
-        chestOpened_ = true;
-        
         // 宝箱奖励
         std::vector<std::shared_ptr<Item>> rewards;
-        auto weapon = ItemFactory::createWeapon("风鹰剑", WeaponType::ONE_HANDED_SWORD, Rarity::FOUR_STAR);
-        auto artifact = ItemFactory::createArtifact("翠绿之影", ArtifactType::FLOWER_OF_LIFE, Rarity::FOUR_STAR);
-        auto material = ItemFactory::createMaterial("风之印", MaterialType::MONSTER_DROP, Rarity::THREE_STAR);
-        
-        rewards.push_back(weapon);
-        rewards.push_back(artifact);
-        rewards.push_back(material);
+        const auto& catalog = ItemCatalog::instance();
+        for (const char* name : {"风鹰剑", "翠绿之影", "风之印"}) {
+            if (auto item = catalog.create(name)) {
+                rewards.push_back(item);
+            }
+        }
         
-        // 添加到背包
-        for (auto& item : rewards) {
-            player.addItemToInventory(item);
+        // 整批放入背包；空间不足时宝箱保持未开启，可腾出空间后再来
+        if (player.addItemsToInventory(rewards) != InventoryResult::SUCCESS) {
+            return InteractionResult(false, "背包空间不足，无法收下宝箱中的全部物品");
         }
+        chestOpened_ = true;
         
         // 移除宝箱
         cell.type = CellType::EMPTY;
@@ -458,22 +462,27 @@ InteractionResult SlimeBattleBlock::handleBattle(Player& player, int x, int y) {
         
         // 战斗奖励
         std::vector<std::shared_ptr<Item>> rewards;
-        auto slimeCondensate = ItemFactory::createMaterial("史莱姆凝液", MaterialType::MONSTER_DROP, Rarity::ONE_STAR);
-        auto slimeSecretions = ItemFactory::createMaterial("史莱姆原浆", MaterialType::MONSTER_DROP, Rarity::TWO_STAR);
-        
-        rewards.push_back(slimeCondensate);
-        rewards.push_back(slimeSecretions);
-        
-        for (auto& item : rewards) {
-            player.addItemToInventory(item);
+        const auto& catalog = ItemCatalog::instance();
+        for (const char* name : {"史莱姆凝液", "史莱姆原浆"}) {
+            if (auto item = catalog.create(name)) {
+                rewards.push_back(item);
+            }
         }
         
+        bool rewardsAdded = player.addItemsToInventory(rewards) == InventoryResult::SUCCESS;
+        
         // 经验奖励
         player.experience += 50;
+        player.markModified();
         
         battleLog += "\n战斗胜利！\n";
         battleLog += "获得经验：50\n";
-        battleLog += "获得物品：史莱姆凝液、史莱姆原浆";
+        if (rewardsAdded) {
+            battleLog += "获得物品：史莱姆凝液、史莱姆原浆";
+        } else {
+            battleLog += "背包空间不足，掉落物未能拾取";
+            rewards.clear();
+        }
         
         return InteractionResult(true, battleLog, rewards, true);
     } else {
@@ -989,6 +998,14 @@ bool MapManagerV2::isMapCompleted() const {
     return getCompletedBlocksCount() == getTotalBlocksCount();
 }
 
+uint64_t MapManagerV2::getVersion() const {
+    uint64_t version = 0;
+    for (const auto& entry : blocks_) {
+        version = std::max(version, entry.second->getVersion());
+    }
+    return version;
+}
+
 void MapManagerV2::handleBlockTransition(int targetBlockId) {
     auto targetBlock = getBlock(targetBlockId);
     if (targetBlock) {
@@ -10,6 +10,7 @@
 #include <functional>
 #include "../core/item.h"
 #include "../player/player.h"
+#include "state_version.h"
 
 // 地图区块类型枚举
 enum class MapBlockType {
@@ -99,7 +100,10 @@ public:
     MapBlockType getType() const { return type_; }
     std::string getDescription() const { return description_; }
     BlockState getState() const { return state_; }
-    void setState(BlockState state) { state_ = state; }
+    void setState(BlockState state) { state_ = state; version_.bump(); }
+
+    // 状态版本：玩家位置、格子、区块状态变化或发生交互时增大（见 state_version.h）
+    uint64_t getVersion() const { return version_.get(); }
 
     // 网格操作
     MapCell& getCell(int x, int y);
@@ -146,6 +150,8 @@ protected:
     // 交互处理函数
     std::map<InteractionType, std::function<InteractionResult(Player&, int, int)>> interactionHandlers_;
     
+    StateVersion version_;
+    
     // 初始化方法
     virtual void initializeGrid() = 0;
     virtual void initializeInteractionHandlers() = 0;
@@ -274,6 +280,9 @@ public:
     int getCompletedBlocksCount() const;
     int getTotalBlocksCount() const { return blocks_.size(); }
     bool isMapCompleted() const;
+    
+    // 状态版本：取各区块版本的最大值，切换区块、移动或交互后增大
+    uint64_t getVersion() const;
 
 private:
     std::map<int, std::shared_ptr<MapBlock>> blocks_;
@@ -0,0 +1,241 @@
+// =============================================
+// 文件: order_index.h
+// 描述: 顺序统计索引（模板）。以 (键, id) 为序的 Treap，
+//       每个节点记录子树大小，插入/删除/按位置取值/求名次均为 O(log n)。
+// =============================================
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+template <typename Key, typename Compare = std::less<Key>>
+class OrderIndex {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    void insert(const Key& key, uint32_t id) {
+        int node = allocate(key, id);
+        int left = -1;
+        int right = -1;
+        split(root_, key, id, left, right);
+        root_ = merge(merge(left, node), right);
+    }
+
+    // 删除 (key, id)；不存在时返回 false
+    bool erase(const Key& key, uint32_t id) {
+        int parent = -1;
+        int node = root_;
+        while (node != -1 && !matches(nodes_[node], key, id)) {
+            parent = node;
+            node = less(key, id, nodes_[node]) ? nodes_[node].left : nodes_[node].right;
+        }
+        if (node == -1) {
+            return false;
+        }
+
+        int replacement = merge(nodes_[node].left, nodes_[node].right);
+        if (parent == -1) {
+            root_ = replacement;
+        } else if (nodes_[parent].left == node) {
+            nodes_[parent].left = replacement;
+        } else {
+            nodes_[parent].right = replacement;
+        }
+        // 沿查找路径更新子树大小
+        for (int current = root_; current != replacement;) {
+            --nodes_[current].size;
+            current = less(key, id, nodes_[current]) ? nodes_[current].left : nodes_[current].right;
+        }
+
+        nodes_[node].left = freeList_;
+        freeList_ = node;
+        return true;
+    }
+
+    void clear() {
+        nodes_.clear();
+        root_ = -1;
+        freeList_ = -1;
+    }
+
+    size_t size() const { return root_ == -1 ? 0 : nodes_[root_].size; }
+    bool empty() const { return root_ == -1; }
+
+    // 第 position 个元素的 id（从 0 开始）；越界返回 npos
+    size_t at(size_t position) const {
+        int node = root_;
+        while (node != -1) {
+            size_t leftSize = sizeOf(nodes_[node].left);
+            if (position < leftSize) {
+                node = nodes_[node].left;
+            } else if (position == leftSize) {
+                return nodes_[node].id;
+            } else {
+                position -= leftSize + 1;
+                node = nodes_[node].right;
+            }
+        }
+        return npos;
+    }
+
+    // (key, id) 的名次；不存在时返回 npos
+    size_t rank(const Key& key, uint32_t id) const {
+        size_t before = 0;
+        int node = root_;
+        while (node != -1) {
+            const Node& current = nodes_[node];
+            if (matches(current, key, id)) {
+                return before + sizeOf(current.left);
+            }
+            if (less(key, id, current)) {
+                node = current.left;
+            } else {
+                before += sizeOf(current.left) + 1;
+                node = current.right;
+            }
+        }
+        return npos;
+    }
+
+    // 排在 (key, id) 之前的元素个数（(key, id) 不必存在）；
+    // 以 id 0 查询即得到键为 key 的第一个元素的位置
+    size_t lowerBound(const Key& key, uint32_t id) const {
+        size_t before = 0;
+        int node = root_;
+        while (node != -1) {
+            const Node& current = nodes_[node];
+            if (matches(current, key, id) || less(key, id, current)) {
+                node = current.left;
+            } else {
+                before += sizeOf(current.left) + 1;
+                node = current.right;
+            }
+        }
+        return before;
+    }
+
+    // 按顺序取出 [offset, offset + count) 范围内的 id
+    std::vector<uint32_t> range(size_t offset, size_t count) const {
+        std::vector<uint32_t> ids;
+        if (offset >= size()) {
+            return ids;
+        }
+        count = std::min(count, size() - offset);
+        ids.reserve(count);
+
+        // 先下降到第 offset 个节点，途中记录尚未访问的祖先，再做中序遍历
+        std::vector<int> stack;
+        int node = root_;
+        while (node != -1) {
+            size_t leftSize = sizeOf(nodes_[node].left);
+            if (offset < leftSize) {
+                stack.push_back(node);
+                node = nodes_[node].left;
+            } else if (offset == leftSize) {
+                stack.push_back(node);
+                break;
+            } else {
+                offset -= leftSize + 1;
+                node = nodes_[node].right;
+            }
+        }
+
+        while (!stack.empty() && ids.size() < count) {
+            int current = stack.back();
+            stack.pop_back();
+            ids.push_back(nodes_[current].id);
+            for (int next = nodes_[current].right; next != -1; next = nodes_[next].left) {
+                stack.push_back(next);
+            }
+        }
+        return ids;
+    }
+
+private:
+    struct Node {
+        Key key;
+        uint32_t id;
+        uint32_t priority;
+        uint32_t size;
+        int left;
+        int right;
+    };
+
+    std::vector<Node> nodes_;
+    int root_ = -1;
+    int freeList_ = -1;          // 已删除节点复用链（借用 left 字段）
+    uint32_t seed_ = 0x9E3779B9u;
+
+    uint32_t nextPriority() {
+        // xorshift32：确定性的伪随机优先级，保证期望 O(log n) 深度
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    int allocate(const Key& key, uint32_t id) {
+        Node node{key, id, nextPriority(), 1, -1, -1};
+        if (freeList_ != -1) {
+            int index = freeList_;
+            freeList_ = nodes_[index].left;
+            nodes_[index] = std::move(node);
+            return index;
+        }
+        nodes_.push_back(std::move(node));
+        return static_cast<int>(nodes_.size()) - 1;
+    }
+
+    size_t sizeOf(int node) const { return node == -1 ? 0 : nodes_[node].size; }
+
+    void update(int node) {
+        nodes_[node].size = static_cast<uint32_t>(1 + sizeOf(nodes_[node].left) + sizeOf(nodes_[node].right));
+    }
+
+    // (key, id) 是否排在 node 之前
+    bool less(const Key& key, uint32_t id, const Node& node) const {
+        if (compare_(key, node.key)) {
+            return true;
+        }
+        if (compare_(node.key, key)) {
+            return false;
+        }
+        return id < node.id;
+    }
+
+    bool matches(const Node& node, const Key& key, uint32_t id) const {
+        return node.id == id && !compare_(key, node.key) && !compare_(node.key, key);
+    }
+
+    // 按 (key, id) 拆分：left 为所有排在其前的节点
+    void split(int node, const Key& key, uint32_t id, int& left, int& right) {
+        if (node == -1) {
+            left = right = -1;
+            return;
+        }
+        if (less(key, id, nodes_[node])) {
+            split(nodes_[node].left, key, id, left, nodes_[node].left);
+            right = node;
+        } else {
+            split(nodes_[node].right, key, id, nodes_[node].right, right);
+            left = node;
+        }
+        update(node);
+    }
+
+    int merge(int left, int right) {
+        if (left == -1) return right;
+        if (right == -1) return left;
+        if (nodes_[left].priority > nodes_[right].priority) {
+            nodes_[left].right = merge(nodes_[left].right, right);
+            update(left);
+            return left;
+        }
+        nodes_[right].left = merge(left, nodes_[right].left);
+        update(right);
+        return right;
+    }
+
+    Compare compare_;
+};
@@ -0,0 +1,25 @@
+// =============================================
+// 文件: state_version.h
+// 描述: 状态版本号，用于判断可存档的状态自上次保存以来是否被修改。
+// 说明: 所有对象共用一个单调递增的时钟，对象被修改时记下新的时刻。
+//       组合对象（玩家 = 自身字段 + 背包 + 队伍成员）的版本取各部分的最大值：
+//       任一部分被修改都会使其严格增大，替换子对象也不会让版本回到某个旧值，
+//       因此只需比较两次取到的版本是否相等。
+// =============================================
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+class StateVersion {
+public:
+    uint64_t get() const { return stamp_; }
+    void bump() { stamp_ = clock().fetch_add(1, std::memory_order_relaxed) + 1; }
+
+private:
+    static std::atomic<uint64_t>& clock() {
+        static std::atomic<uint64_t> instance{0};
+        return instance;
+    }
+
+    uint64_t stamp_ = 0;
+};
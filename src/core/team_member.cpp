@@ -22,6 +22,7 @@ bool TeamMember::equipWeapon(std::shared_ptr<Weapon> weapon) {
     }
 
     equippedWeapon_ = weapon;
+    version_.bump();
     return true;
 }
 
@@ -31,15 +32,18 @@ bool TeamMember::equipArtifact(std::shared_ptr<Artifact> artifact) {
     }
 
     equippedArtifact_ = artifact;
+    version_.bump();
     return true;
 }
 
 void TeamMember::unequipWeapon() {
     equippedWeapon_ = nullptr;
+    version_.bump();
 }
 
 void TeamMember::unequipArtifact() {
     equippedArtifact_ = nullptr;
+    version_.bump();
 }
 
 int TeamMember::getTotalHealth() const {
@@ -91,6 +95,7 @@ int TeamMember::getTotalDefense() const {
 
 void TeamMember::setCurrentHealth(int health) {
     currentHealth_ = std::max(0, std::min(health, getTotalHealth()));
+    version_.bump();
 }
 
 void TeamMember::takeDamage(int damage) {
@@ -99,8 +104,10 @@ void TeamMember::takeDamage(int damage) {
     if (currentHealth_ < 0) {
         currentHealth_ = 0;
     }
+    version_.bump();
 }
 
 void TeamMember::heal(int amount) {
     currentHealth_ = std::min(getTotalHealth(), currentHealth_ + amount);
+    version_.bump();
 }
@@ -4,6 +4,7 @@
 // =============================================
 #pragma once
 #include "item.h"
+#include "state_version.h"
 #include <string>
 #include <memory>
 
@@ -22,11 +23,11 @@ public:
     // 基本属性
     std::string getName() const { return name_; }
     int getLevel() const { return level_; }
-    void setLevel(int level) { level_ = level; }
+    void setLevel(int level) { level_ = level; version_.bump(); }
     
     // 队伍状态管理
     MemberStatus getStatus() const { return status_; }
-    void setStatus(MemberStatus status) { status_ = status; }
+    void setStatus(MemberStatus status) { status_ = status; version_.bump(); }
     bool isActive() const { return status_ == MemberStatus::ACTIVE; }
     bool canBeActive() const { return status_ != MemberStatus::INJURED || getCurrentHealth() > 0; }
 
@@ -55,7 +56,10 @@ public:
     void takeDamage(int damage);
     void heal(int amount);
     bool isAlive() const { return currentHealth_ > 0; }
-    void resetHealth() { currentHealth_ = getTotalHealth(); }
+    void resetHealth() { currentHealth_ = getTotalHealth(); version_.bump(); }
+
+    // 状态版本：任一属性、状态或装备变化时增大（见 state_version.h）
+    uint64_t getVersion() const { return version_.get(); }
 
 private:
     std::string name_;
@@ -71,4 +75,6 @@ private:
     // 装备
     std::shared_ptr<Weapon> equippedWeapon_;
     std::shared_ptr<Artifact> equippedArtifact_;
+
+    StateVersion version_;
 };
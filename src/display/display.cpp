@@ -24,11 +24,50 @@
 
 using namespace ftxui;
 
+namespace {
+
+// 根组件：只挂载当前屏幕的组件，渲染与事件都交给它。
+// 屏幕可能重建自己的组件（如游戏界面重建底部按钮），每次渲染、派发事件前按当前屏幕重新挂载；
+// 事件派发前挂载不会替换正在处理事件的组件
+class ScreenSwitcher : public ComponentBase {
+public:
+    explicit ScreenSwitcher(std::function<Component()> current) : current_(std::move(current)) {}
+
+    Element OnRender() override {
+        Sync();
+        return ComponentBase::OnRender();
+    }
+
+    bool OnEvent(Event event) override {
+        Sync();
+        return ComponentBase::OnEvent(event);
+    }
+
+private:
+    void Sync() {
+        Component current = current_();
+        if (ChildCount() == 1 && ChildAt(0) == current) {
+            return;
+        }
+        DetachAllChildren();
+        if (current) {
+            Add(current);
+        }
+    }
+
+    std::function<Component()> current_;
+};
+
+} // namespace
+
 ScreenManager::ScreenManager()
     : screen_(nullptr), // 初始化为 nullptr
-      currentScreen_("MainMenu"),
-      nextScreen_("")
+      currentScreen_("MainMenu")
 {
+    // 启动时在后台扫描存档目录，打开存档界面时直接读取内存中的目录
+    game_.startSaveCatalog([this] { NotifySaveCatalogChanged(); },
+                           [this](const std::string& message) { NotifySaveCatalogError(message); });
+
     // 创建导航回调
     auto nav_callback = [this](const NavigationRequest &request) {
         this->HandleNavigationRequest(request);
@@ -74,15 +113,36 @@ ScreenManager::ScreenManager()
     screens_["SaveSave"] = new SaveSelectScreen(&game_, SaveSelectMode::SAVE);
     screens_["SaveSave"]->SetNavigationCallback(nav_callback);
 
-    // 创建第一个屏幕实例
+    // 创建屏幕实例与根组件；之后切换屏幕只改变根组件挂载的内容
     CreateNewScreen();
+    root_ = CreateMainContainer();
+
+    // 后台保存完成后回到 UI 线程派发回调
+    game_.setSaveNotifier([this] { NotifySaveCompleted(); });
+    // 保存结果显示在游戏界面的消息栏
+    game_.setStatusHandler([this](const std::string& message) { ShowGameStatus(message); });
+
+    autosaveTimer_ = std::thread([this] { AutosaveTimerLoop(); });
 }
 
 ScreenManager::~ScreenManager() {
+    game_.setSaveNotifier(nullptr);
+    game_.setStatusHandler(nullptr);
+    game_.stopSaveCatalog();
+    {
+        std::lock_guard<std::mutex> lock(autosaveTimerMutex_);
+        autosaveTimerStop_ = true;
+    }
+    autosaveTimerWake_.notify_all();
+    autosaveTimer_.join();
+
     // 删除屏幕实例与所有屏幕组件
-    if (screen_) {
-        delete screen_;
-        screen_ = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(screenMutex_);
+        if (screen_) {
+            delete screen_;
+            screen_ = nullptr;
+        }
     }
     
     // 删除所有屏幕组件
@@ -102,22 +162,13 @@ void ScreenManager::HandleNavigationRequest(const NavigationRequest& request) {
                     settingsScreen->SetSourceScreen(currentScreen_);
                 }
             }
-            nextScreen_ = request.target_screen;
-            shouldSwitchScreen_ = true;
-            // 退出当前Loop，让mainloop能够处理屏幕切换
-            if (screen_) {
-                screen_->Exit();
-            }
+            RequestScreenSwitch(request.target_screen);
             break;
         case NavigationAction::START_NEW_GAME:
             StartNewGame();
             break;
         case NavigationAction::LOAD_GAME:
-            nextScreen_ = "SaveLoad";
-            shouldSwitchScreen_ = true;
-            if (screen_) {
-                screen_->Exit();
-            }
+            RequestScreenSwitch("SaveLoad");
             break;
         case NavigationAction::SAVE_GAME: {
             // 设置保存存档页面的来源界面
@@ -125,15 +176,11 @@ void ScreenManager::HandleNavigationRequest(const NavigationRequest& request) {
             if (saveScreen) {
                 saveScreen->SetSourceScreen(currentScreen_);
             }
-            nextScreen_ = "SaveSave";
-            shouldSwitchScreen_ = true;
-            if (screen_) {
-                screen_->Exit();
-            }
+            RequestScreenSwitch("SaveSave");
             break;
         }
         case NavigationAction::QUIT_GAME:
-            shouldQuit_ = true;
+            // 唯一结束主循环的途径
             if (screen_) {
                 screen_->Exit();
             }
@@ -141,6 +188,15 @@ void ScreenManager::HandleNavigationRequest(const NavigationRequest& request) {
     }
 }
 
+void ScreenManager::RequestScreenSwitch(const std::string& screenName) {
+    // 导航请求来自当前屏幕的事件处理，切换（可能重建该屏幕的组件）推迟到事件处理结束后
+    if (screen_) {
+        screen_->Post([this, screenName] { SwitchToScreen(screenName); });
+        // 闭包任务不会触发重绘，补一个事件刷新界面
+        screen_->PostEvent(Event::Custom);
+    }
+}
+
 void ScreenManager::SwitchToScreen(const std::string& screenName) {
     // 检查目标屏幕是否存在
     if (screens_.count(screenName) == 0) {
@@ -149,22 +205,28 @@ void ScreenManager::SwitchToScreen(const std::string& screenName) {
             std::cerr << "'" << pair.first << "' ";
         }
         std::cerr << std::endl;
+        // 诊断写在了界面上，下一帧整屏重画
+        if (screen_) {
+            screen_->InvalidateFrame();
+        }
         return; // 不进行切换，保持当前屏幕
     }
     
-    // 删除旧的屏幕实例
-    if (screen_) {
-        // 先退出当前屏幕，确保所有任务都被清理
-        screen_->Exit();
-        
-        // 再次确保退出状态
-        screen_->Exit();
-        
-        delete screen_;
+    // 离开游戏界面时自动保存（日志存档，只追加改动）
+    if (currentScreen_ == "Gameplay" && screenName != "Gameplay" &&
+        game_.getCurrentState() == GameState::PLAYING) {
+        SaveGame();
+    }
+    
+    // 离开设置界面时应用存档存放方式（可能需要迁移存档）
+    if (currentScreen_ == "Settings" && screenName != "Settings") {
+        game_.ApplySaveSettings();
     }
     
     // 更新当前屏幕名称
     currentScreen_ = screenName;
+    // 没有目录通知的平台只在存档界面显示期间比对存档目录
+    game_.setSaveCatalogVisible(screenName == "SaveLoad" || screenName == "SaveSave");
     
     // 如果切换到地图界面，更新地图数据
     if (screenName == "Map" && screens_.count("Map")) {
@@ -217,14 +279,19 @@ void ScreenManager::SwitchToScreen(const std::string& screenName) {
             saveScreen->RefreshSaveList();
         }
     }
-    
-    // 创建新的屏幕实例
-    screen_ = new ScreenInteractive(ScreenInteractive::Fullscreen());
-    screen_->TrackMouse(true);
+    // 根组件在下一次渲染时挂载新屏幕的组件，终端模式与备用屏幕保持不变
+}
+
+ftxui::Component ScreenManager::CreateMainContainer() {
+    return Make<ScreenSwitcher>([this]() -> Component {
+        auto it = screens_.find(currentScreen_);
+        return it != screens_.end() ? it->second->GetComponent() : nullptr;
+    });
 }
 
 void ScreenManager::CreateNewScreen() {
     // 删除旧的屏幕实例
+    std::lock_guard<std::mutex> lock(screenMutex_);
     if (screen_) {
         delete screen_;
     }
@@ -235,20 +302,12 @@ void ScreenManager::CreateNewScreen() {
 }
 
 void ScreenManager::mainloop() {
-    while (!shouldQuit_) {
-        if (screens_.count(currentScreen_) && screen_) {
-            screen_->Loop(screens_[currentScreen_]->GetComponent());
-            
-            // 检查是否需要切换屏幕
-            if (shouldSwitchScreen_) {
-                shouldSwitchScreen_ = false;
-                SwitchToScreen(nextScreen_);
-            }
-        } else {
-            std::cerr << "Error: Screen '" << currentScreen_ << "' not found!" << std::endl;
-            break;
-        }
+    if (!screens_.count(currentScreen_) || !screen_) {
+        std::cerr << "Error: Screen '" << currentScreen_ << "' not found!" << std::endl;
+        return;
     }
+    // 只进入一次循环：切换屏幕在循环内完成，退出游戏时结束
+    screen_->Loop(root_);
 }
 
 void ScreenManager::StartNewGame() {
@@ -263,11 +322,7 @@ void ScreenManager::StartNewGame() {
     }
     
     // 切换到游戏界面
-    nextScreen_ = "Gameplay";
-    shouldSwitchScreen_ = true;
-    if (screen_) {
-        screen_->Exit();
-    }
+    RequestScreenSwitch("Gameplay");
 }
 
 void ScreenManager::LoadGame() {
@@ -281,13 +336,61 @@ void ScreenManager::LoadGame() {
     
     game_.LoadGame();
     // 切换到游戏界面
-    nextScreen_ = "Gameplay";
-    shouldSwitchScreen_ = true;
-    if (screen_) {
-        screen_->Exit();
-    }
+    RequestScreenSwitch("Gameplay");
 }
 
 void ScreenManager::SaveGame() {
     game_.SaveGame();
-}
\ No newline at end of file
+}
+
+void ScreenManager::AutosaveTimerLoop() {
+    // 每秒检查一次：闭包任务不触发重绘，状态未变时也不会写盘
+    std::unique_lock<std::mutex> timerLock(autosaveTimerMutex_);
+    while (!autosaveTimerWake_.wait_for(timerLock, std::chrono::seconds(1), [this] { return autosaveTimerStop_; })) {
+        std::lock_guard<std::mutex> lock(screenMutex_);
+        if (screen_) {
+            screen_->Post([this] { game_.TickAutosave(); });
+        }
+    }
+}
+
+void ScreenManager::NotifySaveCompleted() {
+    std::lock_guard<std::mutex> lock(screenMutex_);
+    if (screen_) {
+        screen_->Post([this] { game_.dispatchSaveCompletions(); });
+        // 闭包任务不会触发重绘，补一个事件刷新界面
+        screen_->PostEvent(Event::Custom);
+    }
+}
+
+void ScreenManager::NotifySaveCatalogChanged() {
+    std::lock_guard<std::mutex> lock(screenMutex_);
+    if (screen_) {
+        // 存档界面正在显示时就地刷新列表（包括其他程序对 saves/ 的改动）；其他界面不需要重画
+        screen_->Post([this] {
+            if (currentScreen_ == "SaveLoad" || currentScreen_ == "SaveSave") {
+                SaveSelectScreen* saveScreen = dynamic_cast<SaveSelectScreen*>(screens_[currentScreen_]);
+                if (saveScreen) {
+                    saveScreen->RefreshSaveList();
+                    // 闭包任务不会触发重绘，补一个事件刷新界面
+                    screen_->PostEvent(Event::Custom);
+                }
+            }
+        });
+    }
+}
+
+void ScreenManager::NotifySaveCatalogError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(screenMutex_);
+    if (screen_) {
+        screen_->Post([this, message] { ShowGameStatus(message); });
+        screen_->PostEvent(Event::Custom);
+    }
+}
+
+void ScreenManager::ShowGameStatus(const std::string& message) {
+    GameplayScreen* gameplayScreen = dynamic_cast<GameplayScreen*>(screens_["Gameplay"]);
+    if (gameplayScreen) {
+        gameplayScreen->UpdateGameStatus(message);
+    }
+}
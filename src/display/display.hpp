@@ -11,6 +11,9 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include "../core/game.h"
 
 // 导航请求的类型枚举：用于驱动屏幕切换或游戏动作
@@ -61,21 +64,33 @@ public:
 private:
     // 处理来自屏幕的导航请求
     void HandleNavigationRequest(const NavigationRequest& request);
-    ftxui::Component CreateMainContainer();
-    void CreateNewScreen(); // 创建新的屏幕实例
-    void SwitchToScreen(const std::string& screenName); // 切换到指定屏幕
+    ftxui::Component CreateMainContainer(); // 根组件：始终挂载当前屏幕的组件
+    void CreateNewScreen(); // 创建屏幕实例（整个程序只创建一次）
+    void RequestScreenSwitch(const std::string& screenName); // 在当前事件处理完后切换屏幕
+    void SwitchToScreen(const std::string& screenName); // 切换到指定屏幕（在 UI 线程的任务中调用）
     
     // 游戏状态管理方法（委托给 Game 类）
     void StartNewGame(); // 开始新游戏
     void LoadGame();     // 加载游戏
     void SaveGame();     // 保存游戏
 
-    ftxui::ScreenInteractive* screen_; // 当前屏幕实例指针（由本类负责生命周期）
+    void NotifySaveCompleted(); // 后台保存完成：唤醒 UI 线程派发回调（在写入线程调用）
+    void NotifySaveCatalogChanged(); // 存档目录变化：在 UI 线程刷新存档界面（在目录线程调用）
+    void NotifySaveCatalogError(const std::string& message); // 目录扫描出错：在 UI 线程显示（在目录线程调用）
+    void ShowGameStatus(const std::string& message); // 在游戏界面的消息栏显示提示
+    void AutosaveTimerLoop();   // 定时向 UI 线程投递自动保存检查（在计时线程运行）
+
+    ftxui::ScreenInteractive* screen_; // 屏幕实例指针（由本类负责生命周期，切换屏幕时不重建）
+    std::mutex screenMutex_;           // 保护 screen_ 的销毁，后台线程会向其投递任务
+    ftxui::Component root_;            // 交给 screen_ 循环的根组件
     std::map<std::string, BaseScreen*> screens_; // 名称到屏幕对象的映射
     std::string currentScreen_; // 当前屏幕名称
-    std::string nextScreen_;    // 下一个要切换到的屏幕
-    bool shouldQuit_ = false;   // 是否退出主循环
-    bool shouldSwitchScreen_ = false; // 是否需要切换屏幕
+
+    // 自动保存计时线程：只投递检查任务，是否写盘由 Game 按状态版本决定
+    std::thread autosaveTimer_;
+    std::mutex autosaveTimerMutex_;
+    std::condition_variable autosaveTimerWake_;
+    bool autosaveTimerStop_ = false;
 
     Game game_; // 游戏对象（核心逻辑）
 };
@@ -55,185 +55,7 @@ GameplayScreen::GameplayScreen(Game* game) : game_(game) {
 
     // 中部：左“游戏消息”/右“游戏状态（详细）”
     auto main_renderer = ftxui::Renderer([this] {
-        auto dims = ftxui::Terminal::Size();
-        int header_h = 3;
-        int bottom_h = 3;
-        int main_h = std::max(5, dims.dimy - header_h - bottom_h);
-        int message_h = std::max(5, main_h * 6 / 10 - 1); // 为消息预留约 60% 的高度，减1行给队伍区域
-
-        // 左侧：地图显示 - 优化美观度
-        std::vector<ftxui::Element> left;
-        
-        // 地图标题 - 显示当前区块名称
-        std::string currentBlockName = "未知区域";
-        auto currentBlock = game_->getMapManager().getCurrentBlock();
-        if (currentBlock) {
-            currentBlockName = currentBlock->getName();
-            MaybeShowBlockStory(currentBlockName);
-        }
-        left.push_back(ftxui::text("[地图] " + currentBlockName) | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
-        left.push_back(ftxui::separator());
-        
-        // 地图内容 - 使用等宽字体和颜色，为交互元素添加精确的单位置高亮
-        std::vector<ftxui::Element> map_content;
-        for (const auto& line : current_map_lines_) {
-            // 检查是否为地图网格区域（包含边框字符的行，但不是图例或标题）
-            bool isMapGrid = (line.find("+") != std::string::npos || line.find("-") != std::string::npos || 
-                             line.find("|") != std::string::npos) && 
-                             line.find("=== 地图图例 ===") == std::string::npos && 
-                             line.find("P =") == std::string::npos && line.find("I =") == std::string::npos && 
-                             line.find("N =") == std::string::npos && line.find("S =") == std::string::npos && 
-                             line.find("M =") == std::string::npos && line.find("^v>< =") == std::string::npos && 
-                             line.find("# =") == std::string::npos && line.find(". =") == std::string::npos &&
-                             line.length() > 5; // 确保不是简短的标题行，但允许区块名称显示
-            
-            if (isMapGrid) {
-                // 地图网格区域 - 为每个字符位置单独应用样式
-                std::vector<ftxui::Element> styled_chars;
-                for (size_t i = 0; i < line.length(); ++i) {
-                    char c = line[i];
-                    ftxui::Element char_element = ftxui::text(std::string(1, c));
-                    
-                    // 根据字符类型应用不同的样式，确保良好的对比度和可读性
-                    if (c == '+' || c == '-' || c == '|') {
-                        // 边框字符 - 青色
-                        char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
-                    } else if (c == 'P') {
-                        // 玩家位置 - 白色文字配深蓝色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Blue) | ftxui::bold;
-                    } else if (c == 'I') {
-                        // 物品 - 白色文字配深绿色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Green) | ftxui::bold;
-                    } else if (c == 'N') {
-                        // NPC - 白色文字配深青色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Cyan) | ftxui::bold;
-                    } else if (c == 'S') {
-                        // 神像 - 黑色文字配黄色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::Black) | ftxui::bgcolor(ftxui::Color::Yellow) | ftxui::bold;
-                    } else if (c == 'M') {
-                        // 怪物 - 白色文字配红色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Red) | ftxui::bold;
-                    } else if (c == '^' || c == 'v' || c == '>' || c == '<') {
-                        // 出口 - 白色文字配紫色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Magenta) | ftxui::bold;
-                    } else if (c == '#') {
-                        // 墙壁 - 灰色
-                        char_element = char_element | ftxui::color(ftxui::Color::GrayLight) | ftxui::bold;
-                    } else if (c == '.') {
-                        // 空地 - 白色
-                        char_element = char_element | ftxui::color(ftxui::Color::White);
-                    } else {
-                        // 其他字符 - 青色
-                        char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
-                    }
-                    
-                    styled_chars.push_back(char_element);
-                }
-                
-                // 将样式化的字符组合成一行
-                auto styled_line = ftxui::hbox(styled_chars);
-                map_content.push_back(styled_line);
-            } else if (line.find("=== 地图图例 ===") != std::string::npos) {
-                // 图例标题 - 使用黄色
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Yellow) | ftxui::bold;
-                map_content.push_back(styled_line);
-            } else if (line.find("P =") != std::string::npos || line.find("I =") != std::string::npos || 
-                      line.find("N =") != std::string::npos || line.find("S =") != std::string::npos || 
-                      line.find("M =") != std::string::npos || line.find("^v>< =") != std::string::npos || 
-                      line.find("# =") != std::string::npos || line.find(". =") != std::string::npos) {
-                // 图例说明 - 使用普通颜色，不高亮
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::GrayLight);
-                map_content.push_back(styled_line);
-            } else {
-                // 其他内容 - 使用绿色
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Green);
-                map_content.push_back(styled_line);
-            }
-        }
-        
-        // 将地图内容放在一个带边框的容器中
-        auto map_box = ftxui::vbox(map_content) | ftxui::border | ftxui::color(ftxui::Color::Green);
-        left.push_back(map_box);
-        
-        // 区块信息 - 使用更美观的样式
-        if (!current_block_info_.empty()) {
-            left.push_back(ftxui::separator());
-            left.push_back(ftxui::text("[位置] 位置信息") | ftxui::bold | ftxui::color(ftxui::Color::Yellow));
-            left.push_back(ftxui::paragraph(current_block_info_) | ftxui::color(ftxui::Color::White));
-        }
-        
-        auto left_box = ftxui::vbox(left) | ftxui::border | ftxui::color(ftxui::Color::Blue);
-
-        // 右侧：游戏消息（固定高度视口） + 游戏状态（玩家/队伍） - 优化美观度
-        std::vector<ftxui::Element> right;
-        
-        // 游戏消息区域
-        right.push_back(ftxui::text("[消息] 游戏消息") | ftxui::bold | ftxui::color(ftxui::Color::Magenta));
-        right.push_back(ftxui::separator());
-        std::vector<ftxui::Element> msg_lines;
-        if (game_messages_.empty()) {
-            msg_lines.push_back(ftxui::text("暂无消息") | ftxui::color(ftxui::Color::GrayLight));
-        } else {
-            // 为了保证新增消息在存在多行换行时也能立即可见，按时间倒序显示（最新在上）
-            for (auto it = game_messages_.rbegin(); it != game_messages_.rend(); ++it) {
-                const auto& m = *it;
-                // 为不同类型的消息添加不同颜色
-                auto styled_msg = ftxui::paragraph(m);
-                if (m.find("胜利") != std::string::npos || m.find("成功") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Green);
-                } else if (m.find("失败") != std::string::npos || m.find("错误") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Red);
-                } else if (m.find("获得") != std::string::npos || m.find("奖励") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Yellow);
-                } else {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::White);
-                }
-                msg_lines.push_back(styled_msg);
-            }
-        }
-        auto messages_view = ftxui::vbox(msg_lines) | ftxui::vscroll_indicator | ftxui::yframe |
-                             ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, message_h);
-        right.push_back(messages_view);
-        
-        // 游戏状态区域
-        right.push_back(ftxui::separator());
-        right.push_back(ftxui::text("[状态] 游戏状态") | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
-        right.push_back(ftxui::separator());
-        
-        // 玩家信息 - 使用更美观的显示
-        auto activeMember = game_->getPlayer().getActiveMember();
-        std::string activeName = activeMember ? activeMember->getName() : "无";
-        right.push_back(ftxui::paragraph("上场角色: " + activeName) | ftxui::color(ftxui::Color::White));
-        right.push_back(ftxui::paragraph("等级: Lv." + std::to_string(player_level_)) | ftxui::color(ftxui::Color::Yellow));
-        
-        // HP显示 - 使用颜色表示血量状态
-        auto hp_color = (player_hp_ > player_max_hp_ * 0.5) ? ftxui::Color::Green : 
-                       (player_hp_ > player_max_hp_ * 0.25) ? ftxui::Color::Yellow : ftxui::Color::Red;
-        right.push_back(ftxui::paragraph("HP: " + std::to_string(player_hp_) + "/" + std::to_string(player_max_hp_)) | ftxui::color(hp_color));
-        right.push_back(ftxui::paragraph(player_status_) | ftxui::color(ftxui::Color::GrayLight));
-        
-        // 队伍成员区域
-        right.push_back(ftxui::separator());
-        right.push_back(ftxui::text("[队伍] 队伍成员") | ftxui::bold | ftxui::color(ftxui::Color::Blue));
-        right.push_back(ftxui::separator());
-        if (team_members_.empty()) {
-            right.push_back(ftxui::text("暂无队伍成员") | ftxui::color(ftxui::Color::GrayLight));
-        } else {
-            for (const auto& member : team_members_) {
-                // 为队伍成员添加颜色
-                right.push_back(ftxui::paragraph("* " + member) | ftxui::color(ftxui::Color::White));
-            }
-        }
-        
-        auto right_box = ftxui::vbox(right) | ftxui::border | ftxui::color(ftxui::Color::Magenta);
-
-        // 按 7:3 比例分配宽度，确保地图有足够空间显示完整边框
-        int left_w = std::max(30, dims.dimx * 5 / 10);  // 增加最小宽度到30，确保地图边框完整显示
-        int right_w = std::max(15, dims.dimx - left_w);  // 相应增加右侧最小宽度
-        auto left_sized = left_box | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, left_w);
-        auto right_sized = right_box | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, right_w);
-
-        return ftxui::hbox({ left_sized, right_sized }) | ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, main_h);
+        return RenderMainArea();
     });
 
     // 底部：游戏操作选项（按钮 + 提示）
@@ -310,6 +132,7 @@ void GameplayScreen::UpdatePlayerInfo(const Player& player) {
     std::stringstream ss;
     ss << "等级: " << player.level << " 经验: " << player.experience;
     player_status_ = ss.str();
+    status_view_version_.bump();
 }
 
 // 追加一条聊天消息（保留最多 20 条）
@@ -328,11 +151,13 @@ void GameplayScreen::UpdateGameStatus(const std::string& status) {
     if (game_messages_.size() > 20) {
         game_messages_.erase(game_messages_.begin());
     }
+    status_view_version_.bump();
 }
 
 // 替换队伍成员显示数据
 void GameplayScreen::UpdateTeamStatus(const std::vector<std::string>& teamMembers) {
     team_members_ = teamMembers;
+    status_view_version_.bump();
 }
 
 // 重新生成队伍成员信息（含 HP）并刷新右侧显示
@@ -358,10 +183,12 @@ void GameplayScreen::ClearAllMessages() {
     chat_messages_.clear();
     // 重置完成提示标记，便于新一轮游玩再次提示
     completion_announced_ = false;
+    status_view_version_.bump();
 }
 
 // 刷新地图显示与当前位置说明，必要时触发首次到访剧情提示
 void GameplayScreen::UpdateMapDisplay() {
+    map_view_version_.bump();
     if (!game_) {
         current_map_lines_ = {"Map not available"};
         current_block_info_ = "Game not initialized";
@@ -396,6 +223,206 @@ void GameplayScreen::UpdateMapDisplay() {
     }
 }
 
+// 中部：左侧地图、右侧消息与状态。两侧面板分别缓存，所显示数据的版本或终端尺寸
+// 变化时才重建 Element 树，空闲帧（光标闪烁、鼠标移动等）直接复用上次的结果
+ftxui::Element GameplayScreen::RenderMainArea() {
+    auto dims = ftxui::Terminal::Size();
+    int header_h = 3;
+    int bottom_h = 3;
+    int main_h = std::max(5, dims.dimy - header_h - bottom_h);
+    int message_h = std::max(5, main_h * 6 / 10 - 1); // 为消息预留约 60% 的高度，减1行给队伍区域
+
+    // 按 7:3 比例分配宽度，确保地图有足够空间显示完整边框
+    int left_w = std::max(30, dims.dimx * 5 / 10);  // 增加最小宽度到30，确保地图边框完整显示
+    int right_w = std::max(15, dims.dimx - left_w);  // 相应增加右侧最小宽度
+
+    // 先构建左侧：首次进入区块时的剧情提示会追加消息，右侧在同一帧内随之重建
+    if (!map_panel_.Matches(map_view_version_.get(), left_w, main_h)) {
+        map_panel_.Store(map_view_version_.get(), left_w, main_h,
+                         BuildMapPanel() | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, left_w));
+    }
+    // 上场角色直接取自玩家对象，玩家状态的版本一并计入（两者共用同一时钟，取最大值即可）
+    uint64_t status_version = std::max(status_view_version_.get(), game_->getPlayer().getStateVersion());
+    if (!status_panel_.Matches(status_version, right_w, main_h)) {
+        status_panel_.Store(status_version, right_w, main_h,
+                            BuildStatusPanel(message_h) | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, right_w));
+    }
+
+    return ftxui::hbox({ map_panel_.element, status_panel_.element }) | ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, main_h);
+}
+
+// 构建左侧地图面板（区块名、地图网格与位置信息）
+ftxui::Element GameplayScreen::BuildMapPanel() {
+    std::vector<ftxui::Element> left;
+    
+    // 地图标题 - 显示当前区块名称
+    std::string currentBlockName = "未知区域";
+    auto currentBlock = game_->getMapManager().getCurrentBlock();
+    if (currentBlock) {
+        currentBlockName = currentBlock->getName();
+        MaybeShowBlockStory(currentBlockName);
+    }
+    left.push_back(ftxui::text("[地图] " + currentBlockName) | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
+    left.push_back(ftxui::separator());
+    
+    // 地图内容 - 使用等宽字体和颜色，为交互元素添加精确的单位置高亮
+    std::vector<ftxui::Element> map_content;
+    for (const auto& line : current_map_lines_) {
+        // 检查是否为地图网格区域（包含边框字符的行，但不是图例或标题）
+        bool isMapGrid = (line.find("+") != std::string::npos || line.find("-") != std::string::npos || 
+                         line.find("|") != std::string::npos) && 
+                         line.find("=== 地图图例 ===") == std::string::npos && 
+                         line.find("P =") == std::string::npos && line.find("I =") == std::string::npos && 
+                         line.find("N =") == std::string::npos && line.find("S =") == std::string::npos && 
+                         line.find("M =") == std::string::npos && line.find("^v>< =") == std::string::npos && 
+                         line.find("# =") == std::string::npos && line.find(". =") == std::string::npos &&
+                         line.length() > 5; // 确保不是简短的标题行，但允许区块名称显示
+        
+        if (isMapGrid) {
+            // 地图网格区域 - 为每个字符位置单独应用样式
+            std::vector<ftxui::Element> styled_chars;
+            for (size_t i = 0; i < line.length(); ++i) {
+                char c = line[i];
+                ftxui::Element char_element = ftxui::text(std::string(1, c));
+                
+                // 根据字符类型应用不同的样式，确保良好的对比度和可读性
+                if (c == '+' || c == '-' || c == '|') {
+                    // 边框字符 - 青色
+                    char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
+                } else if (c == 'P') {
+                    // 玩家位置 - 白色文字配深蓝色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Blue) | ftxui::bold;
+                } else if (c == 'I') {
+                    // 物品 - 白色文字配深绿色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Green) | ftxui::bold;
+                } else if (c == 'N') {
+                    // NPC - 白色文字配深青色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Cyan) | ftxui::bold;
+                } else if (c == 'S') {
+                    // 神像 - 黑色文字配黄色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::Black) | ftxui::bgcolor(ftxui::Color::Yellow) | ftxui::bold;
+                } else if (c == 'M') {
+                    // 怪物 - 白色文字配红色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Red) | ftxui::bold;
+                } else if (c == '^' || c == 'v' || c == '>' || c == '<') {
+                    // 出口 - 白色文字配紫色背景
+                    char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Magenta) | ftxui::bold;
+                } else if (c == '#') {
+                    // 墙壁 - 灰色
+                    char_element = char_element | ftxui::color(ftxui::Color::GrayLight) | ftxui::bold;
+                } else if (c == '.') {
+                    // 空地 - 白色
+                    char_element = char_element | ftxui::color(ftxui::Color::White);
+                } else {
+                    // 其他字符 - 青色
+                    char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
+                }
+                
+                styled_chars.push_back(char_element);
+            }
+            
+            // 将样式化的字符组合成一行
+            auto styled_line = ftxui::hbox(styled_chars);
+            map_content.push_back(styled_line);
+        } else if (line.find("=== 地图图例 ===") != std::string::npos) {
+            // 图例标题 - 使用黄色
+            auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Yellow) | ftxui::bold;
+            map_content.push_back(styled_line);
+        } else if (line.find("P =") != std::string::npos || line.find("I =") != std::string::npos || 
+                  line.find("N =") != std::string::npos || line.find("S =") != std::string::npos || 
+                  line.find("M =") != std::string::npos || line.find("^v>< =") != std::string::npos || 
+                  line.find("# =") != std::string::npos || line.find(". =") != std::string::npos) {
+            // 图例说明 - 使用普通颜色，不高亮
+            auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::GrayLight);
+            map_content.push_back(styled_line);
+        } else {
+            // 其他内容 - 使用绿色
+            auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Green);
+            map_content.push_back(styled_line);
+        }
+    }
+    
+    // 将地图内容放在一个带边框的容器中
+    auto map_box = ftxui::vbox(map_content) | ftxui::border | ftxui::color(ftxui::Color::Green);
+    left.push_back(map_box);
+    
+    // 区块信息 - 使用更美观的样式
+    if (!current_block_info_.empty()) {
+        left.push_back(ftxui::separator());
+        left.push_back(ftxui::text("[位置] 位置信息") | ftxui::bold | ftxui::color(ftxui::Color::Yellow));
+        left.push_back(ftxui::paragraph(current_block_info_) | ftxui::color(ftxui::Color::White));
+    }
+    
+    auto left_box = ftxui::vbox(left) | ftxui::border | ftxui::color(ftxui::Color::Blue);
+    return left_box;
+}
+
+// 构建右侧面板：游戏消息（固定高度视口） + 游戏状态（玩家/队伍）
+ftxui::Element GameplayScreen::BuildStatusPanel(int message_h) {
+    std::vector<ftxui::Element> right;
+    
+    // 游戏消息区域
+    right.push_back(ftxui::text("[消息] 游戏消息") | ftxui::bold | ftxui::color(ftxui::Color::Magenta));
+    right.push_back(ftxui::separator());
+    std::vector<ftxui::Element> msg_lines;
+    if (game_messages_.empty()) {
+        msg_lines.push_back(ftxui::text("暂无消息") | ftxui::color(ftxui::Color::GrayLight));
+    } else {
+        // 为了保证新增消息在存在多行换行时也能立即可见，按时间倒序显示（最新在上）
+        for (auto it = game_messages_.rbegin(); it != game_messages_.rend(); ++it) {
+            const auto& m = *it;
+            // 为不同类型的消息添加不同颜色
+            auto styled_msg = ftxui::paragraph(m);
+            if (m.find("胜利") != std::string::npos || m.find("成功") != std::string::npos) {
+                styled_msg = styled_msg | ftxui::color(ftxui::Color::Green);
+            } else if (m.find("失败") != std::string::npos || m.find("错误") != std::string::npos) {
+                styled_msg = styled_msg | ftxui::color(ftxui::Color::Red);
+            } else if (m.find("获得") != std::string::npos || m.find("奖励") != std::string::npos) {
+                styled_msg = styled_msg | ftxui::color(ftxui::Color::Yellow);
+            } else {
+                styled_msg = styled_msg | ftxui::color(ftxui::Color::White);
+            }
+            msg_lines.push_back(styled_msg);
+        }
+    }
+    auto messages_view = ftxui::vbox(msg_lines) | ftxui::vscroll_indicator | ftxui::yframe |
+                         ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, message_h);
+    right.push_back(messages_view);
+    
+    // 游戏状态区域
+    right.push_back(ftxui::separator());
+    right.push_back(ftxui::text("[状态] 游戏状态") | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
+    right.push_back(ftxui::separator());
+    
+    // 玩家信息 - 使用更美观的显示
+    auto activeMember = game_->getPlayer().getActiveMember();
+    std::string activeName = activeMember ? activeMember->getName() : "无";
+    right.push_back(ftxui::paragraph("上场角色: " + activeName) | ftxui::color(ftxui::Color::White));
+    right.push_back(ftxui::paragraph("等级: Lv." + std::to_string(player_level_)) | ftxui::color(ftxui::Color::Yellow));
+    
+    // HP显示 - 使用颜色表示血量状态
+    auto hp_color = (player_hp_ > player_max_hp_ * 0.5) ? ftxui::Color::Green : 
+                   (player_hp_ > player_max_hp_ * 0.25) ? ftxui::Color::Yellow : ftxui::Color::Red;
+    right.push_back(ftxui::paragraph("HP: " + std::to_string(player_hp_) + "/" + std::to_string(player_max_hp_)) | ftxui::color(hp_color));
+    right.push_back(ftxui::paragraph(player_status_) | ftxui::color(ftxui::Color::GrayLight));
+    
+    // 队伍成员区域
+    right.push_back(ftxui::separator());
+    right.push_back(ftxui::text("[队伍] 队伍成员") | ftxui::bold | ftxui::color(ftxui::Color::Blue));
+    right.push_back(ftxui::separator());
+    if (team_members_.empty()) {
+        right.push_back(ftxui::text("暂无队伍成员") | ftxui::color(ftxui::Color::GrayLight));
+    } else {
+        for (const auto& member : team_members_) {
+            // 为队伍成员添加颜色
+            right.push_back(ftxui::paragraph("* " + member) | ftxui::color(ftxui::Color::White));
+        }
+    }
+    
+    auto right_box = ftxui::vbox(right) | ftxui::border | ftxui::color(ftxui::Color::Magenta);
+    return right_box;
+}
+
 
 // 处理核心游戏指令：移动/切换队友/交互等
 void GameplayScreen::HandleGameCommand(const std::string& command) {
@@ -629,185 +656,7 @@ void GameplayScreen::RebuildBottomButtons() {
 
     // 中部：左"游戏消息"/右"游戏状态（详细）"
     auto main_renderer = ftxui::Renderer([this] {
-        auto dims = ftxui::Terminal::Size();
-        int header_h = 3;
-        int bottom_h = 3;
-        int main_h = std::max(5, dims.dimy - header_h - bottom_h);
-        int message_h = std::max(5, main_h * 6 / 10 - 1); // 为消息预留约 60% 的高度，减1行给队伍区域
-
-        // 左侧：地图显示 - 优化美观度
-        std::vector<ftxui::Element> left;
-        
-        // 地图标题 - 显示当前区块名称
-        std::string currentBlockName = "未知区域";
-        auto currentBlock = game_->getMapManager().getCurrentBlock();
-        if (currentBlock) {
-            currentBlockName = currentBlock->getName();
-            MaybeShowBlockStory(currentBlockName);
-        }
-        left.push_back(ftxui::text("[地图] " + currentBlockName) | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
-        left.push_back(ftxui::separator());
-        
-        // 地图内容 - 使用等宽字体和颜色，为交互元素添加精确的单位置高亮
-        std::vector<ftxui::Element> map_content;
-        for (const auto& line : current_map_lines_) {
-            // 检查是否为地图网格区域（包含边框字符的行，但不是图例或标题）
-            bool isMapGrid = (line.find("+") != std::string::npos || line.find("-") != std::string::npos || 
-                             line.find("|") != std::string::npos) && 
-                             line.find("=== 地图图例 ===") == std::string::npos && 
-                             line.find("P =") == std::string::npos && line.find("I =") == std::string::npos && 
-                             line.find("N =") == std::string::npos && line.find("S =") == std::string::npos && 
-                             line.find("M =") == std::string::npos && line.find("^v>< =") == std::string::npos && 
-                             line.find("# =") == std::string::npos && line.find(". =") == std::string::npos &&
-                             line.length() > 5; // 确保不是简短的标题行，但允许区块名称显示
-            
-            if (isMapGrid) {
-                // 地图网格区域 - 为每个字符位置单独应用样式
-                std::vector<ftxui::Element> styled_chars;
-                for (size_t i = 0; i < line.length(); ++i) {
-                    char c = line[i];
-                    ftxui::Element char_element = ftxui::text(std::string(1, c));
-                    
-                    // 根据字符类型应用不同的样式，确保良好的对比度和可读性
-                    if (c == '+' || c == '-' || c == '|') {
-                        // 边框字符 - 青色
-                        char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
-                    } else if (c == 'P') {
-                        // 玩家位置 - 白色文字配深蓝色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Blue) | ftxui::bold;
-                    } else if (c == 'I') {
-                        // 物品 - 白色文字配深绿色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Green) | ftxui::bold;
-                    } else if (c == 'N') {
-                        // NPC - 白色文字配深青色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Cyan) | ftxui::bold;
-                    } else if (c == 'S') {
-                        // 神像 - 黑色文字配黄色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::Black) | ftxui::bgcolor(ftxui::Color::Yellow) | ftxui::bold;
-                    } else if (c == 'M') {
-                        // 怪物 - 白色文字配红色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Red) | ftxui::bold;
-                    } else if (c == '^' || c == 'v' || c == '>' || c == '<') {
-                        // 出口 - 白色文字配紫色背景
-                        char_element = char_element | ftxui::color(ftxui::Color::White) | ftxui::bgcolor(ftxui::Color::Magenta) | ftxui::bold;
-                    } else if (c == '#') {
-                        // 墙壁 - 灰色
-                        char_element = char_element | ftxui::color(ftxui::Color::GrayLight) | ftxui::bold;
-                    } else if (c == '.') {
-                        // 空地 - 白色
-                        char_element = char_element | ftxui::color(ftxui::Color::White);
-                    } else {
-                        // 其他字符 - 青色
-                        char_element = char_element | ftxui::color(ftxui::Color::Cyan) | ftxui::bold;
-                    }
-                    
-                    styled_chars.push_back(char_element);
-                }
-                
-                // 将样式化的字符组合成一行
-                auto styled_line = ftxui::hbox(styled_chars);
-                map_content.push_back(styled_line);
-            } else if (line.find("=== 地图图例 ===") != std::string::npos) {
-                // 图例标题 - 使用黄色
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Yellow) | ftxui::bold;
-                map_content.push_back(styled_line);
-            } else if (line.find("P =") != std::string::npos || line.find("I =") != std::string::npos || 
-                      line.find("N =") != std::string::npos || line.find("S =") != std::string::npos || 
-                      line.find("M =") != std::string::npos || line.find("^v>< =") != std::string::npos || 
-                      line.find("# =") != std::string::npos || line.find(". =") != std::string::npos) {
-                // 图例说明 - 使用普通颜色，不高亮
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::GrayLight);
-                map_content.push_back(styled_line);
-            } else {
-                // 其他内容 - 使用绿色
-                auto styled_line = ftxui::text(line) | ftxui::color(ftxui::Color::Green);
-                map_content.push_back(styled_line);
-            }
-        }
-        
-        // 将地图内容放在一个带边框的容器中
-        auto map_box = ftxui::vbox(map_content) | ftxui::border | ftxui::color(ftxui::Color::Green);
-        left.push_back(map_box);
-        
-        // 区块信息 - 使用更美观的样式
-        if (!current_block_info_.empty()) {
-            left.push_back(ftxui::separator());
-            left.push_back(ftxui::text("[位置] 位置信息") | ftxui::bold | ftxui::color(ftxui::Color::Yellow));
-            left.push_back(ftxui::paragraph(current_block_info_) | ftxui::color(ftxui::Color::White));
-        }
-        
-        auto left_box = ftxui::vbox(left) | ftxui::border | ftxui::color(ftxui::Color::Blue);
-
-        // 右侧：游戏消息（固定高度视口） + 游戏状态（玩家/队伍） - 优化美观度
-        std::vector<ftxui::Element> right;
-        
-        // 游戏消息区域
-        right.push_back(ftxui::text("[消息] 游戏消息") | ftxui::bold | ftxui::color(ftxui::Color::Magenta));
-        right.push_back(ftxui::separator());
-        std::vector<ftxui::Element> msg_lines;
-        if (game_messages_.empty()) {
-            msg_lines.push_back(ftxui::text("暂无消息") | ftxui::color(ftxui::Color::GrayLight));
-        } else {
-            // 为了保证新增消息在存在多行换行时也能立即可见，按时间倒序显示（最新在上）
-            for (auto it = game_messages_.rbegin(); it != game_messages_.rend(); ++it) {
-                const auto& m = *it;
-                // 为不同类型的消息添加不同颜色
-                auto styled_msg = ftxui::paragraph(m);
-                if (m.find("胜利") != std::string::npos || m.find("成功") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Green);
-                } else if (m.find("失败") != std::string::npos || m.find("错误") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Red);
-                } else if (m.find("获得") != std::string::npos || m.find("奖励") != std::string::npos) {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::Yellow);
-                } else {
-                    styled_msg = styled_msg | ftxui::color(ftxui::Color::White);
-                }
-                msg_lines.push_back(styled_msg);
-            }
-        }
-        auto messages_view = ftxui::vbox(msg_lines) | ftxui::vscroll_indicator | ftxui::yframe |
-                             ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, message_h);
-        right.push_back(messages_view);
-        
-        // 游戏状态区域
-        right.push_back(ftxui::separator());
-        right.push_back(ftxui::text("[状态] 游戏状态") | ftxui::bold | ftxui::color(ftxui::Color::Cyan));
-        right.push_back(ftxui::separator());
-        
-        // 玩家信息 - 使用更美观的显示
-        auto activeMember = game_->getPlayer().getActiveMember();
-        std::string activeName = activeMember ? activeMember->getName() : "无";
-        right.push_back(ftxui::paragraph("上场角色: " + activeName) | ftxui::color(ftxui::Color::White));
-        right.push_back(ftxui::paragraph("等级: Lv." + std::to_string(player_level_)) | ftxui::color(ftxui::Color::Yellow));
-        
-        // HP显示 - 使用颜色表示血量状态
-        auto hp_color = (player_hp_ > player_max_hp_ * 0.5) ? ftxui::Color::Green : 
-                       (player_hp_ > player_max_hp_ * 0.25) ? ftxui::Color::Yellow : ftxui::Color::Red;
-        right.push_back(ftxui::paragraph("HP: " + std::to_string(player_hp_) + "/" + std::to_string(player_max_hp_)) | ftxui::color(hp_color));
-        right.push_back(ftxui::paragraph(player_status_) | ftxui::color(ftxui::Color::GrayLight));
-        
-        // 队伍成员区域
-        right.push_back(ftxui::separator());
-        right.push_back(ftxui::text("[队伍] 队伍成员") | ftxui::bold | ftxui::color(ftxui::Color::Blue));
-        right.push_back(ftxui::separator());
-        if (team_members_.empty()) {
-            right.push_back(ftxui::text("暂无队伍成员") | ftxui::color(ftxui::Color::GrayLight));
-        } else {
-            for (const auto& member : team_members_) {
-                // 为队伍成员添加颜色
-                right.push_back(ftxui::paragraph("* " + member) | ftxui::color(ftxui::Color::White));
-            }
-        }
-        
-        auto right_box = ftxui::vbox(right) | ftxui::border | ftxui::color(ftxui::Color::Magenta);
-
-        // 按 7:3 比例分配宽度，确保地图有足够空间显示完整边框
-        int left_w = std::max(30, dims.dimx * 5 / 10);  // 增加最小宽度到30，确保地图边框完整显示
-        int right_w = std::max(15, dims.dimx - left_w);  // 相应增加右侧最小宽度
-        auto left_sized = left_box | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, left_w);
-        auto right_sized = right_box | ftxui::size(ftxui::WIDTH, ftxui::EQUAL, right_w);
-
-        return ftxui::hbox({ left_sized, right_sized }) | ftxui::size(ftxui::HEIGHT, ftxui::EQUAL, main_h);
+        return RenderMainArea();
     });
 
     // 主组件（顶栏 / 中部 / 底部）
@@ -6,6 +6,7 @@
 #ifndef CPP_MUD_OUC_GAMEPLAY_HPP
 #define CPP_MUD_OUC_GAMEPLAY_HPP
 #include "../display.hpp"
+#include "../../core/state_version.h"
 #include <ftxui/component/component.hpp>
 #include <ftxui/component/screen_interactive.hpp>
 #include <string>
@@ -45,6 +46,9 @@ public:
 private:
     void HandleGameCommand(const std::string& command);
     void MaybeShowBlockStory(const std::string& block_name);
+    ftxui::Element RenderMainArea();
+    ftxui::Element BuildMapPanel();
+    ftxui::Element BuildStatusPanel(int message_h);
     ftxui::Component component_;
     
     // UI组件
@@ -67,6 +71,28 @@ private:
     std::vector<std::string> current_map_lines_;
     std::string current_block_info_;
     std::set<std::string> visited_blocks_;
+
+    // 面板缓存：构建时的数据版本与尺寸都未变化时，直接复用上次的 Element 树
+    struct PanelCache {
+        uint64_t version = 0;
+        int width = 0;
+        int height = 0;
+        ftxui::Element element;
+
+        bool Matches(uint64_t v, int w, int h) const {
+            return element && version == v && width == w && height == h;
+        }
+        void Store(uint64_t v, int w, int h, ftxui::Element e) {
+            version = v;
+            width = w;
+            height = h;
+            element = std::move(e);
+        }
+    };
+    StateVersion map_view_version_;      // 地图行、位置信息变化时递增
+    StateVersion status_view_version_;   // 消息、玩家数值、队伍列表变化时递增
+    PanelCache map_panel_;
+    PanelCache status_panel_;
     
     // 输入缓冲区
     std::string chat_input_buffer_;
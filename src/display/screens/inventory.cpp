@@ -8,6 +8,7 @@
 #include <ftxui/dom/elements.hpp>
 #include <sstream>
 #include <algorithm>
+#include <unordered_set>
 #include "../../utils/utils.hpp"
 
 using namespace ftxui;
@@ -20,6 +21,7 @@ InventoryScreen::InventoryScreen(Game* game)
     CreateItemList();
     CreateItemDetails();
     CreateFilterButtons();
+    CreateSortButtons();
     CreateActionButtons();
     CreateSearchInput();
 
@@ -106,6 +108,7 @@ InventoryScreen::InventoryScreen(Game* game)
     
     auto main_layout = Container::Vertical({
         filterButtons_,
+        sortButtons_,
         searchInput_,
         horizontal_container,
         memberSelection_,
@@ -118,6 +121,7 @@ InventoryScreen::InventoryScreen(Game* game)
             separator(),
             hbox({
                 text("当前筛选: ") | dim, text(filterType_) | color(Color::Blue) | bold,
+                text("  排序: ") | dim, text(GetSortLabel()) | color(Color::Blue) | bold,
                 filler(),
                 text("容量: ") | dim, text(GetInventoryStats()) | color(Color::Yellow)
             }),
@@ -157,7 +161,7 @@ Component InventoryScreen::GetComponent() {
 }
 
 void InventoryScreen::InitializeItems() {
-    currentItems_ = game_->getPlayer().inventory.getAllItems();
+    currentItems_ = game_->getPlayer().inventory.getSortedItems();
     if (!currentItems_.empty()) {
         selectedItemName_ = currentItems_[0]->getName();
     }
@@ -177,31 +181,51 @@ void InventoryScreen::UpdateItemList() {
 }
 
 std::vector<std::shared_ptr<Item>> InventoryScreen::GetFilteredItems() const {
-    auto allItems = game_->getPlayer().inventory.getAllItems();
-    std::vector<std::shared_ptr<Item>> filtered;
-
-    for (const auto& item : allItems) {
-        bool typeMatch = (filterType_ == "全部");
-        if (!typeMatch) {
-            if (filterType_ == "武器" && item->getType() == ItemType::WEAPON) typeMatch = true;
-            else if (filterType_ == "圣遗物" && item->getType() == ItemType::ARTIFACT) typeMatch = true;
-            else if (filterType_ == "食物" && item->getType() == ItemType::FOOD) typeMatch = true;
-            else if (filterType_ == "材料" && item->getType() == ItemType::MATERIAL) typeMatch = true;
+    const auto& inventory = game_->getPlayer().inventory;
+    // 关键字走背包的搜索索引，无需逐个物品转换大小写
+    std::vector<std::shared_ptr<Item>> candidates;
+    if (searchKeyword_.empty()) {
+        // 排序视图由背包常驻维护，直接按当前排序取出
+        candidates = inventory.getSortedItems();
+    } else {
+        // 先列出包含关键字的物品，再按得分追加拼音/模糊匹配（如输入 "fyj" 找到 "风鹰剑"）
+        candidates = inventory.searchItems(searchKeyword_);
+        std::unordered_set<const Item*> listed;
+        for (const auto& item : candidates) {
+            listed.insert(item.get());
         }
-
-        bool searchMatch = searchKeyword_.empty();
-        if (!searchMatch) {
-            std::string itemName = item->getName();
-            std::string itemDesc = item->getDescription();
-            std::transform(itemName.begin(), itemName.end(), itemName.begin(), ::tolower);
-            std::transform(itemDesc.begin(), itemDesc.end(), itemDesc.begin(), ::tolower);
-            std::string keyword = searchKeyword_;
-            std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::tolower);
-            searchMatch = (itemName.find(keyword) != std::string::npos ||
-                          itemDesc.find(keyword) != std::string::npos);
+        for (const auto& item : inventory.fuzzySearchItems(searchKeyword_)) {
+            if (listed.insert(item.get()).second) {
+                candidates.push_back(item);
+            }
+        }
+        // 选择了排序时按排序位置重排搜索结果，否则保持相关度顺序
+        if (inventory.getOrder() != InventoryOrder::ACQUIRED || inventory.isOrderReversed()) {
+            std::vector<std::pair<size_t, std::shared_ptr<Item>>> ranked;
+            ranked.reserve(candidates.size());
+            for (const auto& item : candidates) {
+                ranked.emplace_back(inventory.getItemPosition(inventory.getOrder(), item, inventory.isOrderReversed()), item);
+            }
+            std::sort(ranked.begin(), ranked.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+            for (size_t i = 0; i < ranked.size(); ++i) {
+                candidates[i] = ranked[i].second;
+            }
         }
+    }
+    if (filterType_ == "全部") {
+        return candidates;
+    }
 
-        if (typeMatch && searchMatch) {
+    std::vector<std::shared_ptr<Item>> filtered;
+    for (const auto& item : candidates) {
+        bool typeMatch = false;
+        if (filterType_ == "武器" && item->getType() == ItemType::WEAPON) typeMatch = true;
+        else if (filterType_ == "圣遗物" && item->getType() == ItemType::ARTIFACT) typeMatch = true;
+        else if (filterType_ == "食物" && item->getType() == ItemType::FOOD) typeMatch = true;
+        else if (filterType_ == "材料" && item->getType() == ItemType::MATERIAL) typeMatch = true;
+
+        if (typeMatch) {
             filtered.push_back(item);
         }
     }
@@ -344,6 +368,34 @@ void InventoryScreen::CreateFilterButtons() {
     });
 }
 
+void InventoryScreen::CreateSortButtons() {
+    struct SortOption {
+        const char* label;
+        InventoryOrder order;
+        bool reversed;
+    };
+    static const SortOption options[] = {
+        {"获得顺序", InventoryOrder::ACQUIRED, false},
+        {"最近获得", InventoryOrder::ACQUIRED, true},
+        {"名称", InventoryOrder::NAME, false},
+        {"类型", InventoryOrder::TYPE, false},
+        {"稀有度", InventoryOrder::RARITY, true},
+    };
+
+    std::vector<Component> buttons;
+    for (const auto& option : options) {
+        auto button = Button(option.label, [this, option] {
+            HandleSortSelection(option.order, option.reversed);
+        });
+        buttons.push_back(button);
+    }
+
+    auto container = Container::Horizontal(buttons);
+    sortButtons_ = Renderer(container, [container] {
+        return window(text("排序"), container->Render());
+    });
+}
+
 void InventoryScreen::CreateActionButtons() {
     std::vector<Component> buttons;
 
@@ -491,6 +543,36 @@ void InventoryScreen::HandleFilterSelection(const std::string& filter) {
     UpdateItemList();
 }
 
+void InventoryScreen::HandleSortSelection(InventoryOrder order, bool reversed) {
+    // 切换排序只是换一个常驻索引读取，保持当前选中的物品不变
+    std::shared_ptr<Item> selected;
+    if (selectedIndex_ >= 0 && selectedIndex_ < static_cast<int>(currentItems_.size())) {
+        selected = currentItems_[selectedIndex_];
+    }
+
+    game_->getPlayer().inventory.setOrder(order, reversed);
+    UpdateItemList();
+
+    if (selected) {
+        auto it = std::find(currentItems_.begin(), currentItems_.end(), selected);
+        if (it != currentItems_.end()) {
+            selectedIndex_ = static_cast<int>(it - currentItems_.begin());
+            selectedItemName_ = selected->getName();
+        }
+    }
+}
+
+std::string InventoryScreen::GetSortLabel() const {
+    const auto& inventory = game_->getPlayer().inventory;
+    switch (inventory.getOrder()) {
+        case InventoryOrder::ACQUIRED: return inventory.isOrderReversed() ? "最近获得" : "获得顺序";
+        case InventoryOrder::NAME:     return inventory.isOrderReversed() ? "名称(降序)" : "名称";
+        case InventoryOrder::TYPE:     return inventory.isOrderReversed() ? "类型(降序)" : "类型";
+        case InventoryOrder::RARITY:   return inventory.isOrderReversed() ? "稀有度" : "稀有度(升序)";
+    }
+    return "";
+}
+
 void InventoryScreen::HandleAction(int action) {
     // 实现动作处理逻辑
 }
@@ -36,6 +36,7 @@ private:
     ftxui::Component itemList_;
     ftxui::Component itemDetails_;
     ftxui::Component filterButtons_;
+    ftxui::Component sortButtons_;
     ftxui::Component actionButtons_;
     ftxui::Component searchInput_;
     ftxui::Component memberSelection_;
@@ -46,12 +47,14 @@ private:
     void CreateItemList();
     void CreateItemDetails();
     void CreateFilterButtons();
+    void CreateSortButtons();
     void CreateActionButtons();
     void CreateSearchInput();
 
     // 事件处理
     void HandleItemSelection(int index);
     void HandleFilterSelection(const std::string& filter);
+    void HandleSortSelection(InventoryOrder order, bool reversed);
     void HandleAction(int action);
     void HandleSearch(const std::string& keyword);
 
@@ -59,4 +62,5 @@ private:
     std::string GetItemDisplayText(const std::shared_ptr<Item>& item) const;
     std::vector<std::shared_ptr<Item>> GetFilteredItems() const;
     std::string GetInventoryStats() const;
+    std::string GetSortLabel() const;
 };
@@ -5,6 +5,7 @@
 
 #include "save_select.hpp"
 #include "../window_size_checker.hpp"
+#include "../../utils/global_settings.hpp"
 #include <ftxui/component/component.hpp>
 #include <ftxui/dom/elements.hpp>
 #include <ftxui/component/screen_interactive.hpp>
@@ -16,10 +17,10 @@
 using namespace ftxui;
 
 SaveSelectScreen::SaveSelectScreen(Game* game, SaveSelectMode mode)
-    : game_(game), mode_(mode), selectedSlot_(0), showingInput_(false), 
+    : game_(game), mode_(mode), editingFilter_(false), selectedSlot_(0), showingInput_(false), 
       showingDeleteConfirm_(false), deleteSlotIndex_(-1), showingStatusMessage_(false),
       source_screen_("MainMenu") {
-    RefreshSaveList();
+    // 存档列表在切换到本界面时刷新（见 ScreenManager::SwitchToScreen），构造时不读取目录
     
     // 创建主容器
     container_ = Container::Vertical({});
@@ -54,15 +55,9 @@ void SaveSelectScreen::SetSourceScreen(const std::string& source_screen) {
 void SaveSelectScreen::RefreshSaveList() {
     saveSlots_.clear();
     
-    // 获取所有存档文件
-    auto saveFiles = game_->getSaveFiles();
-    
-    // 添加现有存档
-    for (const auto& fileName : saveFiles) {
-        if (game_->saveExists(fileName)) {
-            auto saveInfo = game_->getSaveInfo(fileName);
-            saveSlots_.emplace_back(fileName, saveInfo);
-        }
+    // 获取所有存档及摘要：一次目录扫描，摘要来自缓存或文件头
+    for (auto& listing : game_->listSaves()) {
+        saveSlots_.emplace_back(listing.fileName, listing.info);
     }
     
     // 在保存模式下，添加一个"新建存档"选项
@@ -73,10 +68,47 @@ void SaveSelectScreen::RefreshSaveList() {
         saveSlots_.insert(saveSlots_.begin(), newSlot);
     }
     
+    // 重建模糊检索索引（id 即 saveSlots_ 下标）
+    slotIndex_.clear();
+    for (size_t i = 0; i < saveSlots_.size(); ++i) {
+        if (!saveSlots_[i].isEmpty) {
+            slotIndex_.add(static_cast<uint32_t>(i), saveSlots_[i].fileName + " " + saveSlots_[i].saveInfo.playerName);
+        }
+    }
+    
+    ApplyFilter();
+}
+
+void SaveSelectScreen::ApplyFilter() {
+    visibleSlots_.clear();
+    
+    if (filterQuery_.empty()) {
+        for (size_t i = 0; i < saveSlots_.size(); ++i) {
+            visibleSlots_.push_back(static_cast<int>(i));
+        }
+    } else {
+        // "新建存档"始终保留在最前，其余按匹配得分排序
+        for (size_t i = 0; i < saveSlots_.size(); ++i) {
+            if (saveSlots_[i].isEmpty) {
+                visibleSlots_.push_back(static_cast<int>(i));
+            }
+        }
+        for (const auto& match : slotIndex_.search(filterQuery_)) {
+            visibleSlots_.push_back(static_cast<int>(match.id));
+        }
+    }
+    
     // 确保选中索引有效
-    if (selectedSlot_ >= static_cast<int>(saveSlots_.size())) {
-        selectedSlot_ = std::max(0, static_cast<int>(saveSlots_.size()) - 1);
+    if (selectedSlot_ >= static_cast<int>(visibleSlots_.size())) {
+        selectedSlot_ = std::max(0, static_cast<int>(visibleSlots_.size()) - 1);
+    }
+}
+
+int SaveSelectScreen::SelectedSlotIndex() const {
+    if (selectedSlot_ < 0 || selectedSlot_ >= static_cast<int>(visibleSlots_.size())) {
+        return -1;
     }
+    return visibleSlots_[selectedSlot_];
 }
 
 Element SaveSelectScreen::CreateMainRenderer() {
@@ -94,6 +126,13 @@ Element SaveSelectScreen::CreateMainRenderer() {
     elements.push_back(RenderModeTitle());
     elements.push_back(separator());
     
+    // 搜索过滤
+    if (editingFilter_ || !filterQuery_.empty()) {
+        std::string filterText = "搜索: " + filterQuery_ + (editingFilter_ ? "_" : "");
+        elements.push_back(text(filterText) | color(Color::Yellow));
+        elements.push_back(separator());
+    }
+    
     // 状态消息
     if (showingStatusMessage_ && !statusMessage_.empty()) {
         elements.push_back(text(statusMessage_) | hcenter | color(Color::Green) | bold);
@@ -105,9 +144,13 @@ Element SaveSelectScreen::CreateMainRenderer() {
         elements.push_back(text("没有找到存档文件") | hcenter | color(Color::Red));
     } else {
         Elements slotElements;
-        for (size_t i = 0; i < saveSlots_.size(); ++i) {
+        for (size_t i = 0; i < visibleSlots_.size(); ++i) {
             bool isSelected = (i == static_cast<size_t>(selectedSlot_));
-            slotElements.push_back(RenderSaveSlot(saveSlots_[i], static_cast<int>(i), isSelected));
+            int slotIndex = visibleSlots_[i];
+            slotElements.push_back(RenderSaveSlot(saveSlots_[slotIndex], slotIndex, isSelected));
+        }
+        if (slotElements.empty()) {
+            slotElements.push_back(text("没有匹配的存档") | hcenter | color(Color::Red));
         }
         elements.push_back(vbox(slotElements));
     }
@@ -134,14 +177,27 @@ Element SaveSelectScreen::RenderSaveSlot(const SaveSlotInfo& slot, int index, bo
         std::stringstream ss;
         ss << "[" << std::setw(2) << std::setfill('0') << (index + 1) << "] ";
         
-        // 显示存档文件名（去掉.json扩展名）
+        // 显示存档文件名（去掉扩展名），二进制存档额外标注
         std::string displayFileName = slot.fileName;
-        if (displayFileName.length() > 5 && displayFileName.substr(displayFileName.length() - 5) == ".json") {
-            displayFileName = displayFileName.substr(0, displayFileName.length() - 5);
+        bool isBinary = GameSave::formatForFile(displayFileName) == SaveFormat::BINARY;
+        size_t dot = displayFileName.rfind('.');
+        if (dot != std::string::npos && dot > 0) {
+            displayFileName = displayFileName.substr(0, dot);
         }
         ss << displayFileName;
+        if (isBinary) {
+            ss << " [SAV]";
+        }
         
-        slotContent.push_back(text(ss.str()) | bold | color(Color::Cyan));
+        if (slot.saveInfo.corrupt) {
+            // 校验失败的存档加载时会尝试从备份恢复
+            slotContent.push_back(hbox({
+                text(ss.str()) | bold | color(Color::Cyan),
+                text(" [已损坏]") | bold | color(Color::Red),
+            }));
+        } else {
+            slotContent.push_back(text(ss.str()) | bold | color(Color::Cyan));
+        }
         
         // 玩家信息
         if (!slot.saveInfo.playerName.empty()) {
@@ -186,9 +242,9 @@ Element SaveSelectScreen::RenderInstructions() {
     Elements instructions;
     
     if (mode_ == SaveSelectMode::LOAD) {
-        instructions.push_back(text("↑↓: 选择存档  Enter: 加载  Del: 删除  Esc: 返回  M: 主菜单") | hcenter);
+        instructions.push_back(text("↑↓: 选择存档  Enter: 加载  Del: 删除  C: 转换格式  R: 重命名  D: 复制  /: 搜索  Esc: 返回  M: 主菜单") | hcenter);
     } else {
-        instructions.push_back(text("↑↓: 选择存档  Enter: 保存  Del: 删除  Esc: 返回游戏  M: 主菜单") | hcenter);
+        instructions.push_back(text("↑↓: 选择存档  Enter: 保存  Del: 删除  C: 转换格式  R: 重命名  D: 复制  /: 搜索  Esc: 返回游戏  M: 主菜单") | hcenter);
     }
     
     return vbox(instructions) | color(Color::GrayLight);
@@ -197,7 +253,7 @@ Element SaveSelectScreen::RenderInstructions() {
 Element SaveSelectScreen::CreateInputDialog() {
     Elements dialog;
     
-    dialog.push_back(text("请输入存档名称:") | hcenter | bold);
+    dialog.push_back(text(renameSource_.empty() ? "请输入存档名称:" : "请输入新的存档名称:") | hcenter | bold);
     dialog.push_back(separator());
     
     // 输入框 - 预留更多空间
@@ -268,6 +324,10 @@ bool SaveSelectScreen::HandleKeyboardInput(Event event) {
         return HandleDeleteConfirmDialog(event);
     }
     
+    if (editingFilter_) {
+        return HandleFilterInput(event);
+    }
+    
     // 主界面键盘处理
     if (event == Event::ArrowUp) {
         if (selectedSlot_ > 0) {
@@ -277,26 +337,64 @@ bool SaveSelectScreen::HandleKeyboardInput(Event event) {
     }
     
     if (event == Event::ArrowDown) {
-        if (selectedSlot_ < static_cast<int>(saveSlots_.size()) - 1) {
+        if (selectedSlot_ < static_cast<int>(visibleSlots_.size()) - 1) {
             selectedSlot_++;
         }
         return true;
     }
     
     if (event == Event::Return) {
-        HandleSaveSlotAction(selectedSlot_);
+        HandleSaveSlotAction(SelectedSlotIndex());
         return true;
     }
     
     if (event == Event::Delete) {
-        if (selectedSlot_ >= 0 && selectedSlot_ < static_cast<int>(saveSlots_.size()) &&
-            !saveSlots_[selectedSlot_].isEmpty) {
-            ShowDeleteConfirmation(selectedSlot_);
+        int slotIndex = SelectedSlotIndex();
+        if (slotIndex >= 0 && !saveSlots_[slotIndex].isEmpty) {
+            ShowDeleteConfirmation(slotIndex);
+        }
+        return true;
+    }
+    
+    if (event == Event::Character('/')) {
+        editingFilter_ = true;
+        return true;
+    }
+    
+    // C 键：在 JSON 与二进制格式之间转换选中的存档
+    if (event == Event::Character('c') || event == Event::Character('C')) {
+        int slotIndex = SelectedSlotIndex();
+        if (slotIndex >= 0 && !saveSlots_[slotIndex].isEmpty) {
+            ConvertSave(saveSlots_[slotIndex].fileName);
+        }
+        return true;
+    }
+    
+    // R 键：重命名选中的存档
+    if (event == Event::Character('r') || event == Event::Character('R')) {
+        int slotIndex = SelectedSlotIndex();
+        if (slotIndex >= 0 && !saveSlots_[slotIndex].isEmpty) {
+            ShowRenameInput(saveSlots_[slotIndex].fileName);
+        }
+        return true;
+    }
+    
+    // D 键：复制选中的存档
+    if (event == Event::Character('d') || event == Event::Character('D')) {
+        int slotIndex = SelectedSlotIndex();
+        if (slotIndex >= 0 && !saveSlots_[slotIndex].isEmpty) {
+            DuplicateSave(saveSlots_[slotIndex].fileName);
         }
         return true;
     }
     
     if (event == Event::Escape) {
+        // 有过滤条件时先清除过滤，再次按 Esc 才返回
+        if (!filterQuery_.empty()) {
+            filterQuery_.clear();
+            ApplyFilter();
+            return true;
+        }
         HandleBack();
         return true;
     }
@@ -323,16 +421,21 @@ bool SaveSelectScreen::HandleInputDialog(Event event) {
     if (event == Event::Escape) {
         showingInput_ = false;
         inputSaveName_.clear();
+        renameSource_.clear();
         return true;
     }
     
     if (event == Event::Return) {
-        if (!inputSaveName_.empty()) {
-            std::string fileName = inputSaveName_ + ".json";
+        if (!inputSaveName_.empty() && !renameSource_.empty()) {
+            RenameSave(renameSource_, inputSaveName_);
+        } else if (!inputSaveName_.empty()) {
+            std::string fileName = inputSaveName_ +
+                (GlobalSettings::IsBinarySaveEnabled() ? ".sav" : ".json");
             SaveToSlot(fileName);
         }
         showingInput_ = false;
         inputSaveName_.clear();
+        renameSource_.clear();
         return true;
     }
     
@@ -372,6 +475,48 @@ bool SaveSelectScreen::HandleInputDialog(Event event) {
     return false;
 }
 
+bool SaveSelectScreen::HandleFilterInput(Event event) {
+    if (event == Event::Return) {
+        editingFilter_ = false;
+        return true;
+    }
+    
+    if (event == Event::Escape) {
+        editingFilter_ = false;
+        filterQuery_.clear();
+        ApplyFilter();
+        return true;
+    }
+    
+    if (event == Event::Backspace) {
+        if (!filterQuery_.empty()) {
+            // 按 UTF-8 字符删除
+            size_t pos = filterQuery_.size() - 1;
+            while (pos > 0 && (static_cast<unsigned char>(filterQuery_[pos]) & 0xC0) == 0x80) {
+                --pos;
+            }
+            filterQuery_.erase(pos);
+            selectedSlot_ = 0;
+            ApplyFilter();
+        }
+        return true;
+    }
+    
+    if (event == Event::ArrowUp || event == Event::ArrowDown) {
+        editingFilter_ = false;
+        return HandleKeyboardInput(event);
+    }
+    
+    if (event.is_character()) {
+        filterQuery_ += event.character();
+        selectedSlot_ = 0;
+        ApplyFilter();
+        return true;
+    }
+    
+    return false;
+}
+
 bool SaveSelectScreen::HandleDeleteConfirmDialog(Event event) {
     if (event == Event::Escape || event.character() == "n" || event.character() == "N") {
         showingDeleteConfirm_ = false;
@@ -437,6 +582,12 @@ void SaveSelectScreen::ShowSaveNameInput() {
     inputSaveName_.clear();
 }
 
+void SaveSelectScreen::ShowRenameInput(const std::string& fileName) {
+    showingInput_ = true;
+    inputSaveName_.clear();
+    renameSource_ = fileName;
+}
+
 void SaveSelectScreen::ShowDeleteConfirmation(int slotIndex) {
     // 刷新存档列表以确保显示最新的存档信息
     RefreshSaveList();
@@ -462,25 +613,83 @@ void SaveSelectScreen::SaveToSlot(const std::string& fileName) {
     // 尝试转换文件名编码（如果可能的话）
     std::string finalFileName = fileName;
     
-    // 调用游戏的保存功能
-    game_->SaveGame(finalFileName);
-    
-    // 刷新列表
-    RefreshSaveList();
-    
-    // 显示保存成功消息
-    statusMessage_ = "存档保存成功: " + finalFileName;
+    // 调用游戏的后台保存功能，写盘期间界面保持响应
+    statusMessage_ = "正在保存: " + finalFileName;
     showingStatusMessage_ = true;
+    game_->SaveGameAsync(finalFileName, [this, finalFileName](bool success) {
+        // 刷新列表
+        RefreshSaveList();
+        
+        // 显示保存结果
+        statusMessage_ = (success ? "存档保存成功: " : "存档保存失败: ") + finalFileName;
+        showingStatusMessage_ = true;
+    });
     
     // 保存成功后不立即返回主菜单，让用户看到保存结果
     // 用户可以通过按Esc键返回主菜单
 }
 
+void SaveSelectScreen::ConvertSave(const std::string& fileName) {
+    SaveFormat target = GameSave::formatForFile(fileName) == SaveFormat::BINARY ? SaveFormat::JSON : SaveFormat::BINARY;
+    std::string targetFileName = GameSave::withFormat(fileName, target);
+    if (game_->saveExists(targetFileName)) {
+        statusMessage_ = "目标存档已存在: " + targetFileName;
+        showingStatusMessage_ = true;
+        return;
+    }
+    
+    if (game_->convertSave(fileName, targetFileName)) {
+        RefreshSaveList();
+        statusMessage_ = "存档已转换: " + targetFileName;
+    } else {
+        statusMessage_ = "存档转换失败: " + fileName;
+    }
+    showingStatusMessage_ = true;
+}
+
+void SaveSelectScreen::RenameSave(const std::string& fileName, const std::string& newName) {
+    // 保留原扩展名，存档格式不变
+    size_t dot = fileName.rfind('.');
+    std::string targetFileName = newName + (dot != std::string::npos && dot > 0 ? fileName.substr(dot) : "");
+    if (game_->saveExists(targetFileName)) {
+        statusMessage_ = "目标存档已存在: " + targetFileName;
+    } else if (game_->renameSave(fileName, targetFileName)) {
+        RefreshSaveList();
+        statusMessage_ = "存档已重命名: " + targetFileName;
+    } else {
+        statusMessage_ = "存档重命名失败: " + fileName;
+    }
+    showingStatusMessage_ = true;
+}
+
+void SaveSelectScreen::DuplicateSave(const std::string& fileName) {
+    // 副本名为 "<原名>_副本"，已存在时追加序号
+    std::string stem = fileName;
+    std::string extension;
+    size_t dot = fileName.rfind('.');
+    if (dot != std::string::npos && dot > 0) {
+        stem = fileName.substr(0, dot);
+        extension = fileName.substr(dot);
+    }
+    std::string targetFileName = stem + "_副本" + extension;
+    for (int n = 2; game_->saveExists(targetFileName); ++n) {
+        targetFileName = stem + "_副本" + std::to_string(n) + extension;
+    }
+    
+    if (game_->copySave(fileName, targetFileName)) {
+        RefreshSaveList();
+        statusMessage_ = "存档已复制: " + targetFileName;
+    } else {
+        statusMessage_ = "存档复制失败: " + fileName;
+    }
+    showingStatusMessage_ = true;
+}
+
 void SaveSelectScreen::DeleteSaveFile(const std::string& fileName) {
     if (game_->deleteSave(fileName)) {
         RefreshSaveList();
         // 调整选中索引
-        if (selectedSlot_ >= static_cast<int>(saveSlots_.size()) && selectedSlot_ > 0) {
+        if (selectedSlot_ >= static_cast<int>(visibleSlots_.size()) && selectedSlot_ > 0) {
             selectedSlot_--;
         }
         
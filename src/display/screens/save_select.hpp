@@ -8,6 +8,7 @@
 
 #include "../display.hpp"
 #include "../../core/game.h"
+#include "../../utils/fuzzy_index.hpp"
 #include <vector>
 #include <string>
 
@@ -61,22 +62,36 @@ private:
     void LoadSelectedSave(const std::string& fileName);
     void SaveToSlot(const std::string& fileName);
     void DeleteSaveFile(const std::string& fileName);
+    void ConvertSave(const std::string& fileName);
+    void DuplicateSave(const std::string& fileName);
+    void RenameSave(const std::string& fileName, const std::string& newName);
     
     // 输入处理
     void ShowSaveNameInput();
+    void ShowRenameInput(const std::string& fileName);
     void ShowDeleteConfirmation(int slotIndex);
     bool HandleKeyboardInput(ftxui::Event event);
     bool HandleInputDialog(ftxui::Event event);
     bool HandleDeleteConfirmDialog(ftxui::Event event);
+    bool HandleFilterInput(ftxui::Event event);
+    
+    // 搜索过滤（支持拼音首字母/全拼模糊匹配）
+    void ApplyFilter();
+    int SelectedSlotIndex() const;
     
     Game* game_;
     SaveSelectMode mode_;
     std::vector<SaveSlotInfo> saveSlots_;
-    int selectedSlot_;
+    std::vector<int> visibleSlots_;   // 过滤后可见的存档下标（按匹配度排序）
+    FuzzyIndex slotIndex_;            // 存档名与玩家名的模糊检索索引
+    std::string filterQuery_;
+    bool editingFilter_;
+    int selectedSlot_;                // visibleSlots_ 中的位置
     bool showingInput_;
     bool showingDeleteConfirm_;
     int deleteSlotIndex_;
     std::string inputSaveName_;
+    std::string renameSource_;        // 非空时输入框用于重命名该存档
     bool showingStatusMessage_;
     std::string statusMessage_;
     std::string source_screen_; // 来源界面名称
@@ -1,10 +1,11 @@
 // =============================================
 // 文件: settings.cpp
-// 描述: 设置界面实现。提供AI开关等设置选项。
+// 描述: 设置界面实现。提供AI开关、存档格式等设置选项。
 // =============================================
 
 #include <ftxui/component/component.hpp>
 #include <ftxui/dom/elements.hpp>
+#include <iterator>
 #include <string>
 #include <vector>
 #include "../utils/utils.hpp"
@@ -13,6 +14,11 @@
 
 using namespace ftxui;
 
+namespace {
+// 自动保存间隔选项（秒），0 表示关闭定时保存
+const int kAutosaveIntervals[] = {0, 30, 60, 300};
+}
+
 SettingsScreen::SettingsScreen() : source_screen_("MainMenu") {
     // 初始化AI开关状态为全局设置的值
     ai_toggle_selected_ = GlobalSettings::IsAIEnabled() ? 1 : 0;
@@ -21,6 +27,31 @@ SettingsScreen::SettingsScreen() : source_screen_("MainMenu") {
     ai_toggle_options_ = {"AI Disabled", "AI Enabled"};
     ai_toggle_ = Toggle(ai_toggle_options_, &ai_toggle_selected_);
 
+    // 创建存档格式开关
+    save_format_selected_ = GlobalSettings::IsBinarySaveEnabled() ? 1 : 0;
+    save_format_options_ = {"JSON (.json)", "Binary (.sav)"};
+    save_format_toggle_ = Toggle(save_format_options_, &save_format_selected_);
+
+    // 创建存档压缩开关
+    save_compression_selected_ = GlobalSettings::IsSaveCompressionEnabled() ? 1 : 0;
+    save_compression_options_ = {"Uncompressed", "Compressed (LZ)"};
+    save_compression_toggle_ = Toggle(save_compression_options_, &save_compression_selected_);
+
+    // 创建自动保存间隔选项
+    autosave_interval_selected_ = 0;
+    for (int i = 0; i < static_cast<int>(std::size(kAutosaveIntervals)); ++i) {
+        if (kAutosaveIntervals[i] == GlobalSettings::GetAutosaveIntervalSeconds()) {
+            autosave_interval_selected_ = i;
+        }
+    }
+    autosave_interval_options_ = {"Off", "30 s", "1 min", "5 min"};
+    autosave_interval_toggle_ = Toggle(autosave_interval_options_, &autosave_interval_selected_);
+
+    // 创建存档存放方式开关
+    slot_store_selected_ = GlobalSettings::IsSlotStoreEnabled() ? 1 : 0;
+    slot_store_options_ = {"Directory (saves/)", "Single file (slots.db)"};
+    slot_store_toggle_ = Toggle(slot_store_options_, &slot_store_selected_);
+
     auto back_button = Button("返回", [this] {
         this->HandleSelection(0); // 0 表示返回
     });
@@ -28,6 +59,10 @@ SettingsScreen::SettingsScreen() : source_screen_("MainMenu") {
     // 创建设置选项容器
     auto settings_container = Container::Vertical({
         ai_toggle_,
+        save_format_toggle_,
+        save_compression_toggle_,
+        autosave_interval_toggle_,
+        slot_store_toggle_,
         back_button
     });
 
@@ -38,6 +73,21 @@ SettingsScreen::SettingsScreen() : source_screen_("MainMenu") {
                     text("AI智能建议:") | color(Color::Cyan),
                     ai_toggle_->Render(),
                     separator(),
+                    text("存档格式:") | color(Color::Cyan),
+                    save_format_toggle_->Render(),
+                    text("二进制存档体积更小、读写更快；读取时自动识别格式。") | color(Color::GrayLight) | dim,
+                    text("存档压缩:") | color(Color::Cyan),
+                    save_compression_toggle_->Render(),
+                    text("压缩后存档与自动存档占用更少磁盘；读取时自动解压。") | color(Color::GrayLight) | dim,
+                    text("自动保存间隔:") | color(Color::Cyan),
+                    autosave_interval_toggle_->Render(),
+                    text("只在有改动时保存，连续操作在一个间隔内只保存一次；离开游戏界面时总会保存改动。") |
+                        color(Color::GrayLight) | dim,
+                    text("存档存放方式:") | color(Color::Cyan),
+                    slot_store_toggle_->Render(),
+                    text("单文件容器把所有存档放在一个文件中，列表、复制与重命名无需逐个读取文件；切换时自动迁移现有存档。") |
+                        color(Color::GrayLight) | dim,
+                    separator(),
                     text("注意: AI建议的响应速度会受到互联网连接影响；AI建议的回答可能不准确，请谨慎使用。；") | 
                         color(Color::GrayLight) | dim,
                     separator(),
@@ -71,4 +121,8 @@ void SettingsScreen::HandleSelection(int selected_option) {
 void SettingsScreen::UpdateGlobalSettings() {
     // 将当前设置状态同步到全局设置
     GlobalSettings::SetAIEnabled(ai_toggle_selected_ == 1);
+    GlobalSettings::SetBinarySaveEnabled(save_format_selected_ == 1);
+    GlobalSettings::SetSaveCompressionEnabled(save_compression_selected_ == 1);
+    GlobalSettings::SetAutosaveIntervalSeconds(kAutosaveIntervals[autosave_interval_selected_]);
+    GlobalSettings::SetSlotStoreEnabled(slot_store_selected_ == 1);
 }
@@ -1,6 +1,6 @@
 // =============================================
 // 文件: settings.hpp
-// 描述: 设置界面声明。提供AI开关等设置选项。
+// 描述: 设置界面声明。提供AI开关、存档格式等设置选项。
 // =============================================
 
 #ifndef CPP_MUD_OUC_SETTINGS_HPP
@@ -25,6 +25,18 @@ private:
     std::string source_screen_; // 来源界面名称
     int ai_toggle_selected_ = 0; // AI开关状态，0=禁用，1=启用
     std::vector<std::string> ai_toggle_options_; // AI开关选项
+    ftxui::Component save_format_toggle_;
+    int save_format_selected_ = 0; // 存档格式，0=JSON，1=二进制
+    std::vector<std::string> save_format_options_;
+    ftxui::Component save_compression_toggle_;
+    int save_compression_selected_ = 1; // 存档压缩，0=不压缩，1=压缩
+    std::vector<std::string> save_compression_options_;
+    ftxui::Component autosave_interval_toggle_;
+    int autosave_interval_selected_ = 2; // 自动保存间隔，下标对应 kAutosaveIntervals
+    std::vector<std::string> autosave_interval_options_;
+    ftxui::Component slot_store_toggle_;
+    int slot_store_selected_ = 0; // 存档存放方式，0=目录，1=单文件容器
+    std::vector<std::string> slot_store_options_;
 };
 
 
@@ -10,11 +10,20 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <iterator>
 #include "../../core/game.h"
 #include "../../core/item.h"
+#include "../../core/item_catalog.h"
 
 class Game;
 
+// 兑换配方：消耗材料换取目录中的物品
+struct ShopRecipe {
+    const char* reward;   // 兑换所得物品名（物品目录中的名称）
+    const char* cost;     // 消耗材料名（物品目录中的名称）
+    int costCount;
+};
+
 class ShopScreen : public BaseScreen {
 public:
     explicit ShopScreen(Game* game) : game_(game) {
@@ -81,11 +90,16 @@ private:
     void ConfirmPurchase();
 
     std::vector<ftxui::Element> RenderMaterialCounts();
-    void HandleBuyTwoStar();
-    void HandleBuyThreeStar();
-    bool ConsumeMaterial(const std::string& name);
-    void GiveWeapon(const std::string& name, Rarity rarity);
+    void HandleBuy(const ShopRecipe& recipe);
+    bool ConsumeMaterial(const std::string& name, int count);
+    void GiveItem(const std::string& name);
     int CountItem(const std::string& name);
+    static std::string StarLabel(const std::string& name);
+
+    static constexpr ShopRecipe kRecipes[] = {
+        {"铁影阔剑", "史莱姆凝液", 1},
+        {"飞天御剑", "史莱姆原浆", 1},
+    };
 
     Game* game_;
     ftxui::Component component_;
@@ -98,19 +112,22 @@ private:
 };
 
 // ==== Inline implementations (simple glue with game/inventory) ====
+inline std::string ShopScreen::StarLabel(const std::string& name) {
+    const ItemDefinition* definition = ItemCatalog::instance().find(name);
+    int stars = definition ? static_cast<int>(definition->rarity) : 0;
+    return std::to_string(stars) + "★";
+}
+
 inline std::vector<ftxui::Element> ShopScreen::RenderMaterialCounts() {
     using namespace ftxui;
     std::vector<Element> out;
     if (!game_) return out;
-    const auto& items = game_->getPlayer().inventory.getAllItems();
-    int slime_condensate = 0;   // 1★ 史莱姆凝液
-    int slime_secretions = 0;   // 2★ 史莱姆原浆
-    for (auto& it : items) {
-        if (it->getName() == "史莱姆凝液") slime_condensate += it->getQuantity();
-        if (it->getName() == "史莱姆原浆") slime_secretions += it->getQuantity();
+    for (const auto& recipe : kRecipes) {
+        auto definition = ItemCatalog::instance().find(recipe.cost);
+        Color stock_color = (definition && definition->rarity == Rarity::ONE_STAR) ? Color::Green : Color::Yellow;
+        out.push_back(text("库存：" + StarLabel(recipe.cost) + " " + recipe.cost + " ×" +
+                           std::to_string(CountItem(recipe.cost))) | color(stock_color));
     }
-    out.push_back(text("库存：1★ 史莱姆凝液 ×" + std::to_string(slime_condensate)) | color(Color::Green));
-    out.push_back(text("库存：2★ 史莱姆原浆 ×" + std::to_string(slime_secretions)) | color(Color::Yellow));
     return out;
 }
 
@@ -121,49 +138,40 @@ inline int ShopScreen::CountItem(const std::string& name) {
     return total;
 }
 
-inline bool ShopScreen::ConsumeMaterial(const std::string& name) {
+inline bool ShopScreen::ConsumeMaterial(const std::string& name, int count) {
     auto& inv = game_->getPlayer().inventory;
-    if (CountItem(name) <= 0) return false;
-    auto res = inv.removeItem(name, 1);
+    if (CountItem(name) < count) return false;
+    auto res = inv.removeItem(name, count);
     return res == InventoryResult::SUCCESS;
 }
 
-inline void ShopScreen::GiveWeapon(const std::string& name, Rarity rarity) {
-    auto weapon = ItemFactory::createWeapon(name, WeaponType::ONE_HANDED_SWORD, rarity);
-    weapon->setQuantity(1);
-    game_->getPlayer().addItemToInventory(weapon);
-}
-
-inline void ShopScreen::HandleBuyTwoStar() {
-    // 1★ 史莱姆凝液 → 2★ 武器
-    if (!ConsumeMaterial("史莱姆凝液")) {
-        status_message_ = "材料不足：需要 1★ 史莱姆凝液 ×1";
-        return;
+inline void ShopScreen::GiveItem(const std::string& name) {
+    auto item = ItemCatalog::instance().create(name);
+    if (item) {
+        game_->getPlayer().addItemToInventory(item);
     }
-    GiveWeapon("铁影阔剑", Rarity::TWO_STAR);
-    status_message_ = "兑换成功：获得 2★ 武器『铁影阔剑』";
 }
 
-inline void ShopScreen::HandleBuyThreeStar() {
-    // 2★ 史莱姆原浆 → 3★ 武器
-    if (!ConsumeMaterial("史莱姆原浆")) {
-        status_message_ = "材料不足：需要 2★ 史莱姆原浆 ×1";
+inline void ShopScreen::HandleBuy(const ShopRecipe& recipe) {
+    if (!ConsumeMaterial(recipe.cost, recipe.costCount)) {
+        status_message_ = "材料不足：需要 " + StarLabel(recipe.cost) + " " + recipe.cost +
+                          " ×" + std::to_string(recipe.costCount);
         return;
     }
-    GiveWeapon("飞天御剑", Rarity::THREE_STAR);
-    status_message_ = "兑换成功：获得 3★ 武器『飞天御剑』";
+    GiveItem(recipe.reward);
+    status_message_ = "兑换成功：获得 " + StarLabel(recipe.reward) + " 武器『" + recipe.reward + "』";
 }
 
 inline void ShopScreen::BuildMenuEntries() {
     menu_entries_.clear();
-    bool can_buy_2 = CountItem("史莱姆凝液") >= 1;
-    bool can_buy_3 = CountItem("史莱姆原浆") >= 1;
 
     // 使用颜色标签增强可视：可购买项前缀加上指示
-    std::string entry2 = std::string(can_buy_2 ? "[可兑换] " : "[材料不足] ") + "2★ 铁影阔剑  | 消耗：1★ 史莱姆凝液 ×1";
-    std::string entry3 = std::string(can_buy_3 ? "[可兑换] " : "[材料不足] ") + "3★ 飞天御剑  | 消耗：2★ 史莱姆原浆 ×1";
-    menu_entries_.push_back(entry2);
-    menu_entries_.push_back(entry3);
+    for (const auto& recipe : kRecipes) {
+        bool can_buy = CountItem(recipe.cost) >= recipe.costCount;
+        menu_entries_.push_back(std::string(can_buy ? "[可兑换] " : "[材料不足] ") +
+                                StarLabel(recipe.reward) + " " + recipe.reward + "  | 消耗：" +
+                                StarLabel(recipe.cost) + " " + recipe.cost + " ×" + std::to_string(recipe.costCount));
+    }
 
     // 防止越界
     if (selected_index_ < 0) selected_index_ = 0;
@@ -171,12 +179,7 @@ inline void ShopScreen::BuildMenuEntries() {
 }
 
 inline void ShopScreen::ConfirmPurchase() {
-    if (selected_index_ == 0) {
-        HandleBuyTwoStar();
-    } else if (selected_index_ == 1) {
-        HandleBuyThreeStar();
+    if (selected_index_ >= 0 && selected_index_ < static_cast<int>(std::size(kRecipes))) {
+        HandleBuy(kRecipes[selected_index_]);
     }
 }
-
-
-
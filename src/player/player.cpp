@@ -4,6 +4,7 @@
 // =============================================
 #include "player.h"
 #include "../core/item.h"
+#include <algorithm>
 
 Player::Player(std::string name, int startX, int startY)
     : name(name), x(startX), y(startY), level(1), experience(0),
@@ -17,6 +18,10 @@ InventoryResult Player::addItemToInventory(std::shared_ptr<Item> item) {
     return inventory.addItem(item);
 }
 
+InventoryResult Player::addItemsToInventory(const std::vector<std::shared_ptr<Item>>& items) {
+    return inventory.addItems(items);
+}
+
 InventoryResult Player::removeItemFromInventory(const std::string& itemName, int quantity) {
     return inventory.removeItem(itemName, quantity);
 }
@@ -27,6 +32,7 @@ void Player::addTeamMember(const std::string& name, int level) {
     // 新成员加入队伍时，自动设为上场角色
     member->setStatus(MemberStatus::ACTIVE);
     activeMember = member;
+    version_.bump();
 }
 
 void Player::setActiveMember(int index) {
@@ -34,6 +40,7 @@ void Player::setActiveMember(int index) {
         auto member = teamMembers[index];
         if (member->isActive()) {
             activeMember = member;
+            version_.bump();
         }
     }
 }
@@ -127,6 +134,7 @@ bool Player::switchToNextActiveMember() {
     // 切换到下一个
     int nextIndex = (currentIndex + 1) % activeMembers.size();
     activeMember = activeMembers[nextIndex];
+    version_.bump();
     return true;
 }
 
@@ -148,6 +156,7 @@ bool Player::switchToPreviousActiveMember() {
     // 切换到上一个
     int prevIndex = (currentIndex - 1 + activeMembers.size()) % activeMembers.size();
     activeMember = activeMembers[prevIndex];
+    version_.bump();
     return true;
 }
 
@@ -159,6 +168,7 @@ bool Player::switchToMember(int index) {
     auto member = teamMembers[index];
     if (member->isActive()) {
         activeMember = member;
+        version_.bump();
         return true;
     }
     
@@ -189,6 +199,7 @@ InventoryResult Player::useItem(const std::string& itemName) {
                     case FoodType::ADVENTURE:
                         // 冒险类效果可以增加经验或其他冒险属性
                         experience += food->getEffectValue();
+                        version_.bump();
                         break;
                 }
             }
@@ -316,4 +327,13 @@ void Player::heal(int amount) {
 
 bool Player::isAlive() const {
     return activeMember && activeMember->isAlive();
-}
\ No newline at end of file
+}
+
+// 可存档状态的版本：玩家标量、背包与各队伍成员版本中的最大值
+uint64_t Player::getStateVersion() const {
+    uint64_t version = std::max(version_.get(), inventory.getVersion());
+    for (const auto& member : teamMembers) {
+        version = std::max(version, member->getVersion());
+    }
+    return version;
+}
@@ -8,6 +8,7 @@
 #include <vector>
 #include "../core/inventory.h"
 #include "../core/team_member.h"
+#include "../core/state_version.h"
 
 // 玩家数据与操作
 class Player {
@@ -47,6 +48,7 @@ public:
 
     // 物品管理 ---------------------------------------------------------------
     InventoryResult addItemToInventory(std::shared_ptr<Item> item);
+    InventoryResult addItemsToInventory(const std::vector<std::shared_ptr<Item>>& items);
     InventoryResult removeItemFromInventory(const std::string& itemName, int quantity = 1);
     InventoryResult useItem(const std::string& itemName);
 
@@ -64,4 +66,13 @@ public:
     void takeDamage(int damage);
     void heal(int amount);
     bool isAlive() const;
+
+    // 状态版本 ---------------------------------------------------------------
+    // 取自身、背包与各队伍成员版本的最大值，任一处被修改都会增大（见 state_version.h）。
+    // 直接改写公开字段（坐标、等级、经验等）后需调用 markModified
+    uint64_t getStateVersion() const;
+    void markModified() { version_.bump(); }
+
+private:
+    StateVersion version_;
 };
\ No newline at end of file
@@ -0,0 +1,266 @@
+// =============================================
+// 文件: async_save_writer.cpp
+// 描述: 后台存档写入器实现：工作线程、请求合并与原子写文件。
+// =============================================
+#include "async_save_writer.h"
+#include <algorithm>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+AsyncSaveWriter::~AsyncSaveWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    jobAvailable_.notify_all();
+    // 退出前写完剩余请求，避免丢失最后一次存档
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void AsyncSaveWriter::submit(const std::string& filePath, std::string data, Completion onComplete,
+                             bool keepBackup) {
+    enqueue(filePath, std::move(data), false, keepBackup, std::move(onComplete));
+}
+
+void AsyncSaveWriter::submitAppend(const std::string& filePath, std::string data, Completion onComplete) {
+    enqueue(filePath, std::move(data), true, false, std::move(onComplete));
+}
+
+void AsyncSaveWriter::enqueue(const std::string& filePath, std::string data, bool append, bool keepBackup,
+                              Completion onComplete) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_.find(filePath);
+        if (it == pending_.end()) {
+            it = pending_.emplace(filePath, Job{}).first;
+            it->second.append = append;
+            it->second.keepBackup = keepBackup;
+            it->second.data = std::move(data);
+            order_.push_back(filePath);
+        } else if (append) {
+            // 追加内容接在排队数据之后，替换/追加的性质不变
+            it->second.data += data;
+        } else {
+            // 旧数据直接丢弃，只写最新状态；并移到队尾，
+            // 保证与之后提交的其他文件保持提交顺序（如先写快照、再重置日志）
+            it->second.data = std::move(data);
+            it->second.append = false;
+            it->second.keepBackup = keepBackup;
+            order_.erase(std::find(order_.begin(), order_.end(), filePath));
+            order_.push_back(filePath);
+        }
+        if (onComplete) {
+            it->second.completions.push_back(std::move(onComplete));
+        }
+        if (!worker_.joinable()) {
+            worker_ = std::thread(&AsyncSaveWriter::workerLoop, this);
+        }
+    }
+    jobAvailable_.notify_one();
+}
+
+void AsyncSaveWriter::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return order_.empty() && !busy_; });
+}
+
+size_t AsyncSaveWriter::dispatchCompletions() {
+    std::vector<Finished> finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished.swap(finished_);
+    }
+    for (Finished& entry : finished) {
+        entry.completion(entry.success, entry.error);
+    }
+    return finished.size();
+}
+
+void AsyncSaveWriter::setNotifier(std::function<void()> notifier) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    notifier_ = std::move(notifier);
+}
+
+void AsyncSaveWriter::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        jobAvailable_.wait(lock, [this] { return stopping_ || !order_.empty(); });
+        if (order_.empty()) {
+            return; // stopping_ 且已无待写请求
+        }
+
+        std::string filePath = std::move(order_.front());
+        order_.pop_front();
+        auto node = pending_.extract(filePath);
+        Job job = std::move(node.mapped());
+        busy_ = true;
+
+        lock.unlock();
+        std::string error;
+        bool success = job.append ? appendFile(filePath, job.data, &error)
+                                  : writeFileAtomically(filePath, job.data, job.keepBackup, &error);
+        lock.lock();
+
+        busy_ = false;
+        for (auto& completion : job.completions) {
+            finished_.push_back({std::move(completion), success, error});
+        }
+        std::function<void()> notifier = notifier_;
+        bool hasCompletions = !job.completions.empty();
+        if (order_.empty()) {
+            idle_.notify_all();
+        }
+
+        if (hasCompletions && notifier) {
+            lock.unlock();
+            notifier();
+            lock.lock();
+        }
+    }
+}
+
+namespace {
+
+// 写入全部数据并刷到磁盘
+#ifdef _WIN32
+bool writeAll(int fd, const std::string& data) {
+    const char* cursor = data.data();
+    size_t remaining = data.size();
+    while (remaining > 0) {
+        int written = _write(fd, cursor, static_cast<unsigned int>(remaining));
+        if (written <= 0) {
+            return false;
+        }
+        cursor += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    return _commit(fd) == 0;
+}
+#else
+bool writeAll(int fd, const std::string& data) {
+    const char* cursor = data.data();
+    size_t remaining = data.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(fd, cursor, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        cursor += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    return ::fsync(fd) == 0;
+}
+#endif
+
+void setError(std::string* error, const std::string& message) {
+    if (error) {
+        *error = message;
+    }
+}
+
+} // namespace
+
+bool AsyncSaveWriter::writeFileAtomically(const std::string& filePath, const std::string& data, bool keepBackup,
+                                          std::string* error) {
+    std::string tempPath = filePath + ".tmp";
+
+#ifdef _WIN32
+    int fd = _open(tempPath.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    if (fd < 0) {
+        setError(error, "无法创建临时存档文件: " + tempPath);
+        return false;
+    }
+    bool ok = writeAll(fd, data);
+    ok = (_close(fd) == 0) && ok;
+#else
+    int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        setError(error, "无法创建临时存档文件: " + tempPath);
+        return false;
+    }
+    // 数据落盘后才能替换，否则断电后可能得到空文件
+    bool ok = writeAll(fd, data);
+    ok = (::close(fd) == 0) && ok;
+#endif
+
+    std::error_code fsError;
+    if (!ok) {
+        setError(error, "写入临时存档文件失败: " + tempPath);
+        std::filesystem::remove(tempPath, fsError);
+        return false;
+    }
+
+    // 新数据已落盘后再轮换备份：先建硬链接（不支持时复制）再重命名为备份，
+    // 旧文件始终可用，备份失败也不影响本次写入
+    if (keepBackup && std::filesystem::exists(filePath, fsError)) {
+        std::string backupPath = backupPathFor(filePath);
+        std::string backupTemp = backupPath + ".tmp";
+        std::filesystem::remove(backupTemp, fsError);
+        std::filesystem::create_hard_link(filePath, backupTemp, fsError);
+        if (fsError) {
+            std::filesystem::copy_file(filePath, backupTemp, std::filesystem::copy_options::overwrite_existing, fsError);
+        }
+        if (!fsError) {
+            std::filesystem::rename(backupTemp, backupPath, fsError);
+        }
+        if (fsError) {
+            setError(error, "无法保留存档备份: " + backupPath + " (" + fsError.message() + ")");
+            std::filesystem::remove(backupTemp, fsError);
+        }
+    }
+
+    // rename 在同一目录内是原子的：读者只会看到完整的旧文件或新文件
+    std::filesystem::rename(tempPath, filePath, fsError);
+    if (fsError) {
+        setError(error, "替换存档文件失败: " + filePath + " (" + fsError.message() + ")");
+        std::filesystem::remove(tempPath, fsError);
+        return false;
+    }
+
+#ifndef _WIN32
+    // 同步目录项，确保重命名本身也已持久化
+    std::string directory = std::filesystem::path(filePath).parent_path().string();
+    int dirFd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+    if (dirFd >= 0) {
+        ::fsync(dirFd);
+        ::close(dirFd);
+    }
+#endif
+    return true;
+}
+
+bool AsyncSaveWriter::appendFile(const std::string& filePath, const std::string& data, std::string* error) {
+#ifdef _WIN32
+    int fd = _open(filePath.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int fd = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+#endif
+    if (fd < 0) {
+        setError(error, "无法打开文件进行追加: " + filePath);
+        return false;
+    }
+    bool ok = writeAll(fd, data);
+#ifdef _WIN32
+    ok = (_close(fd) == 0) && ok;
+#else
+    ok = (::close(fd) == 0) && ok;
+#endif
+    if (!ok) {
+        setError(error, "追加写入失败: " + filePath);
+    }
+    return ok;
+}
@@ -0,0 +1,90 @@
+// =============================================
+// 文件: async_save_writer.h
+// 描述: 后台存档写入器。序列化在调用线程完成，写盘交给工作线程：
+//       先写临时文件并 fsync，再原子重命名覆盖目标文件，崩溃时
+//       旧存档保持完整；可选在替换前把旧文件保留为 <文件>.bak。
+//       同一文件排队中的多次请求会合并，只写入最新数据。
+//       追加请求（存档日志）按顺序拼接后一次写入并 fsync。
+// 说明: 完成回调不在工作线程执行，而是积压到队列，由 UI 线程调用
+//       dispatchCompletions() 统一派发；setNotifier 用于唤醒 UI 线程。
+//       工作线程不向终端输出（终端由界面占用），失败原因随完成回调交给调用方。
+// =============================================
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class AsyncSaveWriter {
+public:
+    // 完成回调：参数为是否写入成功与失败原因；写入成功但未能保留备份时也给出原因，
+    // 其余成功情况为空
+    using Completion = std::function<void(bool success, const std::string& error)>;
+
+    AsyncSaveWriter() = default;
+    ~AsyncSaveWriter();
+
+    AsyncSaveWriter(const AsyncSaveWriter&) = delete;
+    AsyncSaveWriter& operator=(const AsyncSaveWriter&) = delete;
+
+    // 提交写入请求；若同一路径已有请求在排队，则替换其数据，
+    // 两次请求的回调都会收到最终那次写入的结果。keepBackup 见 writeFileAtomically
+    void submit(const std::string& filePath, std::string data, Completion onComplete = nullptr,
+                bool keepBackup = false);
+
+    // 提交追加请求：数据追加到文件末尾。排队中的同路径请求会与之拼接
+    // （排队的是整文件替换时，追加内容并入替换数据）
+    void submitAppend(const std::string& filePath, std::string data, Completion onComplete = nullptr);
+
+    // 阻塞直到所有已提交的写入完成（同步读写存档前调用，保证顺序）
+    void waitIdle();
+
+    // 在 UI 线程派发已完成写入的回调，返回派发数量
+    size_t dispatchCompletions();
+
+    // 有写入完成时调用（在工作线程上），通常用于向 UI 线程投递任务
+    void setNotifier(std::function<void()> notifier);
+
+    // 原子写文件：临时文件 + fsync + rename，失败时目标文件不受影响。
+    // keepBackup 为 true 时，替换前把现有文件保留为 backupPathFor(filePath)
+    // （硬链接后重命名，目标文件在任何时刻都存在）。
+    // error 非空时写入失败原因；保留备份失败不算写入失败，原因同样写入 error
+    static bool writeFileAtomically(const std::string& filePath, const std::string& data, bool keepBackup = false,
+                                    std::string* error = nullptr);
+    static std::string backupPathFor(const std::string& filePath) { return filePath + ".bak"; }
+
+    // 追加写文件并 fsync；文件不存在时创建。error 同 writeFileAtomically
+    static bool appendFile(const std::string& filePath, const std::string& data, std::string* error = nullptr);
+
+private:
+    struct Job {
+        std::string data;
+        bool append = false;
+        bool keepBackup = false;
+        std::vector<Completion> completions;
+    };
+
+    void enqueue(const std::string& filePath, std::string data, bool append, bool keepBackup,
+                 Completion onComplete);
+    void workerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    std::condition_variable idle_;
+    std::deque<std::string> order_;                  // 待写路径（先到先写）
+    std::unordered_map<std::string, Job> pending_;   // 路径 -> 最新数据
+    struct Finished {
+        Completion completion;
+        bool success;
+        std::string error;
+    };
+    std::vector<Finished> finished_;
+    std::function<void()> notifier_;
+    std::thread worker_;
+    bool busy_ = false;
+    bool stopping_ = false;
+};
@@ -0,0 +1,417 @@
+// =============================================
+// 文件: binary_save.cpp
+// 描述: 二进制存档格式（.sav）的编码与解码。
+// 布局: 文件头 [魔数 "MUDS"][版本 u16][段数 u16]
+//       段表 每项 [标签 u32][偏移 u32][长度 u32][段 CRC32C u32]
+//       校验 [文件头与段表的 CRC32C u32]（版本 1 的段表没有校验值）
+//       段   META（存档摘要）/ PLYR（玩家）/ TEAM（队伍）/ INVT（背包）
+//       整数为变长编码，枚举按序号存储；未知段在读取时忽略，便于向后扩展。
+//       玩家、成员与物品的字段顺序由 save_schema.h 的字段表决定。
+// =============================================
+#include "storage.h"
+#include "byte_stream.h"
+#include "crc32c.h"
+#include "save_codec.h"
+#include "save_schema.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+constexpr char kMagic[4] = {'M', 'U', 'D', 'S'};
+constexpr uint16_t kFormatVersion = 2;      // 版本 2 起各段与段表带 CRC32C
+constexpr size_t kHeaderSize = 8;
+constexpr size_t kSectionEntrySize = 16;
+constexpr size_t kLegacySectionEntrySize = 12;
+
+constexpr uint32_t sectionTag(const char (&name)[5]) {
+    return static_cast<uint32_t>(static_cast<unsigned char>(name[0])) |
+           static_cast<uint32_t>(static_cast<unsigned char>(name[1])) << 8 |
+           static_cast<uint32_t>(static_cast<unsigned char>(name[2])) << 16 |
+           static_cast<uint32_t>(static_cast<unsigned char>(name[3])) << 24;
+}
+
+constexpr uint32_t kSectionMeta = sectionTag("META");
+constexpr uint32_t kSectionPlayer = sectionTag("PLYR");
+constexpr uint32_t kSectionTeam = sectionTag("TEAM");
+constexpr uint32_t kSectionInventory = sectionTag("INVT");
+
+// 背包分块：物品编码的 CRC 低 4 位为 0 时结束一页（平均 16 个物品），每页最多 64 个
+constexpr uint32_t kPageBoundaryMask = 0x0F;
+constexpr size_t kMaxPageItems = 64;
+
+// 成员装备标记位
+constexpr uint8_t kHasWeapon = 0x01;
+constexpr uint8_t kHasArtifact = 0x02;
+
+struct Section {
+    uint32_t tag;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t checksum;
+    bool hasChecksum;
+};
+
+enum class SectionTableStatus {
+    VALID,
+    UNSUPPORTED,    // 不是二进制存档或版本过新
+    CORRUPT         // 段表校验失败或段超出文件范围
+};
+
+} // namespace
+
+// 物品与队伍成员的编码同时供存档日志使用（见 save_codec.h）；字段顺序见 save_schema.h
+void writeItem(ByteWriter& writer, const Item& item) {
+    writeRecord(writer, recordOf(item));
+}
+
+std::shared_ptr<Item> readItem(ByteReader& reader) {
+    ItemRecord record;
+    if (!readRecord(reader, record)) {
+        return nullptr;
+    }
+    return makeItem(record);
+}
+
+void writeTeamMember(ByteWriter& writer, const TeamMember& member) {
+    writeRecord(writer, recordOf(member));
+
+    uint8_t flags = 0;
+    if (member.getEquippedWeapon()) flags |= kHasWeapon;
+    if (member.getEquippedArtifact()) flags |= kHasArtifact;
+    writer.writeU8(flags);
+    if (member.getEquippedWeapon()) {
+        writeItem(writer, *member.getEquippedWeapon());
+    }
+    if (member.getEquippedArtifact()) {
+        writeItem(writer, *member.getEquippedArtifact());
+    }
+}
+
+std::shared_ptr<TeamMember> readTeamMember(ByteReader& reader) {
+    MemberRecord record;
+    bool valid = readRecord(reader, record);
+    uint8_t flags = reader.readU8();
+    if (!valid || !reader.ok()) {
+        return nullptr;
+    }
+
+    // 状态随记录一起恢复，装备不会改变状态
+    auto member = makeMember(record);
+
+    if (flags & kHasWeapon) {
+        auto weapon = std::dynamic_pointer_cast<Weapon>(readItem(reader));
+        if (!weapon) {
+            return nullptr;
+        }
+        member->equipWeapon(weapon);
+    }
+    if (flags & kHasArtifact) {
+        auto artifact = std::dynamic_pointer_cast<Artifact>(readItem(reader));
+        if (!artifact) {
+            return nullptr;
+        }
+        member->equipArtifact(artifact);
+    }
+    return member;
+}
+
+namespace {
+
+// 解析文件头与段表并校验段表本身；各段内容的校验见 sectionIntact
+SectionTableStatus readSections(const char* data, size_t size, std::vector<Section>& sections) {
+    ByteReader reader(data, size);
+    for (char expected : kMagic) {
+        if (static_cast<char>(reader.readU8()) != expected) {
+            return SectionTableStatus::UNSUPPORTED;
+        }
+    }
+    uint16_t version = reader.readU16();
+    uint16_t sectionCount = reader.readU16();
+    if (!reader.ok() || version == 0 || version > kFormatVersion) {
+        return SectionTableStatus::UNSUPPORTED;
+    }
+
+    bool hasChecksum = version >= 2;
+    sections.clear();
+    for (uint16_t i = 0; i < sectionCount; ++i) {
+        Section section{reader.readU32(), reader.readU32(), reader.readU32(), 0, hasChecksum};
+        if (hasChecksum) {
+            section.checksum = reader.readU32();
+        }
+        if (!reader.ok() || section.offset > size || section.length > size - section.offset) {
+            return SectionTableStatus::CORRUPT;
+        }
+        sections.push_back(section);
+    }
+    if (hasChecksum) {
+        size_t tableEnd = reader.position();
+        uint32_t expected = reader.readU32();
+        if (!reader.ok() || Crc32c::compute(data, tableEnd) != expected) {
+            return SectionTableStatus::CORRUPT;
+        }
+    }
+    return SectionTableStatus::VALID;
+}
+
+bool sectionIntact(const char* data, const Section& section) {
+    return !section.hasChecksum || Crc32c::compute(data + section.offset, section.length) == section.checksum;
+}
+
+bool allSectionsIntact(const char* data, const std::vector<Section>& sections) {
+    for (const auto& section : sections) {
+        if (!sectionIntact(data, section)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const Section* findSection(const std::vector<Section>& sections, uint32_t tag) {
+    for (const auto& section : sections) {
+        if (section.tag == tag) {
+            return &section;
+        }
+    }
+    return nullptr;
+}
+
+ByteReader sectionReader(const char* data, const Section& section) {
+    return ByteReader(data + section.offset, section.length);
+}
+
+// 读取 META 段，返回其中记录的区块 ID
+int readMeta(ByteReader& reader, GameSave::SaveInfo& info) {
+    info.saveTime = reader.readString();
+    info.playerName = reader.readString();
+    info.level = static_cast<int>(reader.readVarInt());
+    info.x = static_cast<int>(reader.readVarInt());
+    info.y = static_cast<int>(reader.readVarInt());
+    info.teamSize = static_cast<int>(reader.readVarUint());
+    info.inventorySize = static_cast<int>(reader.readVarUint());
+    return static_cast<int>(reader.readVarInt());
+}
+
+} // namespace
+
+bool GameSave::isBinarySave(const std::string& data) {
+    return isBinarySave(data.data(), data.size());
+}
+
+bool GameSave::isBinarySave(const char* data, size_t size) {
+    return size >= kHeaderSize && std::equal(kMagic, kMagic + sizeof(kMagic), data);
+}
+
+void GameSave::encodeBinary(const Player& player, int currentBlockId, const std::string& saveTime,
+                            std::string& out, std::vector<size_t>* chunkEnds) const {
+    const uint32_t tags[] = {kSectionMeta, kSectionPlayer, kSectionTeam, kSectionInventory};
+    constexpr uint16_t sectionCount = sizeof(tags) / sizeof(tags[0]);
+
+    out.clear();
+    out.reserve(256 + player.inventory.getCurrentSize() * 48);
+    ByteWriter writer(out);
+    writer.writeBytes(kMagic, sizeof(kMagic));
+    writer.writeU16(kFormatVersion);
+    writer.writeU16(sectionCount);
+
+    // 段表与其校验值先占位，写完各段后回填偏移、长度与校验值
+    size_t tableStart = writer.size();
+    for (uint32_t tag : tags) {
+        writer.writeU32(tag);
+        writer.writeU32(0);
+        writer.writeU32(0);
+        writer.writeU32(0);
+    }
+    size_t tableEnd = writer.size();
+    writer.writeU32(0);
+    // 分块边界：文件头到队伍人数为一块（含每次都变的保存时间与校验值），之后每个成员、
+    // 背包容量与物品数、每页物品各为一块
+    auto endChunk = [&]() {
+        if (chunkEnds) {
+            chunkEnds->push_back(writer.size());
+        }
+    };
+
+    auto inventoryItems = player.inventory.getAllItems();
+
+    for (uint16_t index = 0; index < sectionCount; ++index) {
+        size_t start = writer.size();
+        switch (tags[index]) {
+            case kSectionMeta:
+                // 存档列表只需读取本段
+                writer.writeString(saveTime);
+                writer.writeString(player.name);
+                writer.writeVarInt(player.level);
+                writer.writeVarInt(player.x);
+                writer.writeVarInt(player.y);
+                writer.writeVarUint(player.teamMembers.size());
+                writer.writeVarUint(inventoryItems.size());
+                writer.writeVarInt(currentBlockId);
+                break;
+            case kSectionPlayer:
+                writeRecord(writer, recordOf(player));
+                break;
+            case kSectionTeam:
+                writer.writeVarUint(player.teamMembers.size());
+                endChunk();
+                for (const auto& member : player.teamMembers) {
+                    writeTeamMember(writer, *member);
+                    endChunk();
+                }
+                break;
+            case kSectionInventory:
+                writer.writeVarUint(player.inventory.getMaxCapacity());
+                writer.writeVarUint(inventoryItems.size());
+                endChunk();   // 物品数随增减变化，单独成块以免牵连第一页
+                // 按内容切页：页尾由物品编码决定，插入或移除物品只影响所在的页
+                size_t pageStart = writer.size();
+                size_t pageItems = 0;
+                for (const auto& item : inventoryItems) {
+                    size_t itemStart = writer.size();
+                    writeItem(writer, *item);
+                    uint32_t itemHash = Crc32c::compute(out.data() + itemStart, writer.size() - itemStart);
+                    if (++pageItems >= kMaxPageItems || (itemHash & kPageBoundaryMask) == 0) {
+                        endChunk();
+                        pageStart = writer.size();
+                        pageItems = 0;
+                    }
+                }
+                if (writer.size() > pageStart) {
+                    endChunk();
+                }
+                break;
+        }
+        size_t entry = tableStart + index * kSectionEntrySize;
+        writer.patchU32(entry + 4, static_cast<uint32_t>(start));
+        writer.patchU32(entry + 8, static_cast<uint32_t>(writer.size() - start));
+        writer.patchU32(entry + 12, Crc32c::compute(out.data() + start, writer.size() - start));
+    }
+    writer.patchU32(tableEnd, Crc32c::compute(out.data(), tableEnd));
+}
+
+SaveResult GameSave::decodeBinary(const std::shared_ptr<const MappedFile>& image, Player& player,
+                                  int& currentBlockId, std::string& saveTime) const {
+    const char* data = image->data();
+    std::vector<Section> sections;
+    switch (readSections(data, image->size(), sections)) {
+        case SectionTableStatus::VALID:
+            break;
+        case SectionTableStatus::UNSUPPORTED:
+            std::cerr << "二进制存档文件头无效或版本过新" << std::endl;
+            return SaveResult::INVALID_DATA;
+        case SectionTableStatus::CORRUPT:
+            std::cerr << "二进制存档段表校验失败" << std::endl;
+            return SaveResult::CORRUPTED;
+    }
+    // 背包延迟解码，出错时已无法回退，因此加载前校验全部段
+    if (!allSectionsIntact(data, sections)) {
+        std::cerr << "二进制存档数据校验失败" << std::endl;
+        return SaveResult::CORRUPTED;
+    }
+
+    const Section* meta = findSection(sections, kSectionMeta);
+    const Section* playerSection = findSection(sections, kSectionPlayer);
+    if (!meta || !playerSection) {
+        return SaveResult::INVALID_DATA;
+    }
+
+    // 先完整解码到临时对象，数据无效时不改动玩家
+    ByteReader metaReader = sectionReader(data, *meta);
+    SaveInfo info;
+    int blockId = readMeta(metaReader, info);
+
+    ByteReader playerReader = sectionReader(data, *playerSection);
+    PlayerRecord playerRecord;
+    if (!metaReader.ok() || !readRecord(playerReader, playerRecord)) {
+        return SaveResult::INVALID_DATA;
+    }
+
+    std::vector<std::shared_ptr<TeamMember>> members;
+    if (const Section* team = findSection(sections, kSectionTeam)) {
+        ByteReader reader = sectionReader(data, *team);
+        uint64_t count = reader.readVarUint();
+        for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+            auto member = readTeamMember(reader);
+            if (!member) {
+                return SaveResult::INVALID_DATA;
+            }
+            members.push_back(member);
+        }
+        if (!reader.ok()) {
+            return SaveResult::INVALID_DATA;
+        }
+    }
+
+    // 背包段此处只读容量与数量，物品留到首次访问背包时再解码
+    size_t maxCapacity = 100;
+    uint64_t itemCount = 0;
+    size_t itemsOffset = 0;
+    size_t itemsLength = 0;
+    const Section* inventory = findSection(sections, kSectionInventory);
+    if (inventory) {
+        ByteReader reader = sectionReader(data, *inventory);
+        maxCapacity = static_cast<size_t>(reader.readVarUint());
+        itemCount = reader.readVarUint();
+        // 每个物品至少占 5 个字节（类型、稀有度、名称、描述、数量）
+        if (!reader.ok() || itemCount > (inventory->length - reader.position()) / 5) {
+            return SaveResult::INVALID_DATA;
+        }
+        itemsOffset = inventory->offset + reader.position();
+        itemsLength = inventory->length - reader.position();
+    }
+
+    applyRecord(playerRecord, player);
+    player.teamMembers = std::move(members);
+    player.activeMember = nullptr;
+    restoreActiveMember(player, playerRecord.activeMemberIndex);
+    player.inventory.setMaxCapacity(maxCapacity);
+    if (!inventory) {
+        player.inventory.removeAllItems();
+    } else {
+        // 物品数据复制出映射再交给加载器，映射不会活过本次加载：
+        // 存档之后被外部截断时，首次访问背包也不会触发 SIGBUS
+        std::shared_ptr<const MappedFile> items = MappedFile::fromBuffer(std::string(data + itemsOffset, itemsLength));
+        player.inventory.setPendingItems(static_cast<size_t>(itemCount),
+            [items, itemCount]() {
+                std::vector<std::shared_ptr<Item>> decoded;
+                decoded.reserve(static_cast<size_t>(itemCount));
+                ByteReader reader(items->data(), items->size());
+                for (uint64_t i = 0; i < itemCount; ++i) {
+                    auto item = readItem(reader);
+                    if (!item) {
+                        std::cerr << "存档背包数据损坏，已加载 " << i << "/" << itemCount << " 个物品" << std::endl;
+                        break;
+                    }
+                    decoded.push_back(item);
+                }
+                return decoded;
+            });
+    }
+
+    currentBlockId = blockId;
+    saveTime = info.saveTime;
+    return SaveResult::SUCCESS;
+}
+
+bool GameSave::readBinaryInfo(const char* data, size_t size, SaveInfo& info) const {
+    // 摘要只解析 META 段；其余段只做校验，结果随存档索引缓存，不必每次列出时重算
+    std::vector<Section> sections;
+    SectionTableStatus status = readSections(data, size, sections);
+    if (status != SectionTableStatus::VALID) {
+        info.corrupt = status == SectionTableStatus::CORRUPT;
+        return false;
+    }
+    const Section* meta = findSection(sections, kSectionMeta);
+    if (!meta) {
+        return false;
+    }
+    if (!allSectionsIntact(data, sections)) {
+        info.corrupt = true;
+        if (!sectionIntact(data, *meta)) {
+            return false;
+        }
+    }
+    ByteReader reader = sectionReader(data, *meta);
+    readMeta(reader, info);
+    return reader.ok();
+}
@@ -0,0 +1,134 @@
+// =============================================
+// 文件: byte_stream.h
+// 描述: 二进制存档使用的字节流读写工具。
+//       整数采用 LEB128 变长编码（有符号数先做 ZigZag），字符串为 长度 + 字节。
+// =============================================
+#pragma once
+#include <cstdint>
+#include <string>
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::string& out) : out_(out) {}
+
+    void writeU8(uint8_t value) { out_.push_back(static_cast<char>(value)); }
+
+    void writeU16(uint16_t value) {
+        writeU8(static_cast<uint8_t>(value));
+        writeU8(static_cast<uint8_t>(value >> 8));
+    }
+
+    void writeU32(uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            writeU8(static_cast<uint8_t>(value >> shift));
+        }
+    }
+
+    void writeVarUint(uint64_t value) {
+        while (value >= 0x80) {
+            writeU8(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        writeU8(static_cast<uint8_t>(value));
+    }
+
+    void writeVarInt(int64_t value) {
+        writeVarUint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeString(const std::string& value) {
+        writeVarUint(value.size());
+        out_.append(value);
+    }
+
+    void writeBytes(const char* data, size_t size) { out_.append(data, size); }
+
+    // 在指定位置回填 32 位小端整数（用于先占位后写入的偏移/长度）
+    void patchU32(size_t position, uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            out_[position + i] = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    size_t size() const { return out_.size(); }
+
+private:
+    std::string& out_;
+};
+
+// 读取失败（越界、变长整数过长）后 ok() 返回 false，后续读取均返回零值
+class ByteReader {
+public:
+    ByteReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+    bool ok() const { return ok_; }
+    bool atEnd() const { return position_ >= size_; }
+    size_t position() const { return position_; }
+
+    uint8_t readU8() {
+        if (!require(1)) return 0;
+        return static_cast<uint8_t>(data_[position_++]);
+    }
+
+    uint16_t readU16() {
+        uint16_t low = readU8();
+        uint16_t high = readU8();
+        return static_cast<uint16_t>(low | (high << 8));
+    }
+
+    uint32_t readU32() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            value |= static_cast<uint32_t>(readU8()) << shift;
+        }
+        return value;
+    }
+
+    uint64_t readVarUint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = readU8();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        ok_ = false;
+        return 0;
+    }
+
+    int64_t readVarInt() {
+        uint64_t raw = readVarUint();
+        return static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+    }
+
+    std::string readString() {
+        uint64_t length = readVarUint();
+        if (!require(length)) return std::string();
+        std::string value(data_ + position_, static_cast<size_t>(length));
+        position_ += static_cast<size_t>(length);
+        return value;
+    }
+
+    // 跳过 count 个字节并返回其起始指针（不复制）；越界时返回 nullptr
+    const char* readBytes(uint64_t count) {
+        if (!require(count)) return nullptr;
+        const char* bytes = data_ + position_;
+        position_ += static_cast<size_t>(count);
+        return bytes;
+    }
+
+private:
+    bool require(uint64_t count) {
+        if (!ok_ || count > size_ - position_) {
+            ok_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    const char* data_;
+    size_t size_;
+    size_t position_ = 0;
+    bool ok_ = true;
+};
@@ -0,0 +1,148 @@
+// =============================================
+// 文件: crc32c.cpp
+// 描述: CRC32C 实现。运行时检测一次 CPU 特性并选定实现。
+// =============================================
+#include "crc32c.h"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MUD_CRC32C_X86 1
+#include <nmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace {
+
+constexpr uint32_t kPolynomial = 0x82F63B78;   // CRC32C 反射多项式
+
+// slicing-by-8 查表：tables[k][b] 为字节 b 之后再跟 k 个零字节的余数
+constexpr std::array<std::array<uint32_t, 256>, 8> makeTables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t byte = 0; byte < 256; ++byte) {
+        uint32_t crc = byte;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+        }
+        tables[0][byte] = crc;
+    }
+    for (uint32_t byte = 0; byte < 256; ++byte) {
+        for (size_t k = 1; k < 8; ++k) {
+            uint32_t previous = tables[k - 1][byte];
+            tables[k][byte] = (previous >> 8) ^ tables[0][previous & 0xFF];
+        }
+    }
+    return tables;
+}
+
+constexpr auto kTables = makeTables();
+
+uint32_t computeSoftware(uint32_t crc, const unsigned char* data, size_t size) {
+    while (size > 0 && (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+        crc = (crc >> 8) ^ kTables[0][(crc ^ *data++) & 0xFF];
+        --size;
+    }
+    while (size >= 8) {
+        uint32_t low, high;
+        std::memcpy(&low, data, 4);
+        std::memcpy(&high, data + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        low = __builtin_bswap32(low);
+        high = __builtin_bswap32(high);
+#endif
+        low ^= crc;
+        crc = kTables[7][low & 0xFF] ^ kTables[6][(low >> 8) & 0xFF] ^
+              kTables[5][(low >> 16) & 0xFF] ^ kTables[4][low >> 24] ^
+              kTables[3][high & 0xFF] ^ kTables[2][(high >> 8) & 0xFF] ^
+              kTables[1][(high >> 16) & 0xFF] ^ kTables[0][high >> 24];
+        data += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = (crc >> 8) ^ kTables[0][(crc ^ *data++) & 0xFF];
+        --size;
+    }
+    return crc;
+}
+
+#ifdef MUD_CRC32C_X86
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+uint32_t computeHardware(uint32_t crc, const unsigned char* data, size_t size) {
+    while (size > 0 && (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+        crc = _mm_crc32_u8(crc, *data++);
+        --size;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    crc = static_cast<uint32_t>(crc64);
+#endif
+    while (size >= 4) {
+        uint32_t word;
+        std::memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+        data += 4;
+        size -= 4;
+    }
+    while (size > 0) {
+        crc = _mm_crc32_u8(crc, *data++);
+        --size;
+    }
+    return crc;
+}
+
+bool detectSse42() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+#else
+
+bool detectSse42() {
+    return false;
+}
+
+#endif
+
+using ComputeFn = uint32_t (*)(uint32_t, const unsigned char*, size_t);
+
+ComputeFn selectImplementation() {
+#ifdef MUD_CRC32C_X86
+    if (detectSse42()) {
+        return computeHardware;
+    }
+#endif
+    return computeSoftware;
+}
+
+// 局部静态变量保证首次调用时才检测，其他全局对象的初始化中也可安全使用
+ComputeFn implementation() {
+    static const ComputeFn selected = selectImplementation();
+    return selected;
+}
+
+} // namespace
+
+uint32_t Crc32c::compute(const void* data, size_t size, uint32_t crc) {
+    return ~implementation()(~crc, static_cast<const unsigned char*>(data), size);
+}
+
+bool Crc32c::isHardwareAccelerated() {
+    return implementation() != computeSoftware;
+}
@@ -0,0 +1,17 @@
+// =============================================
+// 文件: crc32c.h
+// 描述: CRC32C（Castagnoli）校验，用于存档分段与压缩块的完整性检查。
+//       支持 SSE4.2 的 x86 处理器使用 crc32 指令，其余平台使用 slicing-by-8 查表。
+// =============================================
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+class Crc32c {
+public:
+    // 计算 data 的校验值；crc 为之前片段的结果时可分段续算
+    static uint32_t compute(const void* data, size_t size, uint32_t crc = 0);
+
+    // 当前是否使用硬件指令
+    static bool isHardwareAccelerated();
+};
@@ -0,0 +1,289 @@
+// =============================================
+// 文件: json_load.cpp
+// 描述: JSON 存档的流式加载。基于 nlohmann 的 SAX 接口边读边构造
+//       队伍成员与物品，不构建完整的 JSON DOM：内存只多出存档文本本身，
+//       每个键只在出现时经完美哈希映射一次字段下标。
+// 说明: 玩家、成员与物品的标量字段按 save_schema.h 的字段表赋值，
+//       此处只处理对象的嵌套结构。字段缺省值与保存格式一致；
+//       全部解析成功后才写入玩家，存档损坏时玩家保持不变。
+//       旧版本存档（见 save_migration.h）在同一遍解析中迁移：记录内的键先按计划改名再查字段表，
+//       记录结束时调用修正函数；当前版本的存档没有迁移计划，不做任何额外查找。
+// =============================================
+#include "storage.h"
+#include "save_migration.h"
+#include "save_schema.h"
+#include <iostream>
+#include <limits>
+
+namespace {
+
+// 表示嵌套结构的键（标量字段的键见各记录的字段表）
+enum class Key {
+    PLAYER, CURRENT_BLOCK_ID, SAVE_TIME, FORMAT_VERSION,
+    TEAM_MEMBERS, INVENTORY, EQUIPPED_WEAPON, EQUIPPED_ARTIFACT,
+    MAX_CAPACITY, ITEMS,
+    UNKNOWN
+};
+
+constexpr EnumEntry<Key> kKeyEntries[] = {
+    {"player", Key::PLAYER}, {"currentBlockId", Key::CURRENT_BLOCK_ID}, {"saveTime", Key::SAVE_TIME},
+    {"formatVersion", Key::FORMAT_VERSION},
+    {"teamMembers", Key::TEAM_MEMBERS}, {"inventory", Key::INVENTORY},
+    {"equippedWeapon", Key::EQUIPPED_WEAPON}, {"equippedArtifact", Key::EQUIPPED_ARTIFACT},
+    {"maxCapacity", Key::MAX_CAPACITY}, {"items", Key::ITEMS},
+};
+constexpr EnumNames kKeys{kKeyEntries};
+static_assert(kKeys.valid(), "结构键名重复");
+
+// 解析位置：每进入一个对象/数组压入一层
+enum class Scope {
+    ROOT, PLAYER, TEAM_MEMBERS, MEMBER, INVENTORY, ITEMS, ITEM, FIELD_ARRAY, SKIP
+};
+
+constexpr size_t kNoField = std::numeric_limits<size_t>::max();
+
+struct MemberFields {
+    MemberRecord record;
+    std::shared_ptr<Weapon> weapon;
+    std::shared_ptr<Artifact> artifact;
+};
+
+} // namespace
+
+class GameSave::JsonLoadHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    JsonLoadHandler() = default;
+
+    // 解析结果
+    bool playerFound = false;
+    PlayerRecord player;
+    std::vector<std::shared_ptr<TeamMember>> members;
+    bool inventoryFound = false;
+    size_t maxCapacity = 100;
+    std::vector<std::shared_ptr<Item>> items;
+    int currentBlockId = 0;
+    std::string saveTime;
+
+    bool null() override { return true; }
+    bool boolean(bool value) override {
+        assign(value);
+        return true;
+    }
+    bool number_integer(number_integer_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_float(number_float_t value, const string_t&) override { return integer(static_cast<int64_t>(value)); }
+    bool binary(binary_t&) override { return true; }
+
+    bool string(string_t& value) override {
+        if (top() == Scope::ROOT && key_ == Key::SAVE_TIME) {
+            saveTime = std::move(value);
+        } else {
+            assign(std::move(value));
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        Scope scope = Scope::SKIP;
+        if (scopes_.empty()) {
+            scope = Scope::ROOT;
+        } else if (top() == Scope::ROOT && key_ == Key::PLAYER) {
+            scope = Scope::PLAYER;
+            playerFound = true;
+            if (!versionFound_) {
+                // 版本号写在记录之前；此时仍未读到说明是版本 1 的存档
+                versionFound_ = true;
+                plan_ = MigrationPlan::planFor(kLegacySaveSchemaVersion);
+            }
+        } else if (top() == Scope::PLAYER && key_ == Key::INVENTORY) {
+            scope = Scope::INVENTORY;
+            inventoryFound = true;
+        } else if (top() == Scope::TEAM_MEMBERS) {
+            scope = Scope::MEMBER;
+            member_ = MemberFields{};
+        } else if (top() == Scope::ITEMS ||
+                   (top() == Scope::MEMBER && (key_ == Key::EQUIPPED_WEAPON || key_ == Key::EQUIPPED_ARTIFACT))) {
+            scope = Scope::ITEM;
+            itemOwner_ = top() == Scope::ITEMS ? Key::ITEMS : key_;
+            item_ = ItemRecord{};
+        }
+        scopes_.push_back(scope);
+        key_ = Key::UNKNOWN;
+        field_ = kNoField;
+        return true;
+    }
+
+    bool end_object() override {
+        Scope scope = top();
+        scopes_.pop_back();
+        if (scope == Scope::ITEM) {
+            finishItem();
+        } else if (scope == Scope::MEMBER) {
+            finishMember();
+        } else if (scope == Scope::PLAYER && plan_) {
+            plan_->upgrade(player);
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        Scope scope = Scope::SKIP;
+        if (top() == Scope::PLAYER && key_ == Key::TEAM_MEMBERS) {
+            scope = Scope::TEAM_MEMBERS;
+        } else if (top() == Scope::INVENTORY && key_ == Key::ITEMS) {
+            scope = Scope::ITEMS;
+        } else if (top() == Scope::ITEM && field_ != kNoField) {
+            // 数组字段（如圣遗物副词条），元素逐个追加到该字段
+            scope = Scope::FIELD_ARRAY;
+        }
+        scopes_.push_back(scope);
+        return true;
+    }
+
+    bool end_array() override {
+        scopes_.pop_back();
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        // 先查所在记录的字段表，不是标量字段再查结构键；跳过的子树中不必识别键
+        key_ = Key::UNKNOWN;
+        field_ = kNoField;
+        bool found = false;
+        std::string_view name = value;
+        switch (top()) {
+            case Scope::PLAYER:
+                name = migrate(RecordKind::PLAYER, name);
+                found = jsonFieldIndex(player, name, field_);
+                break;
+            case Scope::MEMBER:
+                name = migrate(RecordKind::MEMBER, name);
+                found = jsonFieldIndex(member_.record, name, field_);
+                break;
+            case Scope::ITEM:
+                name = migrate(RecordKind::ITEM, name);
+                found = jsonFieldIndex(item_, name, field_);
+                break;
+            case Scope::SKIP: return true;
+            default: break;
+        }
+        if (!found) {
+            field_ = kNoField;
+            kKeys.fromString(name, key_);
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& e) override {
+        std::cerr << "存档 JSON 解析失败（位置 " << position << "）: " << e.what() << std::endl;
+        return false;
+    }
+
+private:
+    Scope top() const { return scopes_.empty() ? Scope::SKIP : scopes_.back(); }
+
+    // 记录内的键按迁移计划改名
+    std::string_view migrate(RecordKind kind, std::string_view name) const {
+        return plan_ ? plan_->renameKey(kind, name) : name;
+    }
+
+    // 标量值写入当前记录的当前字段
+    template <typename Value>
+    void assign(Value&& value) {
+        if (field_ == kNoField) {
+            return;
+        }
+        switch (top()) {
+            case Scope::PLAYER: assignJsonField(player, field_, std::forward<Value>(value)); break;
+            case Scope::MEMBER: assignJsonField(member_.record, field_, std::forward<Value>(value)); break;
+            case Scope::ITEM:
+            case Scope::FIELD_ARRAY: assignJsonField(item_, field_, std::forward<Value>(value)); break;
+            default: break;
+        }
+    }
+
+    bool integer(int64_t value) {
+        if (top() == Scope::ROOT && key_ == Key::FORMAT_VERSION) {
+            versionFound_ = true;
+            if (value > kSaveSchemaVersion) {
+                std::cerr << "存档结构版本 " << value << " 比当前程序新，未知字段将被忽略" << std::endl;
+            }
+            plan_ = MigrationPlan::planFor(static_cast<int>(value));
+        } else if (top() == Scope::ROOT && key_ == Key::CURRENT_BLOCK_ID) {
+            currentBlockId = static_cast<int>(value);
+        } else if (top() == Scope::INVENTORY && key_ == Key::MAX_CAPACITY) {
+            maxCapacity = static_cast<size_t>(value);
+        } else {
+            assign(value);
+        }
+        return true;
+    }
+
+    void finishItem() {
+        if (plan_) {
+            plan_->upgrade(item_);
+        }
+        std::shared_ptr<Item> item = makeItem(item_);
+        if (itemOwner_ == Key::ITEMS) {
+            items.push_back(std::move(item));
+        } else if (itemOwner_ == Key::EQUIPPED_WEAPON) {
+            member_.weapon = std::dynamic_pointer_cast<Weapon>(item);
+        } else {
+            member_.artifact = std::dynamic_pointer_cast<Artifact>(item);
+        }
+        // 装备之后成员对象中可能还有其他字段
+        itemOwner_ = Key::UNKNOWN;
+        key_ = Key::UNKNOWN;
+        field_ = kNoField;
+    }
+
+    void finishMember() {
+        if (plan_) {
+            plan_->upgrade(member_.record);
+        }
+        auto member = makeMember(member_.record);
+        if (member_.weapon) {
+            member->equipWeapon(member_.weapon);
+        }
+        if (member_.artifact) {
+            member->equipArtifact(member_.artifact);
+        }
+        members.push_back(std::move(member));
+        key_ = Key::UNKNOWN;
+        field_ = kNoField;
+    }
+
+    std::vector<Scope> scopes_;
+    Key key_ = Key::UNKNOWN;
+    size_t field_ = kNoField;   // 当前键在所在记录字段表中的下标
+    Key itemOwner_ = Key::UNKNOWN;
+    ItemRecord item_;
+    MemberFields member_;
+    bool versionFound_ = false;
+    const MigrationPlan* plan_ = nullptr;   // 当前版本的存档为 nullptr
+};
+
+SaveResult GameSave::decodeJson(const char* data, size_t size, Player& player, int& currentBlockId,
+                                std::string& saveTime) const {
+    JsonLoadHandler handler;
+    if (!nlohmann::json::sax_parse(data, data + size, &handler)) {
+        return SaveResult::SERIALIZATION_ERROR;
+    }
+
+    // 验证数据完整性
+    if (!handler.playerFound) {
+        return SaveResult::INVALID_DATA;
+    }
+
+    applyRecord(handler.player, player);
+    player.teamMembers = std::move(handler.members);
+    player.activeMember = nullptr;
+    restoreActiveMember(player, handler.player.activeMemberIndex);
+    if (handler.inventoryFound) {
+        restoreInventoryItems(player.inventory, handler.maxCapacity, handler.items);
+    }
+
+    currentBlockId = handler.currentBlockId;
+    saveTime = std::move(handler.saveTime);
+    return SaveResult::SUCCESS;
+}
@@ -0,0 +1,479 @@
+// =============================================
+// 文件: lz_codec.cpp
+// 描述: LZ 编解码器实现。编码采用单哈希表贪心匹配（4 字节为最短匹配），
+//       未命中时逐渐加大步长跳过难以压缩的数据；解码全程做边界检查。
+// =============================================
+#include "lz_codec.h"
+#include "crc32c.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr char kMagic[4] = {'M', 'U', 'D', 'Z'};
+constexpr uint8_t kFormatVersion = 2;       // 版本 2 起块头带数据校验值
+constexpr size_t kFrameHeaderSize = 5;
+constexpr size_t kBlockHeaderSize = 12;
+constexpr size_t kLegacyBlockHeaderSize = 8;
+constexpr size_t kBlockSize = 64 * 1024;
+constexpr size_t kMaxOffset = 65535;
+constexpr size_t kMinMatch = 4;
+constexpr int kHashLog = 14;
+constexpr int kSkipTrigger = 6;   // 连续未命中 2^6 次后步长加一
+
+uint32_t read32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - kHashLog);
+}
+
+void putU32(std::string& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<char>(value >> shift));
+    }
+}
+
+uint32_t getU32(const char* p) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(p);
+    return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 |
+           static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+// 从 a、b 开始的公共前缀长度，最多到 aEnd
+size_t commonLength(const char* a, const char* b, const char* aEnd) {
+    const char* start = a;
+    while (a + 8 <= aEnd) {
+        uint64_t x, y;
+        std::memcpy(&x, a, 8);
+        std::memcpy(&y, b, 8);
+        if (uint64_t diff = x ^ y) {
+            // 小端：最低的不同位所在字节即第一个不同字节
+            int bit = 0;
+            while (!(diff & 0xFF)) {
+                diff >>= 8;
+                bit += 8;
+            }
+            return static_cast<size_t>(a - start) + bit / 8;
+        }
+        a += 8;
+        b += 8;
+    }
+    while (a < aEnd && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return static_cast<size_t>(a - start);
+}
+
+void putLength(std::string& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+void emitSequence(std::string& out, const char* literals, size_t literalLength, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength - kMinMatch;
+    uint8_t token = static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15));
+    out.push_back(static_cast<char>(token));
+    if (literalLength >= 15) {
+        putLength(out, literalLength - 15);
+    }
+    out.append(literals, literalLength);
+    out.push_back(static_cast<char>(offset & 0xFF));
+    out.push_back(static_cast<char>(offset >> 8));
+    if (matchCode >= 15) {
+        putLength(out, matchCode - 15);
+    }
+}
+
+void emitLastLiterals(std::string& out, const char* literals, size_t literalLength) {
+    out.push_back(static_cast<char>(std::min<size_t>(literalLength, 15) << 4));
+    if (literalLength >= 15) {
+        putLength(out, literalLength - 15);
+    }
+    out.append(literals, literalLength);
+}
+
+// 压缩一块并追加块头与数据。buffer 对应输入流中从 bufferStart 开始的数据，
+// 至少包含 [max(bufferStart, blockStart - 64K), blockEnd)；hashTable 记录流内绝对位置
+void compressBlock(const char* buffer, uint64_t bufferStart, uint64_t blockStart, uint64_t blockEnd,
+                   std::vector<uint64_t>& hashTable, std::string& out) {
+    const char* base = buffer - bufferStart;   // base[pos] 即流内位置 pos 的字节
+    const char* blockBegin = base + blockStart;
+    const char* blockLimit = base + blockEnd;
+    uint64_t historyPosition = std::max<uint64_t>(bufferStart, blockStart > kMaxOffset ? blockStart - kMaxOffset : 0);
+    const char* historyBegin = base + historyPosition;
+    size_t rawSize = static_cast<size_t>(blockEnd - blockStart);
+
+    size_t headerPosition = out.size();
+    putU32(out, static_cast<uint32_t>(rawSize));
+    putU32(out, 0);   // 数据长度与校验值，压缩完成后回填
+    putU32(out, 0);
+    size_t payloadStart = out.size();
+
+    const char* anchor = blockBegin;
+    const char* cursor = blockBegin;
+    unsigned misses = 0;
+    while (cursor + kMinMatch <= blockLimit) {
+        uint32_t sequence = read32(cursor);
+        uint64_t& slot = hashTable[hash32(sequence)];
+        uint64_t candidatePosition = slot;
+        uint64_t cursorPosition = static_cast<uint64_t>(cursor - base);
+        slot = cursorPosition;
+
+        // 表中可能是已滑出窗口的旧位置，先按位置判断再取字节比较
+        if (candidatePosition < historyPosition || candidatePosition >= cursorPosition ||
+            cursorPosition - candidatePosition > kMaxOffset || read32(base + candidatePosition) != sequence) {
+            ++misses;
+            cursor += 1 + (misses >> kSkipTrigger);
+            continue;
+        }
+        misses = 0;
+        const char* candidate = base + candidatePosition;
+
+        // 向前扩展到尚未输出的字面量中
+        while (cursor > anchor && candidate > historyBegin && cursor[-1] == candidate[-1]) {
+            --cursor;
+            --candidate;
+        }
+        size_t matchLength = kMinMatch + commonLength(cursor + kMinMatch, candidate + kMinMatch, blockLimit);
+        emitSequence(out, anchor, static_cast<size_t>(cursor - anchor),
+                     static_cast<size_t>(cursor - candidate), matchLength);
+        cursor += matchLength;
+        anchor = cursor;
+
+        // 匹配末尾附近补录一个位置，提高紧邻重复内容的命中率
+        if (cursor - 2 >= blockBegin && cursor - 2 + kMinMatch <= blockLimit) {
+            hashTable[hash32(read32(cursor - 2))] = static_cast<uint64_t>(cursor - 2 - base);
+        }
+    }
+    emitLastLiterals(out, anchor, static_cast<size_t>(blockLimit - anchor));
+
+    size_t payloadSize = out.size() - payloadStart;
+    if (payloadSize >= rawSize) {
+        // 压缩无收益时原样存储，解码直接复制
+        out.resize(payloadStart);
+        out.append(blockBegin, rawSize);
+        payloadSize = rawSize;
+    }
+    // 校验值覆盖块内数据（压缩后的字节），无需解压即可检查
+    uint32_t checksum = Crc32c::compute(out.data() + payloadStart, payloadSize);
+    for (int i = 0; i < 4; ++i) {
+        out[headerPosition + 4 + i] = static_cast<char>(payloadSize >> (8 * i));
+        out[headerPosition + 8 + i] = static_cast<char>(checksum >> (8 * i));
+    }
+}
+
+// 解码一块追加到 out；匹配可引用 out 中已有的数据
+bool decompressBlock(const char* payload, size_t payloadSize, size_t rawSize, std::string& out) {
+    size_t outStart = out.size();
+    out.resize(outStart + rawSize);
+    if (payloadSize == rawSize) {
+        std::memcpy(&out[outStart], payload, rawSize);
+        return true;
+    }
+
+    char* const outBegin = &out[0];
+    char* dest = outBegin + outStart;
+    char* const destEnd = dest + rawSize;
+    const char* src = payload;
+    const char* const srcEnd = payload + payloadSize;
+
+    auto readLength = [&](size_t length, size_t& result) {
+        if (length == 15) {
+            uint8_t byte;
+            do {
+                if (src >= srcEnd) return false;
+                byte = static_cast<uint8_t>(*src++);
+                length += byte;
+            } while (byte == 255);
+        }
+        result = length;
+        return true;
+    };
+
+    while (src < srcEnd) {
+        uint8_t token = static_cast<uint8_t>(*src++);
+        size_t literalLength;
+        if (!readLength(token >> 4, literalLength) ||
+            literalLength > static_cast<size_t>(srcEnd - src) ||
+            literalLength > static_cast<size_t>(destEnd - dest)) {
+            return false;
+        }
+        std::memcpy(dest, src, literalLength);
+        dest += literalLength;
+        src += literalLength;
+        if (src == srcEnd) {
+            break;   // 最后一个序列只有字面量
+        }
+
+        if (srcEnd - src < 2) return false;
+        size_t offset = static_cast<uint8_t>(src[0]) | static_cast<size_t>(static_cast<uint8_t>(src[1])) << 8;
+        src += 2;
+        size_t matchLength;
+        if (!readLength(token & 0x0F, matchLength)) return false;
+        matchLength += kMinMatch;
+        if (offset == 0 || offset > static_cast<size_t>(dest - outBegin) ||
+            matchLength > static_cast<size_t>(destEnd - dest)) {
+            return false;
+        }
+
+        const char* match = dest - offset;
+        if (offset >= matchLength) {
+            std::memcpy(dest, match, matchLength);
+            dest += matchLength;
+        } else {
+            // 重叠复制（如连续空格）必须逐字节向前展开
+            for (size_t i = 0; i < matchLength; ++i) {
+                *dest++ = *match++;
+            }
+        }
+    }
+    return dest == destEnd;
+}
+
+void writeFrameHeader(std::string& out) {
+    out.append(kMagic, sizeof(kMagic));
+    out.push_back(static_cast<char>(kFormatVersion));
+}
+
+// 检查帧头并返回版本号；无效时返回 0
+uint8_t readFrameVersion(const char* data) {
+    uint8_t version = static_cast<uint8_t>(data[sizeof(kMagic)]);
+    if (std::memcmp(data, kMagic, sizeof(kMagic)) != 0 || version == 0 || version > kFormatVersion) {
+        return 0;
+    }
+    return version;
+}
+
+size_t blockHeaderSize(uint8_t version) {
+    return version >= 2 ? kBlockHeaderSize : kLegacyBlockHeaderSize;
+}
+
+struct BlockHeader {
+    uint32_t rawSize;
+    uint32_t payloadSize;
+    uint32_t checksum;
+};
+
+BlockHeader readBlockHeader(const char* data, uint8_t version) {
+    return BlockHeader{getU32(data), getU32(data + 4), version >= 2 ? getU32(data + 8) : 0};
+}
+
+// 块头合法且（版本 2 起）数据校验值一致
+bool checkBlock(const BlockHeader& header, const char* payload, uint8_t version) {
+    if (header.rawSize > kBlockSize || header.payloadSize > header.rawSize) {
+        return false;
+    }
+    return version < 2 || Crc32c::compute(payload, header.payloadSize) == header.checksum;
+}
+
+void writeEndMarker(std::string& out) {
+    out.append(kBlockHeaderSize, '\0');
+}
+
+// 依次校验内存中的每一块并交给 visit；结构错误、校验失败或 visit 返回 false 时返回 false
+template <typename Visit>
+bool forEachBlock(const char* data, size_t size, Visit&& visit) {
+    uint8_t version = size >= kFrameHeaderSize ? readFrameVersion(data) : 0;
+    if (version == 0) {
+        return false;
+    }
+    size_t headerSize = blockHeaderSize(version);
+    size_t position = kFrameHeaderSize;
+    while (true) {
+        if (size - position < headerSize) {
+            return false;
+        }
+        BlockHeader header = readBlockHeader(data + position, version);
+        position += headerSize;
+        if (header.rawSize == 0) {
+            return true;
+        }
+        if (header.payloadSize > size - position || !checkBlock(header, data + position, version) ||
+            !visit(header, data + position)) {
+            return false;
+        }
+        position += header.payloadSize;
+    }
+}
+
+} // namespace
+
+// ---------- LzEncoder ----------
+
+LzEncoder::LzEncoder(std::string& out) : out_(out), hashTable_(size_t(1) << kHashLog, 0) {
+    writeFrameHeader(out_);
+}
+
+void LzEncoder::write(const char* data, size_t size) {
+    while (size > 0) {
+        size_t pending = static_cast<size_t>(windowStart_ + window_.size() - blockStart_);
+        size_t count = std::min(size, kBlockSize - pending);
+        window_.append(data, count);
+        data += count;
+        size -= count;
+        if (pending + count == kBlockSize) {
+            flushBlock();
+        }
+    }
+}
+
+void LzEncoder::finish() {
+    if (finished_) {
+        return;
+    }
+    if (windowStart_ + window_.size() > blockStart_) {
+        flushBlock();
+    }
+    writeEndMarker(out_);
+    finished_ = true;
+}
+
+void LzEncoder::flushBlock() {
+    uint64_t blockEnd = windowStart_ + window_.size();
+    compressBlock(window_.data(), windowStart_, blockStart_, blockEnd, hashTable_, out_);
+    blockStart_ = blockEnd;
+
+    // 只保留最近 64 KiB 作为后续块的匹配历史
+    if (window_.size() > kMaxOffset) {
+        size_t drop = window_.size() - kMaxOffset;
+        window_.erase(0, drop);
+        windowStart_ += drop;
+    }
+}
+
+// ---------- LzDecoder ----------
+
+LzDecoder::LzDecoder(std::istream& in) : in_(&in) {}
+
+LzDecoder::LzDecoder(const char* data, size_t size) : memory_(data), memorySize_(size) {}
+
+const char* LzDecoder::fetch(size_t count) {
+    if (!in_) {
+        if (count > memorySize_ - memoryPosition_) {
+            return nullptr;
+        }
+        const char* bytes = memory_ + memoryPosition_;
+        memoryPosition_ += count;
+        return bytes;
+    }
+    payload_.resize(count);
+    if (count > 0 && !in_->read(&payload_[0], static_cast<std::streamsize>(count))) {
+        return nullptr;
+    }
+    return payload_.data();
+}
+
+bool LzDecoder::nextBlock(const char*& data, size_t& size) {
+    if (!ok_) {
+        return false;
+    }
+    if (version_ == 0) {
+        const char* header = fetch(kFrameHeaderSize);
+        if (!header || (version_ = readFrameVersion(header)) == 0) {
+            ok_ = false;
+            return false;
+        }
+    }
+
+    const char* headerBytes = fetch(blockHeaderSize(version_));
+    if (!headerBytes) {
+        ok_ = false;
+        return false;
+    }
+    BlockHeader header = readBlockHeader(headerBytes, version_);
+    if (header.rawSize == 0) {
+        return false;   // 结束标记
+    }
+    const char* payload = header.payloadSize <= kBlockSize ? fetch(header.payloadSize) : nullptr;
+    if (!payload || !checkBlock(header, payload, version_)) {
+        ok_ = false;
+        return false;
+    }
+    if (buffer_.size() > kMaxOffset) {
+        buffer_.erase(0, buffer_.size() - kMaxOffset);
+    }
+    size_t start = buffer_.size();
+    if (!decompressBlock(payload, header.payloadSize, header.rawSize, buffer_)) {
+        ok_ = false;
+        return false;
+    }
+    data = buffer_.data() + start;
+    size = header.rawSize;
+    return true;
+}
+
+// ---------- 流缓冲 ----------
+
+std::streamsize LzOutputBuffer::xsputn(const char* data, std::streamsize size) {
+    encoder_.write(data, static_cast<size_t>(size));
+    return size;
+}
+
+LzOutputBuffer::int_type LzOutputBuffer::overflow(int_type ch) {
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        char c = traits_type::to_char_type(ch);
+        encoder_.write(&c, 1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+LzInputBuffer::int_type LzInputBuffer::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    const char* data = nullptr;
+    size_t size = 0;
+    if (!decoder_.nextBlock(data, size)) {
+        return traits_type::eof();
+    }
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+    return traits_type::to_int_type(*gptr());
+}
+
+// ---------- 一次性接口 ----------
+
+bool LzCodec::isCompressed(const std::string& data) {
+    return isCompressed(data.data(), data.size());
+}
+
+bool LzCodec::isCompressed(const char* data, size_t size) {
+    return size >= kFrameHeaderSize && std::memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+std::string LzCodec::compress(const std::string& data) {
+    // 整段数据已在内存中，直接在原缓冲区上匹配，无需经过编码器的滑动窗口
+    std::string out;
+    out.reserve(data.size() / 2 + 64);
+    writeFrameHeader(out);
+    std::vector<uint64_t> hashTable(size_t(1) << kHashLog, 0);
+    for (uint64_t blockStart = 0; blockStart < data.size(); blockStart += kBlockSize) {
+        uint64_t blockEnd = std::min<uint64_t>(blockStart + kBlockSize, data.size());
+        compressBlock(data.data(), 0, blockStart, blockEnd, hashTable, out);
+    }
+    writeEndMarker(out);
+    return out;
+}
+
+bool LzCodec::decompress(const std::string& data, std::string& out) {
+    return decompress(data.data(), data.size(), out);
+}
+
+bool LzCodec::decompress(const char* data, size_t size, std::string& out) {
+    out.clear();
+    return forEachBlock(data, size, [&out](const BlockHeader& header, const char* payload) {
+        return decompressBlock(payload, header.payloadSize, header.rawSize, out);
+    });
+}
+
+bool LzCodec::verify(const char* data, size_t size) {
+    return forEachBlock(data, size, [](const BlockHeader&, const char*) { return true; });
+}
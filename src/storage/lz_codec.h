@@ -0,0 +1,102 @@
+// =============================================
+// 文件: lz_codec.h
+// 描述: 存档压缩使用的 LZ 系列编解码器（LZ4 风格的字节对齐序列，无外部依赖）。
+// 布局: 帧头 [魔数 "MUDZ"][版本 u8]
+//       块   [原始长度 u32][数据长度 u32][数据 CRC32C u32][数据]，
+//            两个长度相等表示该块未压缩原样存储；版本 1 的块头没有校验值
+//       结束 原始长度为 0 的块头
+//       块内为若干序列：[标记 u8][字面量][偏移 u16][匹配长度扩展]，
+//       最后一个序列只有字面量。匹配可引用前 64 KiB 内（含之前块）的数据。
+// =============================================
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// 流式编码器：数据可分多次写入，每满一块（64 KiB）即压缩输出到 out
+class LzEncoder {
+public:
+    explicit LzEncoder(std::string& out);
+
+    void write(const char* data, size_t size);
+    // 压缩剩余数据并写入结束标记；之后不可再写入
+    void finish();
+
+private:
+    void flushBlock();
+
+    std::string& out_;
+    std::string window_;         // 最近 64 KiB 历史 + 尚未压缩的数据
+    uint64_t windowStart_ = 0;   // window_[0] 在整个输入流中的位置
+    uint64_t blockStart_ = 0;    // 尚未压缩数据的起始位置
+    std::vector<uint64_t> hashTable_;
+    bool finished_ = false;
+};
+
+// 流式解码器：从输入流或内存（如映射的文件）逐块解码，保留 64 KiB 历史供后续块引用
+class LzDecoder {
+public:
+    explicit LzDecoder(std::istream& in);
+    LzDecoder(const char* data, size_t size);
+
+    // 解码下一块；返回 false 表示已到结束标记或数据损坏（见 ok()）
+    bool nextBlock(const char*& data, size_t& size);
+    bool ok() const { return ok_; }
+
+private:
+    // 取出接下来 count 个输入字节；内存输入直接返回指针，不复制
+    const char* fetch(size_t count);
+
+    std::istream* in_ = nullptr;
+    const char* memory_ = nullptr;
+    size_t memorySize_ = 0;
+    size_t memoryPosition_ = 0;
+    std::string buffer_;    // 历史 + 当前块输出
+    std::string payload_;
+    uint8_t version_ = 0;   // 读到帧头前为 0
+    bool ok_ = true;
+};
+
+// 以 std::streambuf 形式接收待压缩数据，可直接用 std::ostream 输出（如 JSON 序列化）
+class LzOutputBuffer : public std::streambuf {
+public:
+    explicit LzOutputBuffer(LzEncoder& encoder) : encoder_(encoder) {}
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override;
+    int_type overflow(int_type ch) override;
+
+private:
+    LzEncoder& encoder_;
+};
+
+// 以 std::streambuf 形式提供解压后的数据，可直接交给 std::istream / SAX 解析
+class LzInputBuffer : public std::streambuf {
+public:
+    explicit LzInputBuffer(std::istream& in) : decoder_(in) {}
+    LzInputBuffer(const char* data, size_t size) : decoder_(data, size) {}
+    bool ok() const { return decoder_.ok(); }
+
+protected:
+    int_type underflow() override;
+
+private:
+    LzDecoder decoder_;
+};
+
+class LzCodec {
+public:
+    // 是否以压缩帧头开头
+    static bool isCompressed(const std::string& data);
+    static bool isCompressed(const char* data, size_t size);
+
+    // 一次性压缩/解压整段数据；数据损坏或校验失败时 decompress 返回 false
+    static std::string compress(const std::string& data);
+    static bool decompress(const std::string& data, std::string& out);
+    static bool decompress(const char* data, size_t size, std::string& out);
+
+    // 只检查帧结构与各块校验值，不解压
+    static bool verify(const char* data, size_t size);
+};
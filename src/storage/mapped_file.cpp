@@ -0,0 +1,83 @@
+// =============================================
+// 文件: mapped_file.cpp
+// 描述: 只读内存映射文件实现（POSIX mmap，其他平台读入内存）。
+// =============================================
+#include "mapped_file.h"
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::string& filePath) {
+#ifndef _WIN32
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(status.st_size);
+    if (size > 0) {
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // 映射建立后即可关闭描述符，映射本身保持有效
+        ::close(fd);
+        if (mapping != MAP_FAILED) {
+            std::shared_ptr<MappedFile> file(new MappedFile());
+            file->mapping_ = mapping;
+            file->data_ = static_cast<const char*>(mapping);
+            file->size_ = size;
+            return file;
+        }
+    } else {
+        ::close(fd);
+    }
+#endif
+
+    // 空文件无法映射；映射失败或不支持映射时整个读入内存
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return nullptr;
+    }
+    std::streamsize length = file.tellg();
+    if (length < 0) {
+        return nullptr;
+    }
+    std::string data(static_cast<size_t>(length), '\0');
+    file.seekg(0);
+    if (length > 0 && !file.read(&data[0], length)) {
+        return nullptr;
+    }
+    return fromBuffer(std::move(data));
+}
+
+std::shared_ptr<const MappedFile> MappedFile::fromBuffer(std::string data) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->buffer_ = std::move(data);
+    file->data_ = file->buffer_.data();
+    file->size_ = file->buffer_.size();
+    return file;
+}
+
+std::shared_ptr<const MappedFile> MappedFile::slice(std::shared_ptr<const MappedFile> parent, size_t offset,
+                                                size_t size) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->data_ = parent->data() + offset;
+    file->size_ = size;
+    file->parent_ = std::move(parent);
+    return file;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (mapping_) {
+        ::munmap(mapping_, size_);
+    }
+#endif
+}
@@ -0,0 +1,40 @@
+// =============================================
+// 文件: mapped_file.h
+// 描述: 只读内存映射文件。加载存档时映射整个文件，各段按需解码，
+//       只有被访问到的页才会真正从磁盘读入。
+// 说明: 存档总是以"写临时文件 + 重命名"替换，POSIX 下已映射的旧文件
+//       不受影响；Windows 无法重命名覆盖被映射的文件，因此退化为读入内存。
+//       对象以 shared_ptr 共享。映射不应活过加载调用：文件被外部截断后访问映射会触发
+//       SIGBUS，延迟解码的数据应先复制出来（fromBuffer）。
+// =============================================
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+class MappedFile {
+public:
+    // 映射文件；文件不存在或无法读取时返回 nullptr
+    static std::shared_ptr<const MappedFile> open(const std::string& filePath);
+    // 包装内存中的数据（如解压结果），接口与映射文件一致
+    static std::shared_ptr<const MappedFile> fromBuffer(std::string data);
+    // 另一映射中的一段（如存档容器中的某个槽），持有原映射以保证数据有效
+    static std::shared_ptr<const MappedFile> slice(std::shared_ptr<const MappedFile> parent, size_t offset,
+                                                   size_t size);
+
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    MappedFile() = default;
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    void* mapping_ = nullptr;   // 映射起始地址；为空表示数据在 buffer_ 中
+    std::string buffer_;
+    std::shared_ptr<const MappedFile> parent_;
+};
@@ -0,0 +1,353 @@
+// =============================================
+// 文件: save_catalog.cpp
+// 描述: 存档目录服务。启动时在后台线程列出 saves/，摘要缓存未命中的存档分给多个线程并行读取文件头；
+//       之后监视目录变化，只重新读取发生变化的存档。UI 线程列表时只复制内存中的目录。
+// 说明: Linux 上用 inotify 监视写入完成、移入、移出与删除（原子替换表现为移入）；
+//       事件队列溢出时比对全部存档的修改时间与大小；inotify 不可用时改为定时比对，
+//       但只在存档界面显示期间进行（见 setVisible），其余时间不访问磁盘。
+//       目录线程不写终端：扫描出错时经 onError 交给界面显示。
+//       目录只保存摘要，与摘要缓存使用相同的校验依据（快照与日志的修改时间 + 大小），
+//       日志存档只追加 <存档名>.journal，日志的变化同样使该存档重新读取。
+// =============================================
+#include "storage.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* const kSavesDir = "saves";
+constexpr auto kPollInterval = std::chrono::seconds(1);   // 没有 inotify 时（存档界面显示期间）的比对间隔
+constexpr int kWatchTimeoutMs = 250;                      // 等待 inotify 事件时检查停止标志的间隔
+
+bool isSaveFileName(const std::string& fileName) {
+    auto extension = std::filesystem::path(fileName).extension();
+    return extension == ".json" || extension == ".sav";
+}
+
+// 目录事件对应的存档名：存档本身或其日志（<存档名>.journal）；无关文件返回空串
+std::string slotNameOf(const std::string& fileName) {
+    std::filesystem::path path(fileName);
+    if (path.extension() == ".journal") {
+        std::string slot = path.stem().string();
+        return isSaveFileName(slot) ? slot : std::string();
+    }
+    return isSaveFileName(fileName) ? fileName : std::string();
+}
+
+} // namespace
+
+class GameSave::SaveCatalog {
+public:
+    SaveCatalog(const GameSave& owner, std::unordered_map<std::string, SaveIndexEntry> seed,
+                std::function<void()> onChange, std::function<void(const std::string&)> onError)
+        : owner_(owner), onChange_(std::move(onChange)), onError_(std::move(onError)) {
+        entries_.insert(seed.begin(), seed.end());
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~SaveCatalog() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        thread_.join();
+    }
+
+    // 目录的副本；首次扫描未完成时等待
+    std::map<std::string, SaveIndexEntry> entries(uint64_t& revision) const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return scanned_; });
+        revision = revision_;
+        return entries_;
+    }
+
+    // 重新读取单个存档（文件不存在时移出目录）；返回目录是否变化。可在任意线程调用
+    bool refresh(const std::string& fileName) {
+        int64_t modifiedTime = 0;
+        uint64_t fileSize = 0;
+        std::string filePath = owner_.getSaveFilePath(fileName);
+        if (!statSaveFile(filePath, modifiedTime, fileSize)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.erase(fileName) > 0 && bump();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries_.find(fileName);
+            if (it != entries_.end() && it->second.modifiedTime == modifiedTime && it->second.fileSize == fileSize) {
+                return false;
+            }
+        }
+        // 读文件头不持锁，列表不会被阻塞
+        SaveInfo info;
+        owner_.readSaveInfo(filePath, info);
+        return put(fileName, SaveIndexEntry{modifiedTime, fileSize, info});
+    }
+
+    // 存档界面是否正在显示；没有 inotify 时只在显示期间定时比对，显示时立即比对一次
+    void setVisible(bool visible) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            visible_ = visible;
+        }
+        wake_.notify_all();
+    }
+
+    // 摘要已知（刚由本进程写入）时直接放入目录。调用方给出的摘要总是最新的，
+    // 即使校验依据未变（例如文件时间精度不足）也覆盖已有条目
+    bool put(const std::string& fileName, const SaveIndexEntry& entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.insert_or_assign(fileName, entry);
+        return bump();
+    }
+
+private:
+    // 调用时已持锁
+    bool bump() {
+        ++revision_;
+        return true;
+    }
+
+    void notify() {
+        if (onChange_) {
+            onChange_();
+        }
+    }
+
+    void run() {
+        std::filesystem::create_directories(kSavesDir);
+#ifdef __linux__
+        // 先开始监视再扫描，扫描期间发生的改动不会漏掉
+        int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd >= 0 && inotify_add_watch(fd, kSavesDir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0) {
+            close(fd);
+            fd = -1;
+        }
+        scanAll();
+        if (fd >= 0) {
+            watch(fd);
+            close(fd);
+            return;
+        }
+#else
+        scanAll();
+#endif
+        // 没有目录通知：存档界面显示期间定时比对，隐藏时一直等待，不访问磁盘
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            if (visible_) {
+                wake_.wait_for(lock, kPollInterval, [this] { return stop_ || !visible_; });
+            } else {
+                wake_.wait(lock, [this] { return stop_ || visible_; });
+            }
+            if (stop_) {
+                return;
+            }
+            if (visible_) {
+                lock.unlock();
+                scanAll();
+                lock.lock();
+            }
+        }
+    }
+
+#ifdef __linux__
+    void watch(int fd) {
+        alignas(inotify_event) char buffer[4096];
+        while (!stopping()) {
+            pollfd request{fd, POLLIN, 0};
+            if (poll(&request, 1, kWatchTimeoutMs) <= 0) {
+                continue;
+            }
+            // 一批事件中同一存档可能出现多次，去重后各读一次
+            std::set<std::string> changed;
+            bool overflow = false;
+            ssize_t length;
+            while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+                for (char* p = buffer; p < buffer + length;) {
+                    const auto* event = reinterpret_cast<const inotify_event*>(p);
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        overflow = true;
+                    } else if (event->len > 0) {
+                        std::string slot = slotNameOf(event->name);
+                        if (!slot.empty()) {
+                            changed.insert(std::move(slot));
+                        }
+                    }
+                    p += sizeof(inotify_event) + event->len;
+                }
+            }
+            if (overflow) {
+                scanAll();
+                continue;
+            }
+            bool any = false;
+            for (const std::string& fileName : changed) {
+                any = refresh(fileName) || any;
+            }
+            if (any) {
+                notify();
+            }
+        }
+    }
+#endif
+
+    bool stopping() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stop_;
+    }
+
+    // 比对整个目录：未变化的存档沿用已有摘要，变化的由多个线程并行读取文件头
+    void scanAll() {
+        std::map<std::string, std::pair<int64_t, uint64_t>> present;
+        try {
+            for (const auto& entry : std::filesystem::directory_iterator(kSavesDir)) {
+                std::string fileName = entry.path().filename().string();
+                int64_t modifiedTime = 0;
+                uint64_t fileSize = 0;
+                if (entry.is_regular_file() && isSaveFileName(fileName) &&
+                    statSaveFile(entry.path().string(), modifiedTime, fileSize)) {
+                    present.emplace(std::move(fileName), std::make_pair(modifiedTime, fileSize));
+                }
+            }
+        } catch (const std::exception& e) {
+            if (onError_) {
+                onError_(std::string("扫描存档目录时发生错误: ") + e.what());
+            }
+        }
+
+        std::vector<std::string> stale;
+        bool changed = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = entries_.begin(); it != entries_.end();) {
+                if (present.count(it->first) == 0) {
+                    it = entries_.erase(it);
+                    changed = true;
+                } else {
+                    ++it;
+                }
+            }
+            for (const auto& [fileName, stamp] : present) {
+                auto it = entries_.find(fileName);
+                if (it == entries_.end() || it->second.modifiedTime != stamp.first ||
+                    it->second.fileSize != stamp.second) {
+                    stale.push_back(fileName);
+                }
+            }
+        }
+
+        std::vector<SaveIndexEntry> infos(stale.size());
+        std::atomic<size_t> next{0};
+        auto readInfos = [&]() {
+            for (size_t i = next++; i < stale.size(); i = next++) {
+                const auto& stamp = present.at(stale[i]);
+                infos[i].modifiedTime = stamp.first;
+                infos[i].fileSize = stamp.second;
+                owner_.readSaveInfo(owner_.getSaveFilePath(stale[i]), infos[i].info);
+            }
+        };
+        size_t workerCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), stale.size());
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < workerCount; ++i) {
+            workers.emplace_back(readInfos);
+        }
+        readInfos();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < stale.size(); ++i) {
+                entries_.insert_or_assign(stale[i], std::move(infos[i]));
+            }
+            changed = changed || !stale.empty() || !scanned_;
+            if (changed) {
+                bump();
+            }
+            scanned_ = true;
+        }
+        ready_.notify_all();
+        if (changed) {
+            notify();
+        }
+    }
+
+    const GameSave& owner_;
+    std::function<void()> onChange_;
+    std::function<void(const std::string&)> onError_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable ready_;   // 首次扫描完成
+    std::condition_variable wake_;            // 停止或存档界面显示状态变化（定时比对时）
+    std::map<std::string, SaveIndexEntry> entries_;
+    uint64_t revision_ = 0;
+    bool scanned_ = false;
+    bool stop_ = false;
+    bool visible_ = false;
+    std::thread thread_;
+};
+
+void GameSave::SaveCatalogDeleter::operator()(SaveCatalog* catalog) const {
+    delete catalog;
+}
+
+void GameSave::startSaveCatalog(std::function<void()> onChange, std::function<void(const std::string&)> onError) {
+    stopSaveCatalog();
+    loadSaveIndex();
+    catalog_.reset(new SaveCatalog(*this, saveIndex_, std::move(onChange), std::move(onError)));
+}
+
+void GameSave::setSaveCatalogVisible(bool visible) {
+    if (catalog_) {
+        catalog_->setVisible(visible);
+    }
+}
+
+void GameSave::stopSaveCatalog() {
+    catalog_.reset();
+    catalogMergedRevision_ = 0;
+}
+
+void GameSave::refreshSaveCatalog(const std::string& saveFileName, const SaveIndexEntry* entry) const {
+    if (!catalog_) {
+        return;
+    }
+    if (entry) {
+        catalog_->put(saveFileName, *entry);
+    } else {
+        catalog_->refresh(saveFileName);
+    }
+}
+
+std::vector<GameSave::SaveListing> GameSave::listCatalog() const {
+    uint64_t revision = 0;
+    std::map<std::string, SaveIndexEntry> entries = catalog_->entries(revision);
+
+    // 目录即当前目录下全部存档的摘要，有变化时整体写回摘要缓存，下次启动可直接沿用
+    if (revision != catalogMergedRevision_) {
+        saveIndex_.clear();
+        saveIndex_.insert(entries.begin(), entries.end());
+        storeSaveIndex();
+        catalogMergedRevision_ = revision;
+    }
+
+    std::vector<SaveListing> listings;
+    listings.reserve(entries.size());
+    for (auto& [fileName, entry] : entries) {
+        listings.push_back({fileName, std::move(entry.info)});
+    }
+    return listings;
+}
@@ -0,0 +1,18 @@
+// =============================================
+// 文件: save_codec.h
+// 描述: 物品与队伍成员的二进制编码。二进制存档（binary_save.cpp）
+//       与存档日志（save_journal.cpp）共用同一套编码，实现见 binary_save.cpp。
+// =============================================
+#pragma once
+#include "byte_stream.h"
+#include "../core/item.h"
+#include "../core/team_member.h"
+#include <memory>
+
+void writeItem(ByteWriter& writer, const Item& item);
+// 数据无效或越界时返回 nullptr
+std::shared_ptr<Item> readItem(ByteReader& reader);
+
+void writeTeamMember(ByteWriter& writer, const TeamMember& member);
+// 数据无效或越界时返回 nullptr
+std::shared_ptr<TeamMember> readTeamMember(ByteReader& reader);
@@ -0,0 +1,396 @@
+// =============================================
+// 文件: save_index.cpp
+// 描述: 存档摘要缓存。列表界面只需要玩家名/等级/时间等摘要：
+//       缓存命中（修改时间与大小一致，日志存档连同其日志一起比较）时不打开存档；未命中时只读文件头——
+//       二进制存档读取 META 段，JSON 存档以 SAX 方式读到 "meta" 对象即停止，
+//       不构建完整的 JSON DOM。压缩的 JSON 存档边解压边解析，通常只需解出第一块。
+//       摘要同时记录存档是否校验失败（corrupt），供列表标出损坏的存档。
+//       缓存持久化在 saves/.save_index。单文件容器模式下摘要以同样的编码存在槽表中。
+// =============================================
+#include "storage.h"
+#include "byte_stream.h"
+#include "lz_codec.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <unordered_set>
+
+namespace {
+
+const char* const kSaveIndexPath = "saves/.save_index";
+constexpr char kIndexMagic[4] = {'M', 'U', 'D', 'I'};
+constexpr uint16_t kIndexVersion = 2;      // 版本 2 增加损坏标记
+
+int64_t modifiedTimeOf(const std::filesystem::file_time_type& time) {
+    return static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+// 从 JSON 存档中提取摘要的 SAX 处理器。
+// 新存档在顶层写有 "meta" 对象（键按字母序排在 "player" 之前），读完即中止解析；
+// 旧存档没有 "meta"，则退回扫描 player 下的摘要字段与顶层 saveTime。
+class SaveInfoSax : public nlohmann::json_sax<nlohmann::json> {
+public:
+    explicit SaveInfoSax(GameSave::SaveInfo& info) : info_(info) {}
+
+    bool metaFound() const { return metaFound_; }
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_float(number_float_t, const string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+
+    bool string(string_t& value) override {
+        if (inSummary() && (key_ == "name" || key_ == "playerName")) {
+            info_.playerName = value;
+        } else if ((inSummary() && key_ == "saveTime") || (path_.size() == 1 && key_ == "saveTime")) {
+            info_.saveTime = value;
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        path_.push_back(key_);
+        return true;
+    }
+
+    bool end_object() override {
+        bool leavingMeta = path_.size() == 2 && path_.back() == "meta";
+        path_.pop_back();
+        if (leavingMeta) {
+            // 摘要已完整，中止解析
+            metaFound_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        path_.push_back(key_);
+        return true;
+    }
+
+    bool end_array() override {
+        path_.pop_back();
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        key_ = value;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override {
+        return false;
+    }
+
+private:
+    // 当前是否位于摘要所在的对象（顶层 meta 或旧格式的 player）
+    bool inSummary() const {
+        return path_.size() == 2 && (path_[1] == "meta" || path_[1] == "player");
+    }
+
+    bool integer(int64_t value) {
+        if (!inSummary()) {
+            return true;
+        }
+        int number = static_cast<int>(value);
+        if (key_ == "level") info_.level = number;
+        else if (key_ == "x") info_.x = number;
+        else if (key_ == "y") info_.y = number;
+        else if (key_ == "teamSize") info_.teamSize = number;
+        else if (key_ == "inventorySize") info_.inventorySize = number;
+        return true;
+    }
+
+    GameSave::SaveInfo& info_;
+    std::vector<std::string> path_;
+    std::string key_;
+    bool metaFound_ = false;
+};
+
+void writeInfo(ByteWriter& writer, const GameSave::SaveInfo& info) {
+    writer.writeString(info.playerName);
+    writer.writeString(info.saveTime);
+    writer.writeVarInt(info.level);
+    writer.writeVarInt(info.x);
+    writer.writeVarInt(info.y);
+    writer.writeVarInt(info.teamSize);
+    writer.writeVarInt(info.inventorySize);
+    writer.writeU8(info.corrupt ? 1 : 0);
+}
+
+void readInfo(ByteReader& reader, GameSave::SaveInfo& info) {
+    info.playerName = reader.readString();
+    info.saveTime = reader.readString();
+    info.level = static_cast<int>(reader.readVarInt());
+    info.x = static_cast<int>(reader.readVarInt());
+    info.y = static_cast<int>(reader.readVarInt());
+    info.teamSize = static_cast<int>(reader.readVarInt());
+    info.inventorySize = static_cast<int>(reader.readVarInt());
+    info.corrupt = reader.readU8() != 0;
+}
+
+} // namespace
+
+std::vector<GameSave::SaveListing> GameSave::listSaves() const {
+    std::vector<SaveListing> listings;
+    if (slotStore_) {
+        // 容器槽表自带摘要，不访问目录与索引
+        for (const std::string& fileName : slotStore_->list()) {
+            SaveListing listing{fileName, {}};
+            decodeSummary(*slotStore_->summary(fileName), listing.info);
+            listings.push_back(std::move(listing));
+        }
+        return listings;
+    }
+    if (catalog_) {
+        return listCatalog();
+    }
+    loadSaveIndex();
+
+    bool changed = false;
+    std::unordered_set<std::string> present;
+    try {
+        std::string savesDir = "saves";
+        if (std::filesystem::exists(savesDir)) {
+            for (const auto& entry : std::filesystem::directory_iterator(savesDir)) {
+                auto extension = entry.path().extension();
+                if (!entry.is_regular_file() || (extension != ".json" && extension != ".sav")) {
+                    continue;
+                }
+
+                std::string fileName = entry.path().filename().string();
+                int64_t modifiedTime = 0;
+                uint64_t fileSize = 0;
+                if (!statSaveFile(entry.path().string(), modifiedTime, fileSize)) {
+                    continue;
+                }
+                present.insert(fileName);
+
+                auto it = saveIndex_.find(fileName);
+                if (it == saveIndex_.end() || it->second.modifiedTime != modifiedTime ||
+                    it->second.fileSize != fileSize) {
+                    SaveInfo info;
+                    readSaveInfo(entry.path().string(), info);
+                    it = saveIndex_.insert_or_assign(fileName, SaveIndexEntry{modifiedTime, fileSize, info}).first;
+                    changed = true;
+                }
+                listings.push_back({fileName, it->second.info});
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "列出存档文件时发生错误: " << e.what() << std::endl;
+    }
+
+    // 清理已被外部删除的存档
+    for (auto it = saveIndex_.begin(); it != saveIndex_.end();) {
+        if (present.count(it->first) == 0) {
+            it = saveIndex_.erase(it);
+            changed = true;
+        } else {
+            ++it;
+        }
+    }
+
+    if (changed) {
+        storeSaveIndex();
+    }
+    return listings;
+}
+
+GameSave::SaveInfo GameSave::getSaveInfo(const std::string& saveFileName) const {
+    SaveInfo info;
+    if (slotStore_) {
+        if (const std::string* summary = slotStore_->summary(saveFileName)) {
+            decodeSummary(*summary, info);
+        }
+        return info;
+    }
+    loadSaveIndex();
+
+    try {
+        std::string filePath = getSaveFilePath(saveFileName);
+        int64_t modifiedTime = 0;
+        uint64_t fileSize = 0;
+        if (!statSaveFile(filePath, modifiedTime, fileSize)) {
+            return info;
+        }
+
+        auto it = saveIndex_.find(saveFileName);
+        if (it != saveIndex_.end() && it->second.modifiedTime == modifiedTime && it->second.fileSize == fileSize) {
+            return it->second.info;
+        }
+
+        readSaveInfo(filePath, info);
+        saveIndex_.insert_or_assign(saveFileName, SaveIndexEntry{modifiedTime, fileSize, info});
+        storeSaveIndex();
+    } catch (const std::exception& e) {
+        std::cerr << "获取存档信息时发生错误: " << e.what() << std::endl;
+    }
+
+    return info;
+}
+
+bool GameSave::readSaveInfo(const std::string& filePath, SaveInfo& info) const {
+    try {
+        // 映射后只访问摘要所在的开头部分，其余页不会从磁盘读入
+        std::shared_ptr<const MappedFile> file = MappedFile::open(filePath);
+        if (!file) {
+            return false;
+        }
+
+        // 按文件头识别格式
+        bool found = false;
+        if (isBinarySave(file->data(), file->size())) {
+            found = readBinaryInfo(file->data(), file->size(), info);
+        } else if (LzCodec::isCompressed(file->data(), file->size())) {
+            found = readCompressedSaveInfo(file->data(), file->size(), info);
+        } else {
+            SaveInfoSax sax(info);
+            bool completed = nlohmann::json::sax_parse(file->data(), file->data() + file->size(), &sax);
+            found = completed || sax.metaFound();
+        }
+
+        // 日志存档的快照只反映上次整份写入时的状态，之后的保存只追加在日志里
+        return readJournalSummary(filePath, *file, info) || found;
+    } catch (const std::exception& e) {
+        std::cerr << "读取存档摘要时发生错误: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool GameSave::readCompressedSaveInfo(const char* data, size_t size, SaveInfo& info) const {
+    // 只校验不解压，代价远小于解析；摘要所在的第一块完好时仍可列出
+    info.corrupt = !LzCodec::verify(data, size);
+    char header[8] = {};
+    {
+        LzInputBuffer buffer(data, size);
+        std::istream stream(&buffer);
+        stream.read(header, sizeof(header));
+    }
+
+    if (isBinarySave(header, sizeof(header))) {
+        // 二进制存档本身很小，整份解压后读取 META 段
+        std::string decompressed;
+        if (info.corrupt || !LzCodec::decompress(data, size, decompressed)) {
+            return false;
+        }
+        return readBinaryInfo(decompressed.data(), decompressed.size(), info);
+    }
+
+    LzInputBuffer buffer(data, size);
+    std::istream stream(&buffer);
+    SaveInfoSax sax(info);
+    bool completed = nlohmann::json::sax_parse(stream, &sax);
+    return completed || sax.metaFound();
+}
+
+std::string GameSave::encodeSummary(const SaveInfo& info) {
+    std::string data;
+    ByteWriter writer(data);
+    writeInfo(writer, info);
+    return data;
+}
+
+bool GameSave::decodeSummary(const std::string& data, SaveInfo& info) {
+    ByteReader reader(data.data(), data.size());
+    readInfo(reader, info);
+    return reader.ok();
+}
+
+void GameSave::updateSaveIndex(const std::string& saveFileName, const SaveInfo& info) const {
+    loadSaveIndex();
+    SaveIndexEntry entry{0, 0, info};
+    if (!statSaveFile(getSaveFilePath(saveFileName), entry.modifiedTime, entry.fileSize)) {
+        saveIndex_.erase(saveFileName);
+    } else {
+        saveIndex_.insert_or_assign(saveFileName, entry);
+        refreshSaveCatalog(saveFileName, &entry);
+    }
+    storeSaveIndex();
+}
+
+bool GameSave::statSaveFile(const std::string& filePath, int64_t& modifiedTime, uint64_t& fileSize) {
+    std::error_code error;
+    auto lastWrite = std::filesystem::last_write_time(filePath, error);
+    fileSize = error ? 0 : std::filesystem::file_size(filePath, error);
+    if (error) {
+        return false;
+    }
+    modifiedTime = modifiedTimeOf(lastWrite);
+
+    // 日志存档只追加日志，快照不变：日志的时间与大小一并计入
+    std::string journalPath = filePath + ".journal";
+    auto journalWrite = std::filesystem::last_write_time(journalPath, error);
+    uint64_t journalSize = error ? 0 : std::filesystem::file_size(journalPath, error);
+    if (!error) {
+        modifiedTime = std::max(modifiedTime, modifiedTimeOf(journalWrite));
+        fileSize += journalSize;
+    }
+    return true;
+}
+
+void GameSave::eraseSaveIndex(const std::string& saveFileName) const {
+    loadSaveIndex();
+    if (saveIndex_.erase(saveFileName) > 0) {
+        storeSaveIndex();
+    }
+}
+
+void GameSave::loadSaveIndex() const {
+    if (saveIndexLoaded_) {
+        return;
+    }
+    saveIndexLoaded_ = true;
+
+    std::string data;
+    if (!readFile(kSaveIndexPath, data)) {
+        return;
+    }
+
+    // 索引损坏或版本不符时直接丢弃，后续列表会重新读取文件头
+    ByteReader reader(data.data(), data.size());
+    for (char expected : kIndexMagic) {
+        if (static_cast<char>(reader.readU8()) != expected) {
+            return;
+        }
+    }
+    if (reader.readU16() != kIndexVersion) {
+        return;
+    }
+
+    std::unordered_map<std::string, SaveIndexEntry> entries;
+    uint64_t count = reader.readVarUint();
+    for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+        std::string fileName = reader.readString();
+        SaveIndexEntry entry;
+        entry.modifiedTime = reader.readVarInt();
+        entry.fileSize = reader.readVarUint();
+        readInfo(reader, entry.info);
+        entries.emplace(std::move(fileName), std::move(entry));
+    }
+    if (reader.ok()) {
+        saveIndex_ = std::move(entries);
+    }
+}
+
+void GameSave::storeSaveIndex() const {
+    std::string data;
+    ByteWriter writer(data);
+    writer.writeBytes(kIndexMagic, sizeof(kIndexMagic));
+    writer.writeU16(kIndexVersion);
+    writer.writeVarUint(saveIndex_.size());
+    for (const auto& [fileName, entry] : saveIndex_) {
+        writer.writeString(fileName);
+        writer.writeVarInt(entry.modifiedTime);
+        writer.writeVarUint(entry.fileSize);
+        writeInfo(writer, entry.info);
+    }
+
+    // 交给后台写入器：不阻塞 UI 线程，临时文件 + 原子替换，中途崩溃不会留下半截索引；
+    // 连续多次更新只写最后一份
+    asyncWriter_.submit(kSaveIndexPath, std::move(data),
+        [this](bool, const std::string& error) { reportError(error); });
+}
@@ -0,0 +1,511 @@
+// =============================================
+// 文件: save_journal.cpp
+// 描述: 日志存档。存档槽 = 快照（.json/.sav）+ 追加日志（<存档名>.journal）。
+// 布局: 日志头 [魔数 "MUDJ"][版本 u16][快照哈希 u64]
+//       记录   [类型 u8][长度 变长][负载][校验 u32]
+//       每次保存追加一批记录并以 COMMIT 结尾；加载时只重放完整提交的批次，
+//       崩溃留下的半截批次会被忽略。快照哈希不符（快照已被整份覆盖）时日志作废。
+//       COMMIT 负载为 [保存时间][摘要]，列表读取摘要时取最后一个完整提交，无需重放。
+//       压缩时旧快照保留为 <存档名>.bak、旧日志保留为 <存档名>.journal.bak，
+//       快照损坏而从备份恢复时连同旧日志一起恢复，不丢失压缩前记录的改动。
+// =============================================
+#include "storage.h"
+#include "byte_stream.h"
+#include "save_codec.h"
+#include "save_schema.h"
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+
+namespace {
+
+constexpr char kJournalMagic[4] = {'M', 'U', 'D', 'J'};
+constexpr uint16_t kJournalVersion = 1;
+// 日志超过快照大小时压缩；快照很小时至少攒到此大小再压缩
+constexpr uint64_t kMinCompactBytes = 64 * 1024;
+
+enum RecordType : uint8_t {
+    kRecordPlayer = 1,      // 玩家标量：名称/坐标/等级/经验/上场成员/区块/背包容量
+    kRecordTeamSize = 2,    // 队伍人数
+    kRecordMember = 3,      // 单个队伍成员（含装备）
+    kRecordItemAdd = 4,     // 放入物品
+    kRecordItemRemove = 5,  // 按名称移除物品
+    kRecordItemClear = 6,   // 清空背包
+    kRecordCommit = 7       // 批次结束，负载为保存时间与存档摘要（旧日志只有保存时间）
+};
+
+uint64_t hashBytes(const char* data, size_t size) {
+    // FNV-1a 64
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint32_t recordChecksum(uint8_t type, const char* payload, size_t size) {
+    // FNV-1a 32，覆盖类型与负载
+    uint32_t hash = 2166136261u;
+    hash = (hash ^ type) * 16777619u;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(payload[i])) * 16777619u;
+    }
+    return hash;
+}
+
+void appendRecord(std::string& out, uint8_t type, const std::string& payload) {
+    ByteWriter writer(out);
+    writer.writeU8(type);
+    writer.writeVarUint(payload.size());
+    writer.writeBytes(payload.data(), payload.size());
+    writer.writeU32(recordChecksum(type, payload.data(), payload.size()));
+}
+
+std::string journalHeader(uint64_t baseHash) {
+    std::string header;
+    ByteWriter writer(header);
+    writer.writeBytes(kJournalMagic, sizeof(kJournalMagic));
+    writer.writeU16(kJournalVersion);
+    writer.writeU32(static_cast<uint32_t>(baseHash));
+    writer.writeU32(static_cast<uint32_t>(baseHash >> 32));
+    return header;
+}
+
+// 读取日志头；格式不符时返回 false
+bool readJournalHeader(ByteReader& reader, uint64_t& baseHash) {
+    bool headerValid = true;
+    for (char expected : kJournalMagic) {
+        headerValid = headerValid && static_cast<char>(reader.readU8()) == expected;
+    }
+    uint16_t version = reader.readU16();
+    baseHash = reader.readU32();
+    baseHash |= static_cast<uint64_t>(reader.readU32()) << 32;
+    return headerValid && reader.ok() && version == kJournalVersion;
+}
+
+std::string encodePlayerRecord(const Player& player, int currentBlockId) {
+    std::string payload;
+    ByteWriter writer(payload);
+    writeRecord(writer, recordOf(player));
+    writer.writeVarInt(currentBlockId);
+    writer.writeVarUint(player.inventory.getMaxCapacity());
+    return payload;
+}
+
+std::string encodeMember(const TeamMember& member) {
+    std::string payload;
+    ByteWriter writer(payload);
+    writeTeamMember(writer, member);
+    return payload;
+}
+
+std::vector<std::string> encodeMembers(const Player& player) {
+    std::vector<std::string> records;
+    records.reserve(player.teamMembers.size());
+    for (const auto& member : player.teamMembers) {
+        records.push_back(encodeMember(*member));
+    }
+    return records;
+}
+
+} // namespace
+
+std::string GameSave::getJournalFilePath(const std::string& saveFileName) const {
+    return getSaveFilePath(saveFileName) + ".journal";
+}
+
+void GameSave::beginJournal(Player& player, int currentBlockId, const std::string& loadedFileName) {
+    journal_ = JournalState{};
+    player.inventory.setItemOpCallback([this](const InventoryOp& op) { recordInventoryOp(op); });
+
+    // 刚从该存档加载且日志完整：内存状态与磁盘一致，直接接着追加
+    if (!loadedFileName.empty() && lastJournalLoad_.reusable && lastJournalLoad_.slot == loadedFileName) {
+        journal_.slot = loadedFileName;
+        journal_.baseValid = true;
+        journal_.baseHash = lastJournalLoad_.baseHash;
+        journal_.snapshotSize = lastJournalLoad_.snapshotSize;
+        journal_.journalSize = lastJournalLoad_.journalSize;
+        journal_.lastPlayerRecord = encodePlayerRecord(player, currentBlockId);
+        journal_.lastMemberRecords = encodeMembers(player);
+    }
+    lastJournalLoad_ = JournalLoad{};
+}
+
+void GameSave::recordInventoryOp(const InventoryOp& op) {
+    // 没有可接续的基线时，下次保存会写完整快照，无需记录
+    if (journal_.paused || !journal_.baseValid) {
+        return;
+    }
+
+    std::string payload;
+    ByteWriter writer(payload);
+    switch (op.kind) {
+        case InventoryOp::Kind::ADD:
+            // 物品在放入后仍可能被修改（堆叠、使用），必须立即编码
+            writeItem(writer, *op.item);
+            appendRecord(journal_.pendingOps, kRecordItemAdd, payload);
+            break;
+        case InventoryOp::Kind::REMOVE:
+            writer.writeString(op.itemName);
+            writer.writeVarInt(op.quantity);
+            appendRecord(journal_.pendingOps, kRecordItemRemove, payload);
+            break;
+        case InventoryOp::Kind::CLEAR:
+            appendRecord(journal_.pendingOps, kRecordItemClear, payload);
+            break;
+    }
+}
+
+void GameSave::saveGameJournaled(const Player& player, int currentBlockId, const std::string& saveFileName,
+                                 SaveCallback onComplete) {
+    if (slotStore_) {
+        // 容器的写入本身就是追加，整份保存即可
+        saveGameAsync(player, currentBlockId, saveFileName, std::move(onComplete));
+        return;
+    }
+    bool needSnapshot = !journal_.baseValid || journal_.slot != saveFileName ||
+                        journal_.journalSize >= std::max(kMinCompactBytes, journal_.snapshotSize);
+    if (needSnapshot) {
+        compactJournal(player, currentBlockId, saveFileName, std::move(onComplete));
+        return;
+    }
+
+    // 玩家与队伍很小，直接与上次保存的记录比较；背包取记录下来的操作
+    std::string batch;
+    std::string playerRecord = encodePlayerRecord(player, currentBlockId);
+    if (playerRecord != journal_.lastPlayerRecord) {
+        appendRecord(batch, kRecordPlayer, playerRecord);
+        journal_.lastPlayerRecord = std::move(playerRecord);
+    }
+
+    auto& lastMembers = journal_.lastMemberRecords;
+    if (lastMembers.size() != player.teamMembers.size()) {
+        std::string payload;
+        ByteWriter(payload).writeVarUint(player.teamMembers.size());
+        appendRecord(batch, kRecordTeamSize, payload);
+        lastMembers.resize(player.teamMembers.size());
+    }
+    for (size_t i = 0; i < player.teamMembers.size(); ++i) {
+        std::string member = encodeMember(*player.teamMembers[i]);
+        if (member != lastMembers[i]) {
+            std::string payload;
+            ByteWriter writer(payload);
+            writer.writeVarUint(i);
+            writer.writeBytes(member.data(), member.size());
+            appendRecord(batch, kRecordMember, payload);
+            lastMembers[i] = std::move(member);
+        }
+    }
+
+    batch += journal_.pendingOps;
+    journal_.pendingOps.clear();
+    if (batch.empty()) {
+        // 自上次保存以来没有任何改动
+        if (onComplete) {
+            onComplete(SaveResult::SUCCESS);
+        }
+        return;
+    }
+
+    std::string saveTime = getCurrentTimeString();
+    SaveInfo info = makeSaveInfo(player, saveTime);
+    std::string commit;
+    ByteWriter commitWriter(commit);
+    commitWriter.writeString(saveTime);
+    commitWriter.writeString(encodeSummary(info));
+    appendRecord(batch, kRecordCommit, commit);
+
+    // 快照尚无日志文件时，连同日志头一起写出
+    bool newJournal = journal_.journalSize == 0;
+    if (newJournal) {
+        batch.insert(0, journalHeader(journal_.baseHash));
+    }
+    journal_.journalSize += batch.size();
+
+    auto completion = [this, saveFileName, info, onComplete](bool success, const std::string& error) {
+        reportError(error);
+        if (success) {
+            updateSaveIndex(saveFileName, info);
+        } else if (journal_.slot == saveFileName) {
+            // 日志写入失败，下次保存改写完整快照
+            journal_.baseValid = false;
+        }
+        if (onComplete) {
+            onComplete(success ? SaveResult::SUCCESS : SaveResult::FILE_ERROR);
+        }
+    };
+    if (newJournal) {
+        asyncWriter_.submit(getJournalFilePath(saveFileName), std::move(batch), completion);
+    } else {
+        asyncWriter_.submitAppend(getJournalFilePath(saveFileName), std::move(batch), completion);
+    }
+}
+
+void GameSave::compactJournal(const Player& player, int currentBlockId, const std::string& saveFileName,
+                              SaveCallback onComplete) {
+    std::string saveTime = getCurrentTimeString();
+    std::string data;
+    try {
+        encodeSave(player, currentBlockId, saveTime, saveFileName, data);
+    } catch (const std::exception& e) {
+        reportError(std::string("保存游戏时发生错误: ") + e.what());
+        if (onComplete) {
+            onComplete(SaveResult::SERIALIZATION_ERROR);
+        }
+        return;
+    }
+
+    journal_.slot = saveFileName;
+    journal_.baseValid = true;
+    journal_.baseHash = hashBytes(data.data(), data.size());
+    journal_.snapshotSize = data.size();
+    journal_.lastPlayerRecord = encodePlayerRecord(player, currentBlockId);
+    journal_.lastMemberRecords = encodeMembers(player);
+    journal_.pendingOps.clear();
+    std::string header = journalHeader(journal_.baseHash);
+    journal_.journalSize = header.size();
+
+    // 先替换快照，再重置日志：两者之间崩溃时，旧日志因快照哈希不符而被忽略。
+    // 旧快照与旧日志各自保留一份备份，两者仍然配对（见 restoreJournalBackup）
+    SaveInfo info = makeSaveInfo(player, saveTime);
+    asyncWriter_.submit(getSaveFilePath(saveFileName), std::move(data),
+        [this, saveFileName, info, onComplete](bool success, const std::string& error) {
+            reportError(error);
+            if (success) {
+                updateSaveIndex(saveFileName, info);
+            } else if (journal_.slot == saveFileName) {
+                journal_.baseValid = false;
+            }
+            if (onComplete) {
+                onComplete(success ? SaveResult::SUCCESS : SaveResult::FILE_ERROR);
+            }
+        }, true);
+    asyncWriter_.submit(getJournalFilePath(saveFileName), std::move(header),
+        [this, saveFileName](bool success, const std::string& error) {
+            reportError(error);
+            if (!success && journal_.slot == saveFileName) {
+                journal_.baseValid = false;
+            }
+        }, true);
+}
+
+void GameSave::restoreJournalBackup(const MappedFile& snapshot, const std::string& saveFileName) {
+    // 快照备份之后的改动在压缩前的日志里；当前日志接在已损坏的快照之后，重放时会被丢弃
+    uint64_t snapshotHash = hashBytes(snapshot.data(), snapshot.size());
+    std::string journalPath = getJournalFilePath(saveFileName);
+    std::string journal;
+    uint64_t baseHash = 0;
+    if (readFile(journalPath, journal)) {
+        ByteReader reader(journal.data(), journal.size());
+        if (readJournalHeader(reader, baseHash) && baseHash == snapshotHash) {
+            return;
+        }
+    }
+    std::string backup;
+    if (!readFile(AsyncSaveWriter::backupPathFor(journalPath), backup)) {
+        return;
+    }
+    ByteReader reader(backup.data(), backup.size());
+    if (readJournalHeader(reader, baseHash) && baseHash == snapshotHash) {
+        std::string error;
+        if (!AsyncSaveWriter::writeFileAtomically(journalPath, backup, false, &error)) {
+            loadWarnings_.push_back(error);
+        }
+    }
+}
+
+bool GameSave::readJournalSummary(const std::string& filePath, const MappedFile& snapshot, SaveInfo& info) const {
+    std::string journal;
+    if (!readFile(filePath + ".journal", journal)) {
+        return false;
+    }
+
+    ByteReader reader(journal.data(), journal.size());
+    uint64_t baseHash = 0;
+    if (!readJournalHeader(reader, baseHash) || baseHash != hashBytes(snapshot.data(), snapshot.size())) {
+        return false;
+    }
+
+    // 只看 COMMIT 记录，其后没有提交的半截批次不计入
+    std::string saveTime;
+    std::string summary;
+    while (!reader.atEnd()) {
+        uint8_t type = reader.readU8();
+        uint64_t size = reader.readVarUint();
+        const char* payload = reader.readBytes(size);
+        uint32_t checksum = reader.readU32();
+        if (!reader.ok() || checksum != recordChecksum(type, payload, static_cast<size_t>(size))) {
+            break;
+        }
+        if (type == kRecordCommit) {
+            ByteReader commitReader(payload, static_cast<size_t>(size));
+            saveTime = commitReader.readString();
+            std::string committedSummary = commitReader.readString();
+            if (commitReader.ok()) {
+                summary = std::move(committedSummary);
+            }
+        }
+    }
+    if (saveTime.empty()) {
+        return false;
+    }
+
+    bool corrupt = info.corrupt;
+    if (!summary.empty()) {
+        decodeSummary(summary, info);
+    }
+    info.saveTime = saveTime;
+    info.corrupt = corrupt;
+    return true;
+}
+
+SaveResult GameSave::replayJournal(const MappedFile& snapshot, Player& player, int& currentBlockId,
+                                   std::string& saveTime, const std::string& saveFileName) {
+    lastJournalLoad_ = JournalLoad{};
+    lastJournalLoad_.slot = saveFileName;
+    lastJournalLoad_.baseHash = hashBytes(snapshot.data(), snapshot.size());
+    lastJournalLoad_.snapshotSize = snapshot.size();
+    lastJournalLoad_.reusable = true;
+
+    std::string journalPath = getJournalFilePath(saveFileName);
+    std::string journal;
+    if (!readFile(journalPath, journal)) {
+        return SaveResult::SUCCESS;
+    }
+
+    ByteReader reader(journal.data(), journal.size());
+    uint64_t baseHash = 0;
+    if (!readJournalHeader(reader, baseHash) || baseHash != lastJournalLoad_.baseHash) {
+        // 快照已被整份覆盖，日志中的改动已包含在快照里；
+        // 日志接在被覆盖的快照（即快照备份）之后，留作日志备份
+        std::error_code error;
+        std::filesystem::rename(journalPath, AsyncSaveWriter::backupPathFor(journalPath), error);
+        return SaveResult::SUCCESS;
+    }
+
+    // 重放期间放开容量限制：玩家记录（含容量）写在每批开头，而背包操作发生在其前
+    int activeIndex = recordOf(player).activeMemberIndex;
+    size_t capacity = player.inventory.getMaxCapacity();
+    player.inventory.setMaxCapacity(std::numeric_limits<size_t>::max());
+
+    struct Record {
+        uint8_t type;
+        const char* payload;
+        size_t size;
+    };
+    std::vector<Record> batch;
+    std::vector<std::shared_ptr<Item>> pendingAdds;
+    // 连续的放入操作合并为一次批量放入，结果与逐个放入相同
+    auto flushAdds = [&]() {
+        if (!pendingAdds.empty()) {
+            player.inventory.addItems(pendingAdds);
+            pendingAdds.clear();
+        }
+    };
+
+    size_t committedEnd = reader.position();
+    bool torn = false;
+    // 无效的记录跳过后继续重放，结束时汇总为加载警告
+    size_t skippedMembers = 0;
+    size_t skippedItems = 0;
+    std::vector<std::string> unremovedItems;
+    while (!reader.atEnd()) {
+        uint8_t type = reader.readU8();
+        uint64_t size = reader.readVarUint();
+        const char* payload = reader.readBytes(size);
+        uint32_t checksum = reader.readU32();
+        if (!reader.ok() || checksum != recordChecksum(type, payload, static_cast<size_t>(size))) {
+            torn = true;
+            break;
+        }
+        if (type != kRecordCommit) {
+            batch.push_back({type, payload, static_cast<size_t>(size)});
+            continue;
+        }
+
+        for (const Record& record : batch) {
+            ByteReader recordReader(record.payload, record.size);
+            if (record.type != kRecordItemAdd) {
+                flushAdds();
+            }
+            switch (record.type) {
+                case kRecordPlayer: {
+                    PlayerRecord playerRecord;
+                    readRecord(recordReader, playerRecord);
+                    applyRecord(playerRecord, player);
+                    activeIndex = playerRecord.activeMemberIndex;
+                    currentBlockId = static_cast<int>(recordReader.readVarInt());
+                    capacity = static_cast<size_t>(recordReader.readVarUint());
+                    break;
+                }
+                case kRecordTeamSize:
+                    player.teamMembers.resize(static_cast<size_t>(recordReader.readVarUint()));
+                    break;
+                case kRecordMember: {
+                    size_t index = static_cast<size_t>(recordReader.readVarUint());
+                    auto member = readTeamMember(recordReader);
+                    if (member && index < player.teamMembers.size()) {
+                        player.teamMembers[index] = member;
+                    } else {
+                        ++skippedMembers;
+                    }
+                    break;
+                }
+                case kRecordItemAdd:
+                    if (auto item = readItem(recordReader)) {
+                        pendingAdds.push_back(item);
+                    } else {
+                        ++skippedItems;
+                    }
+                    break;
+                case kRecordItemRemove: {
+                    std::string name = recordReader.readString();
+                    int quantity = static_cast<int>(recordReader.readVarInt());
+                    if (player.inventory.removeItem(name, quantity) != InventoryResult::SUCCESS) {
+                        unremovedItems.push_back(name);
+                    }
+                    break;
+                }
+                case kRecordItemClear:
+                    player.inventory.removeAllItems();
+                    break;
+                default:
+                    // 未知记录类型（更新版本写入），忽略
+                    break;
+            }
+        }
+        flushAdds();
+        batch.clear();
+        saveTime = ByteReader(payload, static_cast<size_t>(size)).readString();
+        committedEnd = reader.position();
+    }
+
+    // 队伍人数变化后未被成员记录填上的空位（日志不完整时）直接去掉
+    player.teamMembers.erase(std::remove(player.teamMembers.begin(), player.teamMembers.end(), nullptr),
+                             player.teamMembers.end());
+    player.activeMember = nullptr;
+    restoreActiveMember(player, activeIndex);
+    player.inventory.setMaxCapacity(capacity);
+
+    if (skippedMembers > 0) {
+        loadWarnings_.push_back("存档日志中有 " + std::to_string(skippedMembers) + " 条队伍成员记录无效，已跳过");
+    }
+    if (skippedItems > 0) {
+        loadWarnings_.push_back("存档日志中有 " + std::to_string(skippedItems) + " 条物品记录无效，已跳过");
+    }
+    if (!unremovedItems.empty()) {
+        std::string names;
+        for (const std::string& name : unremovedItems) {
+            names += (names.empty() ? "" : "、") + name;
+        }
+        loadWarnings_.push_back("存档日志重放时无法移除物品: " + names);
+    }
+    if (torn || !batch.empty()) {
+        // 末尾是崩溃留下的未提交批次：已忽略，下次保存重写快照以丢弃残留
+        loadWarnings_.push_back("存档日志末尾不完整，已忽略未提交的记录");
+        lastJournalLoad_.reusable = false;
+    }
+    lastJournalLoad_.journalSize = committedEnd;
+    return SaveResult::SUCCESS;
+}
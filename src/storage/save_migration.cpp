@@ -0,0 +1,304 @@
+// =============================================
+// 文件: save_migration.cpp
+// 描述: 迁移步骤登记、迁移计划的合成，以及 saves/ 目录的批量升级。
+// =============================================
+#include "save_migration.h"
+#include "storage.h"
+#include "lz_codec.h"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <iostream>
+#include <istream>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+std::vector<SaveMigration>& registeredMigrations() {
+    static std::vector<SaveMigration> migrations = {
+        // 版本号从末尾的字符串 "version" 改为排在记录之前的整数 "formatVersion"，记录字段不变
+        {1, "formatVersion", {}},
+    };
+    return migrations;
+}
+
+} // namespace
+
+const std::vector<SaveMigration>& saveMigrations() {
+    return registeredMigrations();
+}
+
+void replaceSaveMigrations(std::vector<SaveMigration> migrations) {
+    registeredMigrations() = std::move(migrations);
+    MigrationPlan::plans() = MigrationPlan::composePlans();
+}
+
+MigrationPlan::MigrationPlan(int version) {
+    for (const SaveMigration& step : saveMigrations()) {
+        if (step.fromVersion < version) {
+            continue;
+        }
+        for (const KeyRename& rename : step.renames) {
+            // 前面步骤已改名到 rename.from 的键接着改名；原始键名直接为 rename.from 的另记一条
+            bool original = true;
+            for (KeyRename& composed : renames_) {
+                if (composed.kind != rename.kind) {
+                    continue;
+                }
+                if (composed.to == rename.from) {
+                    composed.to = rename.to;
+                }
+                if (composed.from == rename.from) {
+                    original = false;
+                }
+            }
+            if (original) {
+                renames_.push_back(rename);
+            }
+        }
+        if (step.upgradePlayer) {
+            playerSteps_.push_back(step.upgradePlayer);
+        }
+        if (step.upgradeMember) {
+            memberSteps_.push_back(step.upgradeMember);
+        }
+        if (step.upgradeItem) {
+            itemSteps_.push_back(step.upgradeItem);
+        }
+    }
+}
+
+bool MigrationPlan::empty() const {
+    return renames_.empty() && playerSteps_.empty() && memberSteps_.empty() && itemSteps_.empty();
+}
+
+std::vector<MigrationPlan> MigrationPlan::composePlans() {
+    std::vector<MigrationPlan> result;
+    for (int from = kLegacySaveSchemaVersion; from < kSaveSchemaVersion; ++from) {
+        result.push_back(MigrationPlan(from));
+    }
+    return result;
+}
+
+std::vector<MigrationPlan>& MigrationPlan::plans() {
+    // 每个旧版本的计划只合成一次（替换登记的步骤时重新合成）
+    static std::vector<MigrationPlan> composed = composePlans();
+    return composed;
+}
+
+const MigrationPlan* MigrationPlan::planFor(int version) {
+    if (version >= kSaveSchemaVersion) {
+        return nullptr;
+    }
+    const MigrationPlan& plan = plans()[static_cast<size_t>(std::max(version, kLegacySaveSchemaVersion) -
+                                                            kLegacySaveSchemaVersion)];
+    return plan.empty() ? nullptr : &plan;
+}
+
+std::string_view MigrationPlan::renameKey(RecordKind kind, std::string_view key) const {
+    for (const KeyRename& rename : renames_) {
+        if (rename.kind == kind && rename.from == key) {
+            return rename.to;
+        }
+    }
+    return key;
+}
+
+void MigrationPlan::upgrade(PlayerRecord& record) const {
+    for (auto step : playerSteps_) {
+        step(record);
+    }
+}
+
+void MigrationPlan::upgrade(MemberRecord& record) const {
+    for (auto step : memberSteps_) {
+        step(record);
+    }
+}
+
+void MigrationPlan::upgrade(ItemRecord& record) const {
+    for (auto step : itemSteps_) {
+        step(record);
+    }
+}
+
+namespace {
+
+// 只读出顶层 formatVersion：遇到第一个顶层对象（"meta" 或 "player"）即中止，
+// 当前版本的存档不会被读到记录部分
+class SchemaVersionSax : public nlohmann::json_sax<nlohmann::json> {
+public:
+    int version = kLegacySaveSchemaVersion;
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_unsigned(number_unsigned_t value) override { return integer(static_cast<int64_t>(value)); }
+    bool number_float(number_float_t, const string_t&) override { return true; }
+    bool string(string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+    bool start_object(std::size_t) override { return ++depth_ <= 1; }
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+    bool start_array(std::size_t) override { return ++depth_ <= 1; }
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+    bool key(string_t& value) override {
+        versionKey_ = depth_ == 1 && value == "formatVersion";
+        return true;
+    }
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override {
+        return false;
+    }
+
+private:
+    bool integer(int64_t value) {
+        if (versionKey_) {
+            version = static_cast<int>(value);
+            return false;
+        }
+        return true;
+    }
+
+    int depth_ = 0;
+    bool versionKey_ = false;
+};
+
+int readSchemaVersion(const MappedFile& file) {
+    SchemaVersionSax sax;
+    if (LzCodec::isCompressed(file.data(), file.size())) {
+        LzInputBuffer buffer(file.data(), file.size());
+        std::istream stream(&buffer);
+        nlohmann::json::sax_parse(stream, &sax);
+    } else {
+        nlohmann::json::sax_parse(file.data(), file.data() + file.size(), &sax);
+    }
+    return sax.version;
+}
+
+} // namespace
+
+GameSave::MigrationReport GameSave::migrateSaveDirectory(unsigned workerCount) {
+    MigrationReport report;
+    if (slotStore_) {
+        std::cerr << "单文件容器模式下存档不在目录中，请先停用容器再升级" << std::endl;
+        return report;
+    }
+    asyncWriter_.waitIdle();
+
+    // 二进制存档按字段表顺序编码，不需要迁移
+    auto isBinaryImage = [](const MappedFile& file) {
+        if (!LzCodec::isCompressed(file.data(), file.size())) {
+            return isBinarySave(file.data(), file.size());
+        }
+        char header[8] = {};
+        LzInputBuffer buffer(file.data(), file.size());
+        std::istream stream(&buffer);
+        stream.read(header, sizeof(header));
+        return isBinarySave(header, sizeof(header));
+    };
+
+    std::vector<std::string> plain;
+    std::vector<std::string> journaled;
+    for (const std::string& fileName : listSaveFiles()) {
+        std::error_code error;
+        if (std::filesystem::exists(getJournalFilePath(fileName), error)) {
+            journaled.push_back(fileName);
+        } else {
+            plain.push_back(fileName);
+        }
+    }
+
+    // 普通存档互不相关，分给多个线程各自解码、重写
+    std::atomic<size_t> next{0};
+    std::mutex reportMutex;
+    std::vector<std::string> rewritten;
+    auto upgradeFiles = [&]() {
+        for (size_t i = next++; i < plain.size(); i = next++) {
+            const std::string& fileName = plain[i];
+            bool upgraded = false;
+            bool failed = false;
+            try {
+                std::shared_ptr<const MappedFile> file = MappedFile::open(getSaveFilePath(fileName));
+                if (!file) {
+                    failed = true;
+                } else if (!isBinaryImage(*file) && readSchemaVersion(*file) < kSaveSchemaVersion) {
+                    Player player("", 0, 0);
+                    int currentBlockId = 0;
+                    std::string saveTime;
+                    std::string data;
+                    if (decodeSnapshot(file, player, currentBlockId, saveTime, fileName) != SaveResult::SUCCESS) {
+                        failed = true;
+                    } else {
+                        encodeSave(player, currentBlockId, saveTime, fileName, data);
+                        // 原本压缩的存档升级后仍然压缩
+                        if (LzCodec::isCompressed(file->data(), file->size()) && !LzCodec::isCompressed(data)) {
+                            data = LzCodec::compress(data);
+                        }
+                        file.reset();
+                        failed = !AsyncSaveWriter::writeFileAtomically(getSaveFilePath(fileName), data, true);
+                        upgraded = !failed;
+                    }
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "升级存档时发生错误（" << fileName << "）: " << e.what() << std::endl;
+                failed = true;
+            }
+
+            std::lock_guard<std::mutex> lock(reportMutex);
+            if (failed) {
+                ++report.failed;
+            } else if (upgraded) {
+                ++report.upgraded;
+                rewritten.push_back(fileName);
+            } else {
+                ++report.current;
+            }
+        }
+    };
+
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workerCount = static_cast<unsigned>(std::min<size_t>(workerCount, std::max<size_t>(plain.size(), 1)));
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < workerCount; ++i) {
+        workers.emplace_back(upgradeFiles);
+    }
+    upgradeFiles();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::string& fileName : rewritten) {
+        eraseSaveIndex(fileName);
+    }
+
+    // 带日志的存档槽涉及日志状态，在调用线程依次处理：重放日志后整份重写
+    for (const std::string& fileName : journaled) {
+        std::shared_ptr<const MappedFile> file = MappedFile::open(getSaveFilePath(fileName));
+        if (!file || isBinaryImage(*file) || readSchemaVersion(*file) >= kSaveSchemaVersion) {
+            ++(file ? report.current : report.failed);
+            continue;
+        }
+        file.reset();
+        Player player("", 0, 0);
+        int currentBlockId = 0;
+        std::string saveTime;
+        if (readSave(player, currentBlockId, saveTime, fileName) != SaveResult::SUCCESS ||
+            writeSave(player, currentBlockId, saveTime, fileName) != SaveResult::SUCCESS) {
+            ++report.failed;
+            continue;
+        }
+        // 旧日志与旧快照的备份配对，同样留作备份
+        std::error_code error;
+        std::filesystem::rename(getJournalFilePath(fileName),
+                                AsyncSaveWriter::backupPathFor(getJournalFilePath(fileName)), error);
+        ++report.upgraded;
+    }
+    return report;
+}
@@ -0,0 +1,75 @@
+// =============================================
+// 文件: save_migration.h
+// 描述: JSON 存档的结构版本与迁移步骤。每个步骤把存档从版本 N 升到 N + 1，
+//       由键改名表与记录修正函数组成，在流式加载时逐键、逐记录应用，
+//       不为中间版本生成 JSON DOM。
+// 说明: 版本号写在顶层 "formatVersion"（键名排在 "meta" 与 "player" 之前，
+//       加载器读到任何记录前即知道版本）。版本 1 的存档只在末尾写有 "version": "1.0"，
+//       没有 formatVersion 的存档都按版本 1 处理。
+//       当前版本的存档不经过任何迁移逻辑（planFor 返回 nullptr）。
+//       二进制存档按字段表顺序编码、只能在表尾追加字段，不需要迁移。
+//       修改字段表中的键名或含义时：提高 kSaveSchemaVersion，并在 save_migration.cpp 中登记一步。
+// =============================================
+#pragma once
+#include "save_schema.h"
+#include <string_view>
+#include <vector>
+
+constexpr int kSaveSchemaVersion = 2;
+constexpr int kLegacySaveSchemaVersion = 1;   // 没有 formatVersion 键的存档
+
+// 迁移步骤作用的记录
+enum class RecordKind {
+    PLAYER,
+    MEMBER,
+    ITEM
+};
+
+struct KeyRename {
+    RecordKind kind;
+    std::string_view from;
+    std::string_view to;
+};
+
+struct SaveMigration {
+    int fromVersion;                       // 把 fromVersion 升到 fromVersion + 1
+    std::string_view description;
+    std::vector<KeyRename> renames;        // 旧键名 -> 新键名，在字段查表之前替换
+    void (*upgradePlayer)(PlayerRecord&) = nullptr;
+    void (*upgradeMember)(MemberRecord&) = nullptr;
+    void (*upgradeItem)(ItemRecord&) = nullptr;
+};
+
+// 从某一版本升到当前版本的合成计划：连续的改名合成一次查表，修正函数按步骤顺序调用
+class MigrationPlan {
+public:
+    // version 为当前版本、比当前版本新，或合成后没有任何改动时返回 nullptr
+    static const MigrationPlan* planFor(int version);
+
+    // 迁移后的键名；不需改名时原样返回
+    std::string_view renameKey(RecordKind kind, std::string_view key) const;
+    void upgrade(PlayerRecord& record) const;
+    void upgrade(MemberRecord& record) const;
+    void upgrade(ItemRecord& record) const;
+
+private:
+    friend void replaceSaveMigrations(std::vector<SaveMigration> migrations);
+
+    explicit MigrationPlan(int version);
+    bool empty() const;
+    // 各旧版本合成好的计划，下标为 version - kLegacySaveSchemaVersion
+    static std::vector<MigrationPlan>& plans();
+    static std::vector<MigrationPlan> composePlans();
+
+    std::vector<KeyRename> renames_;       // from 为原始键名，to 为最终键名
+    std::vector<void (*)(PlayerRecord&)> playerSteps_;
+    std::vector<void (*)(MemberRecord&)> memberSteps_;
+    std::vector<void (*)(ItemRecord&)> itemSteps_;
+};
+
+// 已登记的迁移步骤，按 fromVersion 递增排列
+const std::vector<SaveMigration>& saveMigrations();
+
+// 以 migrations 替换已登记的步骤并重新合成计划（供测试注入迁移步骤）。
+// 不得与存档加载并发调用
+void replaceSaveMigrations(std::vector<SaveMigration> migrations);
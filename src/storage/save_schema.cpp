@@ -0,0 +1,114 @@
+// =============================================
+// 文件: save_schema.cpp
+// 描述: 游戏对象与存档记录之间的转换。
+// =============================================
+#include "save_schema.h"
+
+ItemRecord recordOf(const Item& item) {
+    ItemRecord record;
+    record.type = item.getType();
+    record.rarity = item.getRarity();
+    record.name = item.getName();
+    record.description = item.getDescription();
+    record.quantity = item.getQuantity();
+
+    switch (item.getType()) {
+        case ItemType::WEAPON: {
+            const auto& weapon = static_cast<const Weapon&>(item);
+            record.weaponType = weapon.getWeaponType();
+            record.attackPower = weapon.getAttackPower();
+            record.durability = weapon.getDurability();
+            break;
+        }
+        case ItemType::ARTIFACT: {
+            const auto& artifact = static_cast<const Artifact&>(item);
+            record.artifactType = artifact.getArtifactType();
+            record.mainStat = artifact.getMainStat();
+            record.subStats = artifact.getSubStats();
+            break;
+        }
+        case ItemType::FOOD: {
+            const auto& food = static_cast<const Food&>(item);
+            record.foodType = food.getFoodType();
+            record.effectValue = food.getEffectValue();
+            record.duration = food.getDuration();
+            break;
+        }
+        case ItemType::MATERIAL: {
+            const auto& material = static_cast<const Material&>(item);
+            record.materialType = material.getMaterialType();
+            record.isStackable = material.isStackable();
+            break;
+        }
+    }
+    return record;
+}
+
+MemberRecord recordOf(const TeamMember& member) {
+    MemberRecord record;
+    record.name = member.getName();
+    record.level = member.getLevel();
+    record.currentHealth = member.getCurrentHealth();
+    record.baseHealth = member.getBaseHealth();
+    record.baseAttack = member.getBaseAttack();
+    record.baseDefense = member.getBaseDefense();
+    record.status = member.getStatus();
+    return record;
+}
+
+PlayerRecord recordOf(const Player& player) {
+    PlayerRecord record;
+    record.name = player.name;
+    record.x = player.x;
+    record.y = player.y;
+    record.level = player.level;
+    record.experience = player.experience;
+    for (size_t i = 0; i < player.teamMembers.size(); ++i) {
+        if (player.teamMembers[i] == player.activeMember) {
+            record.activeMemberIndex = static_cast<int>(i);
+            break;
+        }
+    }
+    return record;
+}
+
+std::shared_ptr<Item> makeItem(const ItemRecord& record) {
+    std::shared_ptr<Item> item;
+    switch (record.type) {
+        case ItemType::WEAPON:
+            item = std::make_shared<Weapon>(record.name, record.weaponType, record.rarity, record.description,
+                                            record.attackPower, record.durability);
+            break;
+        case ItemType::ARTIFACT:
+            item = std::make_shared<Artifact>(record.name, record.artifactType, record.rarity, record.description,
+                                              record.mainStat, record.subStats);
+            break;
+        case ItemType::FOOD:
+            item = std::make_shared<Food>(record.name, record.foodType, record.rarity, record.description,
+                                          record.effectValue, record.duration);
+            break;
+        case ItemType::MATERIAL:
+            item = std::make_shared<Material>(record.name, record.materialType, record.rarity, record.description,
+                                              record.isStackable);
+            break;
+    }
+    if (item) {
+        item->setQuantity(record.quantity);
+    }
+    return item;
+}
+
+std::shared_ptr<TeamMember> makeMember(const MemberRecord& record) {
+    auto member = std::make_shared<TeamMember>(record.name, record.level);
+    member->setCurrentHealth(record.currentHealth ? *record.currentHealth : member->getTotalHealth());
+    member->setStatus(record.status);
+    return member;
+}
+
+void applyRecord(const PlayerRecord& record, Player& player) {
+    player.name = record.name;
+    player.x = record.x;
+    player.y = record.y;
+    player.level = record.level;
+    player.experience = record.experience;
+}
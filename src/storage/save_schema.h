@@ -0,0 +1,311 @@
+// =============================================
+// 文件: save_schema.h
+// 描述: 存档字段表。玩家、队伍成员与物品先转成平铺的记录结构，
+//       每种记录的字段在编译期表中声明一次（键名 + 成员指针），
+//       JSON 保存、JSON 流式加载、二进制编码与解码都按同一张表展开。
+// 说明: 新增字段只需在记录结构与字段表中各加一行。
+//       二进制按表中顺序写出，整数为变长编码、枚举按序号、布尔占一字节，
+//       因此只能在表尾追加字段，不能调整已有字段的顺序。
+//       JSON 加载时键名经编译期完美哈希映射为字段下标（见 enum_names.h），
+//       再按下标直接赋值，不逐个比较字符串。
+// =============================================
+#pragma once
+#include "byte_stream.h"
+#include "../core/enum_names.h"
+#include "../core/item.h"
+#include "../core/team_member.h"
+#include "../player/player.h"
+#include <nlohmann/json.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 字段描述：键名、成员指针，以及字段所属的变体（物品类型；-1 表示所有变体共有）
+template <typename Record, typename T>
+struct FieldInfo {
+    std::string_view key;
+    T Record::*member;
+    int variant;
+};
+
+template <typename Record, typename T>
+constexpr FieldInfo<Record, T> field(std::string_view key, T Record::*member, int variant = -1) {
+    return {key, member, variant};
+}
+
+// ---------------------------------------------------------------------------
+// 记录结构：字段默认值即旧存档缺少该字段时的取值
+
+struct ItemRecord {
+    ItemType type = ItemType::WEAPON;
+    Rarity rarity = Rarity::ONE_STAR;
+    std::string name;
+    std::string description;
+    int quantity = 1;
+    WeaponType weaponType = WeaponType::ONE_HANDED_SWORD;
+    int attackPower = 0;
+    int durability = 100;
+    ArtifactType artifactType = ArtifactType::FLOWER_OF_LIFE;
+    std::string mainStat;
+    std::vector<std::string> subStats;
+    FoodType foodType = FoodType::RECOVERY;
+    int effectValue = 0;
+    int duration = 0;
+    MaterialType materialType = MaterialType::MONSTER_DROP;
+    bool isStackable = true;
+};
+
+struct MemberRecord {
+    std::string name;
+    int level = 1;
+    std::optional<int> currentHealth;   // 缺省时为满血
+    // 基础属性由等级推导，仅作记录
+    int baseHealth = 0;
+    int baseAttack = 0;
+    int baseDefense = 0;
+    MemberStatus status = MemberStatus::STANDBY;
+};
+
+struct PlayerRecord {
+    std::string name;
+    int x = 0;
+    int y = 0;
+    int level = 1;
+    int experience = 0;
+    int activeMemberIndex = -1;
+};
+
+ItemRecord recordOf(const Item& item);
+MemberRecord recordOf(const TeamMember& member);
+PlayerRecord recordOf(const Player& player);
+
+std::shared_ptr<Item> makeItem(const ItemRecord& record);
+// 不含装备，装备由调用方另行放入
+std::shared_ptr<TeamMember> makeMember(const MemberRecord& record);
+// 只写入标量字段；队伍与背包由调用方恢复
+void applyRecord(const PlayerRecord& record, Player& player);
+
+// ---------------------------------------------------------------------------
+// 字段表
+
+namespace save_schema {
+
+constexpr int variantOf(ItemType type) { return static_cast<int>(type); }
+
+inline constexpr auto kItemFields = std::make_tuple(
+    field("type", &ItemRecord::type),
+    field("rarity", &ItemRecord::rarity),
+    field("name", &ItemRecord::name),
+    field("description", &ItemRecord::description),
+    field("quantity", &ItemRecord::quantity),
+    field("weaponType", &ItemRecord::weaponType, variantOf(ItemType::WEAPON)),
+    field("attackPower", &ItemRecord::attackPower, variantOf(ItemType::WEAPON)),
+    field("durability", &ItemRecord::durability, variantOf(ItemType::WEAPON)),
+    field("artifactType", &ItemRecord::artifactType, variantOf(ItemType::ARTIFACT)),
+    field("mainStat", &ItemRecord::mainStat, variantOf(ItemType::ARTIFACT)),
+    field("subStats", &ItemRecord::subStats, variantOf(ItemType::ARTIFACT)),
+    field("foodType", &ItemRecord::foodType, variantOf(ItemType::FOOD)),
+    field("effectValue", &ItemRecord::effectValue, variantOf(ItemType::FOOD)),
+    field("duration", &ItemRecord::duration, variantOf(ItemType::FOOD)),
+    field("materialType", &ItemRecord::materialType, variantOf(ItemType::MATERIAL)),
+    field("isStackable", &ItemRecord::isStackable, variantOf(ItemType::MATERIAL)));
+
+inline constexpr auto kMemberFields = std::make_tuple(
+    field("name", &MemberRecord::name),
+    field("level", &MemberRecord::level),
+    field("currentHealth", &MemberRecord::currentHealth),
+    field("baseHealth", &MemberRecord::baseHealth),
+    field("baseAttack", &MemberRecord::baseAttack),
+    field("baseDefense", &MemberRecord::baseDefense),
+    field("status", &MemberRecord::status));
+
+inline constexpr auto kPlayerFields = std::make_tuple(
+    field("name", &PlayerRecord::name),
+    field("x", &PlayerRecord::x),
+    field("y", &PlayerRecord::y),
+    field("level", &PlayerRecord::level),
+    field("experience", &PlayerRecord::experience),
+    field("activeMemberIndex", &PlayerRecord::activeMemberIndex));
+
+// 记录类型 -> 字段表
+constexpr const auto& fieldsOf(const ItemRecord&) { return kItemFields; }
+constexpr const auto& fieldsOf(const MemberRecord&) { return kMemberFields; }
+constexpr const auto& fieldsOf(const PlayerRecord&) { return kPlayerFields; }
+constexpr int variantOf(const ItemRecord& record) { return variantOf(record.type); }
+constexpr int variantOf(const MemberRecord&) { return -1; }
+constexpr int variantOf(const PlayerRecord&) { return -1; }
+
+// 按表中顺序对属于 variant 的字段调用 visit(字段描述)
+template <typename Fields, typename Visit>
+void forEachField(const Fields& fields, int variant, Visit&& visit) {
+    std::apply([&](const auto&... info) {
+        ((info.variant < 0 || info.variant == variant ? visit(info) : void()), ...);
+    }, fields);
+}
+
+// 对下标为 index 的字段调用 visit；下标越界时不调用
+template <typename Fields, typename Visit, size_t... I>
+void visitField(const Fields& fields, size_t index, Visit&& visit, std::index_sequence<I...>) {
+    ((index == I ? visit(std::get<I>(fields)) : void()), ...);
+}
+
+// 键名 -> 字段下标的完美哈希，在编译期构建
+template <typename Fields, size_t... I>
+constexpr auto makeKeyIndex(const Fields& fields, std::index_sequence<I...>) {
+    const EnumEntry<size_t> entries[] = {{std::get<I>(fields).key, I}...};
+    return EnumNames<size_t, sizeof...(I)>(entries);
+}
+
+template <typename Fields>
+constexpr auto makeKeyIndex(const Fields& fields) {
+    return makeKeyIndex(fields, std::make_index_sequence<std::tuple_size_v<Fields>>{});
+}
+
+inline constexpr auto kItemKeys = makeKeyIndex(kItemFields);
+inline constexpr auto kMemberKeys = makeKeyIndex(kMemberFields);
+inline constexpr auto kPlayerKeys = makeKeyIndex(kPlayerFields);
+static_assert(kItemKeys.valid() && kMemberKeys.valid() && kPlayerKeys.valid(), "存档字段表中有重复的键名");
+
+constexpr const auto& keysOf(const ItemRecord&) { return kItemKeys; }
+constexpr const auto& keysOf(const MemberRecord&) { return kMemberKeys; }
+constexpr const auto& keysOf(const PlayerRecord&) { return kPlayerKeys; }
+
+// ---------------------------------------------------------------------------
+// 单个值的二进制编码
+
+inline void writeValue(ByteWriter& writer, int value) { writer.writeVarInt(value); }
+inline void writeValue(ByteWriter& writer, bool value) { writer.writeU8(value ? 1 : 0); }
+inline void writeValue(ByteWriter& writer, const std::string& value) { writer.writeString(value); }
+inline void writeValue(ByteWriter& writer, const std::optional<int>& value) { writer.writeVarInt(value.value_or(0)); }
+inline void writeValue(ByteWriter& writer, const std::vector<std::string>& values) {
+    writer.writeVarUint(values.size());
+    for (const auto& value : values) {
+        writer.writeString(value);
+    }
+}
+template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+void writeValue(ByteWriter& writer, Enum value) {
+    writer.writeU8(static_cast<uint8_t>(value));
+}
+
+// 返回 false 表示值无效（枚举越界）；越界读取由 reader.ok() 反映
+inline bool readValue(ByteReader& reader, int& value) {
+    value = static_cast<int>(reader.readVarInt());
+    return true;
+}
+inline bool readValue(ByteReader& reader, bool& value) {
+    value = reader.readU8() != 0;
+    return true;
+}
+inline bool readValue(ByteReader& reader, std::string& value) {
+    value = reader.readString();
+    return true;
+}
+inline bool readValue(ByteReader& reader, std::optional<int>& value) {
+    value = static_cast<int>(reader.readVarInt());
+    return true;
+}
+inline bool readValue(ByteReader& reader, std::vector<std::string>& values) {
+    uint64_t count = reader.readVarUint();
+    values.clear();
+    for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+        values.push_back(reader.readString());
+    }
+    return true;
+}
+template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+bool readValue(ByteReader& reader, Enum& value) {
+    int raw = reader.readU8();
+    if (!isEnumValue<Enum>(raw)) {
+        return false;
+    }
+    value = static_cast<Enum>(raw);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// 单个值的 JSON 表示（保存时）
+
+template <typename T>
+void putJson(nlohmann::json& object, std::string_view key, const T& value) {
+    if constexpr (std::is_enum_v<T>) {
+        object[std::string(key)] = std::string(enumName(value));
+    } else {
+        object[std::string(key)] = value;
+    }
+}
+
+inline void putJson(nlohmann::json& object, std::string_view key, const std::optional<int>& value) {
+    if (value) {
+        object[std::string(key)] = *value;
+    }
+}
+
+// JSON 加载时按 SAX 事件赋值；类型不符的值忽略，字段保持默认值
+inline void assignJson(int& target, int64_t value) { target = static_cast<int>(value); }
+inline void assignJson(std::optional<int>& target, int64_t value) { target = static_cast<int>(value); }
+inline void assignJson(bool& target, bool value) { target = value; }
+inline void assignJson(std::string& target, std::string&& value) { target = std::move(value); }
+// 字符串数组按元素逐个追加
+inline void assignJson(std::vector<std::string>& target, std::string&& value) { target.push_back(std::move(value)); }
+template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+void assignJson(Enum& target, std::string&& value) {
+    target = parseEnum(value, target);
+}
+template <typename T, typename V>
+void assignJson(T&, V&&) {}
+
+} // namespace save_schema
+
+// ---------------------------------------------------------------------------
+// 记录的整体编解码
+
+template <typename Record>
+void writeRecord(ByteWriter& writer, const Record& record) {
+    save_schema::forEachField(save_schema::fieldsOf(record), save_schema::variantOf(record),
+        [&](const auto& info) { save_schema::writeValue(writer, record.*info.member); });
+}
+
+// 变体由已读出的字段决定（物品类型是表中第一个字段），因此每个字段读取前重新判断
+template <typename Record>
+bool readRecord(ByteReader& reader, Record& record) {
+    bool valid = true;
+    std::apply([&](const auto&... info) {
+        auto readField = [&](const auto& field) {
+            int variant = save_schema::variantOf(record);
+            if (valid && reader.ok() && (field.variant < 0 || field.variant == variant)) {
+                valid = save_schema::readValue(reader, record.*field.member);
+            }
+        };
+        (readField(info), ...);
+    }, save_schema::fieldsOf(record));
+    return valid && reader.ok();
+}
+
+template <typename Record>
+nlohmann::json toJson(const Record& record) {
+    nlohmann::json object = nlohmann::json::object();
+    save_schema::forEachField(save_schema::fieldsOf(record), save_schema::variantOf(record),
+        [&](const auto& info) { save_schema::putJson(object, info.key, record.*info.member); });
+    return object;
+}
+
+// JSON 键名对应的字段下标，未知键返回 false
+template <typename Record>
+bool jsonFieldIndex(const Record& record, std::string_view key, size_t& index) {
+    return save_schema::keysOf(record).fromString(key, index);
+}
+
+// 以 SAX 事件的值给下标为 index 的字段赋值
+template <typename Record, typename Value>
+void assignJsonField(Record& record, size_t index, Value&& value) {
+    const auto& fields = save_schema::fieldsOf(record);
+    constexpr size_t count = std::tuple_size_v<std::decay_t<decltype(fields)>>;
+    save_schema::visitField(fields, index, [&](const auto& info) {
+        save_schema::assignJson(record.*info.member, std::forward<Value>(value));
+    }, std::make_index_sequence<count>{});
+}
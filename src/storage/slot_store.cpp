@@ -0,0 +1,690 @@
+// =============================================
+// 文件: slot_store.cpp
+// 描述: 单文件存档槽容器实现：槽表读写、日志重放与整理。
+// =============================================
+#include "slot_store.h"
+#include "byte_stream.h"
+#include "crc32c.h"
+#include <algorithm>
+#include <set>
+#include <utility>
+
+namespace {
+
+constexpr char kMagic[4] = {'M', 'U', 'D', 'B'};
+constexpr uint16_t kVersion = 2;          // 版本 2 增加共享块
+constexpr size_t kHeaderSize = 28;
+constexpr size_t kRecordHeaderSize = 13;
+constexpr uint64_t kMinCompactBytes = 1 << 20;   // 无效数据少于 1 MiB 时不整理
+
+constexpr uint8_t kRecordPut = 1;
+constexpr uint8_t kRecordDelete = 2;
+constexpr uint8_t kRecordRename = 3;
+constexpr uint8_t kRecordCopy = 4;
+constexpr uint8_t kRecordChunk = 5;
+constexpr uint8_t kRecordPutChunks = 6;
+constexpr size_t kChunkHeaderSize = 12;   // 块记录内容: [哈希 u64][数据 CRC32C u32][数据]
+
+void writeU64(ByteWriter& writer, uint64_t value) {
+    writer.writeU32(static_cast<uint32_t>(value));
+    writer.writeU32(static_cast<uint32_t>(value >> 32));
+}
+
+uint64_t readU64(ByteReader& reader) {
+    uint64_t low = reader.readU32();
+    return low | static_cast<uint64_t>(reader.readU32()) << 32;
+}
+
+// 块的内容哈希（FNV-1a 64）；命中已有块时还会比对长度与 CRC32C
+uint64_t chunkHash(const char* data, size_t size) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string encodeRecord(uint8_t kind, const std::string& payload) {
+    std::string record;
+    record.reserve(kRecordHeaderSize + payload.size());
+    ByteWriter writer(record);
+    writer.writeU8(kind);
+    writer.writeU32(static_cast<uint32_t>(payload.size()));
+    writer.writeU32(Crc32c::compute(payload.data(), payload.size()));
+    writer.writeU32(Crc32c::compute(record.data(), record.size()));
+    record += payload;
+    return record;
+}
+
+} // namespace
+
+SlotStore::SlotStore(std::string filePath, AsyncSaveWriter& writer, ErrorHandler onError)
+    : filePath_(std::move(filePath)), writer_(writer), onError_(std::move(onError)) {}
+
+void SlotStore::reportError(const std::string& message) const {
+    if (onError_ && !message.empty()) {
+        onError_(message);
+    }
+}
+
+bool SlotStore::open() {
+    writer_.waitIdle();
+    slots_.clear();
+    chunks_.clear();
+    stale_ = false;
+    image_ = nullptr;
+    fileSize_ = 0;
+
+    std::shared_ptr<const MappedFile> file = MappedFile::open(filePath_);
+    if (!file) {
+        std::string image = encodeImage(slots_, chunks_, nullptr, nullptr, nullptr);
+        std::string error;
+        if (!AsyncSaveWriter::writeFileAtomically(filePath_, image, false, &error)) {
+            reportError(error);
+            return false;
+        }
+        fileSize_ = image.size();
+        return true;
+    }
+
+    // 容器本身损坏时不覆盖，留给玩家处理
+    bool needsCompaction = false;
+    if (!load(*file, needsCompaction)) {
+        reportError("存档容器文件头或槽表损坏: " + filePath_);
+        slots_.clear();
+        chunks_.clear();
+        return false;
+    }
+    image_ = file;
+    fileSize_ = file->size();
+    if (needsCompaction) {
+        compact();
+    }
+    return true;
+}
+
+bool SlotStore::reloadIfStale() {
+    return !stale_ || open();
+}
+
+bool SlotStore::load(const MappedFile& file, bool& needsCompaction) {
+    ByteReader header(file.data(), file.size());
+    for (char expected : kMagic) {
+        if (static_cast<char>(header.readU8()) != expected) {
+            return false;
+        }
+    }
+    uint16_t version = header.readU16();
+    header.readU16();
+    uint32_t tableLength = header.readU32();
+    uint32_t tableChecksum = header.readU32();
+    uint64_t logStart = readU64(header);
+    size_t checkedLength = header.position();
+    uint32_t headerChecksum = header.readU32();
+    if (!header.ok() || version == 0 || version > kVersion ||
+        Crc32c::compute(file.data(), checkedLength) != headerChecksum) {
+        return false;
+    }
+    uint64_t dataStart = kHeaderSize + static_cast<uint64_t>(tableLength);
+    if (dataStart > file.size() || logStart < dataStart || logStart > file.size() ||
+        Crc32c::compute(file.data() + kHeaderSize, tableLength) != tableChecksum) {
+        return false;
+    }
+
+    // 槽表中的偏移相对于数据区起点
+    ByteReader table(file.data() + kHeaderSize, tableLength);
+    uint64_t chunkCount = version >= 2 ? table.readVarUint() : 0;
+    for (uint64_t i = 0; i < chunkCount && table.ok(); ++i) {
+        uint64_t hash = readU64(table);
+        Chunk chunk;
+        chunk.offset = dataStart + table.readVarUint();
+        chunk.length = table.readVarUint();
+        chunk.checksum = table.readU32();
+        if (!table.ok() || chunk.offset > logStart || chunk.length > logStart - chunk.offset) {
+            return false;
+        }
+        chunks_.insert_or_assign(hash, chunk);
+    }
+    uint64_t count = table.readVarUint();
+    for (uint64_t i = 0; i < count && table.ok(); ++i) {
+        std::string name = table.readString();
+        Slot slot;
+        slot.summary = table.readString();
+        slot.offset = dataStart + table.readVarUint();
+        slot.length = table.readVarUint();
+        slot.checksum = table.readU32();
+        uint64_t slotChunks = version >= 2 ? table.readVarUint() : 0;
+        for (uint64_t j = 0; j < slotChunks && table.ok(); ++j) {
+            uint64_t hash = readU64(table);
+            if (chunks_.count(hash) == 0) {
+                return false;
+            }
+            slot.chunks.push_back(hash);
+        }
+        if (!table.ok() || (slot.chunks.empty() && (slot.offset > logStart || slot.length > logStart - slot.offset))) {
+            return false;
+        }
+        slots_.insert_or_assign(std::move(name), std::move(slot));
+    }
+    if (!table.ok()) {
+        return false;
+    }
+
+    uint64_t position = logStart;
+    while (position < file.size()) {
+        ByteReader reader(file.data() + position, static_cast<size_t>(file.size() - position));
+        uint8_t kind = reader.readU8();
+        uint32_t length = reader.readU32();
+        uint32_t payloadChecksum = reader.readU32();
+        uint32_t recordChecksum = reader.readU32();
+        if (!reader.ok() || Crc32c::compute(file.data() + position, kRecordHeaderSize - 4) != recordChecksum ||
+            length > file.size() - position - kRecordHeaderSize) {
+            reportError("存档容器末尾的记录不完整，已忽略: " + filePath_);
+            needsCompaction = true;
+            break;
+        }
+        const char* payload = file.data() + position + kRecordHeaderSize;
+        if (Crc32c::compute(payload, length) != payloadChecksum ||
+            !applyRecord(kind, payload, length, position + kRecordHeaderSize)) {
+            reportError("存档容器中有记录校验失败，相关存档槽保持上一版本: " + filePath_);
+            needsCompaction = true;
+        }
+        position += kRecordHeaderSize + length;
+    }
+    return true;
+}
+
+bool SlotStore::applyRecord(uint8_t kind, const char* payload, size_t size, uint64_t payloadOffset) {
+    ByteReader reader(payload, size);
+    if (kind == kRecordChunk) {
+        uint64_t hash = readU64(reader);
+        Chunk chunk;
+        chunk.checksum = reader.readU32();
+        if (!reader.ok()) {
+            return false;
+        }
+        chunk.offset = payloadOffset + kChunkHeaderSize;
+        chunk.length = size - kChunkHeaderSize;
+        chunks_.insert_or_assign(hash, chunk);
+        return true;
+    }
+
+    std::string name = reader.readString();
+    switch (kind) {
+        case kRecordPut: {
+            Slot slot;
+            slot.summary = reader.readString();
+            slot.checksum = reader.readU32();
+            if (!reader.ok()) {
+                return false;
+            }
+            // 记录内容已整体校验，数据校验值无需重算
+            slot.offset = payloadOffset + reader.position();
+            slot.length = size - reader.position();
+            slots_.insert_or_assign(std::move(name), std::move(slot));
+            return true;
+        }
+        case kRecordPutChunks: {
+            Slot slot;
+            slot.summary = reader.readString();
+            slot.checksum = reader.readU32();
+            slot.length = reader.readVarUint();
+            uint64_t count = reader.readVarUint();
+            uint64_t total = 0;
+            for (uint64_t i = 0; i < count && reader.ok(); ++i) {
+                uint64_t hash = readU64(reader);
+                auto chunk = chunks_.find(hash);
+                if (chunk == chunks_.end()) {
+                    return false;
+                }
+                total += chunk->second.length;
+                slot.chunks.push_back(hash);
+            }
+            if (!reader.ok() || slot.chunks.empty() || total != slot.length) {
+                return false;
+            }
+            slots_.insert_or_assign(std::move(name), std::move(slot));
+            return true;
+        }
+        case kRecordDelete:
+            slots_.erase(name);
+            return reader.ok();
+        case kRecordRename:
+        case kRecordCopy: {
+            std::string target = reader.readString();
+            auto it = slots_.find(name);
+            if (!reader.ok() || it == slots_.end()) {
+                return false;
+            }
+            Slot slot = it->second;
+            if (kind == kRecordRename) {
+                slots_.erase(it);
+            }
+            slots_.insert_or_assign(std::move(target), std::move(slot));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+std::vector<std::string> SlotStore::list() const {
+    std::vector<std::string> names;
+    names.reserve(slots_.size());
+    for (const auto& entry : slots_) {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+const std::string* SlotStore::summary(const std::string& name) const {
+    auto it = slots_.find(name);
+    return it == slots_.end() ? nullptr : &it->second.summary;
+}
+
+std::shared_ptr<const MappedFile> SlotStore::read(const std::string& name) {
+    if (!reloadIfStale()) {
+        return nullptr;
+    }
+    auto it = slots_.find(name);
+    if (it == slots_.end()) {
+        return nullptr;
+    }
+    std::shared_ptr<const MappedFile> file = mapCurrent();
+    const Slot& slot = it->second;
+    if (file && !slot.chunks.empty()) {
+        // 分块存储的槽拼接成一份完整数据
+        std::string data;
+        data.reserve(static_cast<size_t>(slot.length));
+        for (uint64_t hash : slot.chunks) {
+            auto chunk = chunks_.find(hash);
+            if (chunk == chunks_.end() || chunk->second.offset > file->size() ||
+                chunk->second.length > file->size() - chunk->second.offset) {
+                stale_ = true;
+                return nullptr;
+            }
+            data.append(file->data() + chunk->second.offset, static_cast<size_t>(chunk->second.length));
+        }
+        if (Crc32c::compute(data.data(), data.size()) != slot.checksum) {
+            reportError("存档槽数据校验失败: " + name);
+            return nullptr;
+        }
+        return MappedFile::fromBuffer(std::move(data));
+    }
+    if (!file || slot.offset > file->size() || slot.length > file->size() - slot.offset) {
+        stale_ = true;
+        return nullptr;
+    }
+    if (Crc32c::compute(file->data() + slot.offset, slot.length) != slot.checksum) {
+        reportError("存档槽数据校验失败: " + name);
+        return nullptr;
+    }
+    return MappedFile::slice(file, static_cast<size_t>(slot.offset), static_cast<size_t>(slot.length));
+}
+
+bool SlotStore::put(const std::string& name, const std::string& summary, const std::string& data, bool async,
+                    Completion onComplete) {
+    if (!reloadIfStale()) {
+        return false;
+    }
+    Slot slot;
+    slot.summary = summary;
+    slot.length = data.size();
+    slot.checksum = Crc32c::compute(data.data(), data.size());
+
+    std::string payload;
+    payload.reserve(name.size() + summary.size() + data.size() + 16);
+    ByteWriter writer(payload);
+    writer.writeString(name);
+    writer.writeString(summary);
+    writer.writeU32(slot.checksum);
+    size_t dataStart = payload.size();
+    payload += data;
+
+    uint64_t payloadOffset = 0;
+    if (!appendRecord(kRecordPut, payload, async, std::move(onComplete), payloadOffset)) {
+        return false;
+    }
+    slot.offset = payloadOffset + dataStart;
+    slots_.insert_or_assign(name, std::move(slot));
+    compactIfNeeded();
+    return true;
+}
+
+bool SlotStore::put(const std::string& name, const std::string& summary, const std::string& data,
+                    const std::vector<size_t>& chunkEnds, bool async, Completion onComplete) {
+    if (chunkEnds.empty()) {
+        return put(name, summary, data, async, std::move(onComplete));
+    }
+    if (!reloadIfStale()) {
+        return false;
+    }
+    Slot slot;
+    slot.summary = summary;
+    slot.length = data.size();
+    slot.checksum = Crc32c::compute(data.data(), data.size());
+
+    // 新块与清单拼成一次追加，清单落盘时其引用的块必然已在文件中
+    std::string records;
+    ChunkMap added;
+    size_t start = 0;
+    for (size_t i = 0; i <= chunkEnds.size(); ++i) {
+        size_t end = i < chunkEnds.size() ? std::min(chunkEnds[i], data.size()) : data.size();
+        if (end <= start) {
+            continue;
+        }
+        const char* chunkData = data.data() + start;
+        size_t length = end - start;
+        start = end;
+
+        uint64_t hash = chunkHash(chunkData, length);
+        uint32_t checksum = Crc32c::compute(chunkData, length);
+        slot.chunks.push_back(hash);
+        auto existing = chunks_.find(hash);
+        if (existing == chunks_.end()) {
+            existing = added.find(hash);
+            if (existing == added.end()) {
+                Chunk chunk;
+                chunk.length = length;
+                chunk.checksum = checksum;
+                std::string payload;
+                payload.reserve(kChunkHeaderSize + length);
+                ByteWriter writer(payload);
+                writeU64(writer, hash);
+                writer.writeU32(checksum);
+                payload.append(chunkData, length);
+                chunk.offset = fileSize_ + records.size() + kRecordHeaderSize + kChunkHeaderSize;
+                records += encodeRecord(kRecordChunk, payload);
+                added.emplace(hash, chunk);
+                continue;
+            }
+        }
+        if (existing->second.length != length || existing->second.checksum != checksum) {
+            // 哈希冲突（极少见）：不共享，整份写入
+            return put(name, summary, data, async, std::move(onComplete));
+        }
+    }
+
+    std::string manifest;
+    ByteWriter writer(manifest);
+    writer.writeString(name);
+    writer.writeString(summary);
+    writer.writeU32(slot.checksum);
+    writer.writeVarUint(slot.length);
+    writer.writeVarUint(slot.chunks.size());
+    for (uint64_t hash : slot.chunks) {
+        writeU64(writer, hash);
+    }
+    records += encodeRecord(kRecordPutChunks, manifest);
+
+    if (!appendEncoded(std::move(records), async, std::move(onComplete))) {
+        return false;
+    }
+    chunks_.merge(added);
+    slots_.insert_or_assign(name, std::move(slot));
+    compactIfNeeded();
+    return true;
+}
+
+bool SlotStore::remove(const std::string& name) {
+    if (!reloadIfStale() || !contains(name)) {
+        return false;
+    }
+    std::string payload;
+    ByteWriter(payload).writeString(name);
+    uint64_t payloadOffset = 0;
+    if (!appendRecord(kRecordDelete, payload, false, nullptr, payloadOffset)) {
+        return false;
+    }
+    slots_.erase(name);
+    compactIfNeeded();
+    return true;
+}
+
+bool SlotStore::rename(const std::string& from, const std::string& to) {
+    if (!reloadIfStale() || !contains(from) || contains(to)) {
+        return false;
+    }
+    std::string payload;
+    ByteWriter writer(payload);
+    writer.writeString(from);
+    writer.writeString(to);
+    uint64_t payloadOffset = 0;
+    if (!appendRecord(kRecordRename, payload, false, nullptr, payloadOffset)) {
+        return false;
+    }
+    auto node = slots_.extract(from);
+    node.key() = to;
+    slots_.insert(std::move(node));
+    return true;
+}
+
+bool SlotStore::copy(const std::string& from, const std::string& to) {
+    if (!reloadIfStale() || !contains(from) || contains(to)) {
+        return false;
+    }
+    std::string payload;
+    ByteWriter writer(payload);
+    writer.writeString(from);
+    writer.writeString(to);
+    uint64_t payloadOffset = 0;
+    if (!appendRecord(kRecordCopy, payload, false, nullptr, payloadOffset)) {
+        return false;
+    }
+    Slot slot = slots_.at(from);
+    slots_.emplace(to, std::move(slot));
+    return true;
+}
+
+bool SlotStore::appendRecord(uint8_t kind, const std::string& payload, bool async, Completion onComplete,
+                             uint64_t& payloadOffset) {
+    uint64_t recordOffset = fileSize_;
+    if (!appendEncoded(encodeRecord(kind, payload), async, std::move(onComplete))) {
+        return false;
+    }
+    payloadOffset = recordOffset + kRecordHeaderSize;
+    return true;
+}
+
+bool SlotStore::appendEncoded(std::string records, bool async, Completion onComplete) {
+    uint64_t size = records.size();
+    if (async) {
+        // 追加按提交顺序落盘，记录位置在提交时即可确定
+        writer_.submitAppend(filePath_, std::move(records),
+            [this, onComplete](bool success, const std::string& error) {
+                if (!success) {
+                    stale_ = true;
+                }
+                if (onComplete) {
+                    onComplete(success, error);
+                }
+            });
+    } else {
+        writer_.waitIdle();
+        std::string error;
+        if (!AsyncSaveWriter::appendFile(filePath_, records, &error)) {
+            reportError(error);
+            stale_ = true;
+            return false;
+        }
+    }
+    fileSize_ += size;
+    return true;
+}
+
+std::shared_ptr<const MappedFile> SlotStore::mapCurrent() {
+    writer_.waitIdle();
+    if (!image_ || image_->size() != fileSize_) {
+        image_ = MappedFile::open(filePath_);
+    }
+    return image_;
+}
+
+uint64_t SlotStore::liveBytes() const {
+    // 复制出的槽与原槽共用数据，被多个槽引用的块也只计一次
+    std::set<std::pair<uint64_t, uint64_t>> ranges;
+    std::set<uint64_t> referenced;
+    uint64_t total = 0;
+    for (const auto& entry : slots_) {
+        const Slot& slot = entry.second;
+        if (slot.chunks.empty()) {
+            if (ranges.emplace(slot.offset, slot.length).second) {
+                total += slot.length;
+            }
+            continue;
+        }
+        for (uint64_t hash : slot.chunks) {
+            auto chunk = chunks_.find(hash);
+            if (chunk != chunks_.end() && referenced.insert(hash).second) {
+                total += chunk->second.length;
+            }
+        }
+    }
+    return total;
+}
+
+void SlotStore::compactIfNeeded() {
+    uint64_t live = liveBytes();
+    uint64_t garbage = fileSize_ > live ? fileSize_ - live : 0;
+    if (garbage >= kMinCompactBytes && garbage > live) {
+        compact();
+    }
+}
+
+void SlotStore::compact() {
+    std::shared_ptr<const MappedFile> file = mapCurrent();
+    if (!file) {
+        return;
+    }
+    std::map<std::string, Slot> relocatedSlots;
+    ChunkMap relocatedChunks;
+    std::vector<std::string> droppedSlots;
+    std::string image = encodeImage(slots_, chunks_, file.get(), &relocatedSlots, &relocatedChunks, &droppedSlots);
+    for (const std::string& name : droppedSlots) {
+        reportError("存档槽数据超出容器范围，整理时丢弃: " + name);
+    }
+
+    // 新的槽表立即生效；之后的追加会并入这次替换，按顺序写在新文件之后
+    slots_ = std::move(relocatedSlots);
+    chunks_ = std::move(relocatedChunks);
+    fileSize_ = image.size();
+    image_ = nullptr;
+    writer_.submit(filePath_, std::move(image), [this](bool success, const std::string& error) {
+        if (!success) {
+            // 旧文件仍然完整，重新读取即可
+            reportError(error);
+            stale_ = true;
+        }
+    });
+}
+
+std::string SlotStore::encodeImage(const std::map<std::string, Slot>& slots, const ChunkMap& chunks,
+                                   const MappedFile* source, std::map<std::string, Slot>* relocatedSlots,
+                                   ChunkMap* relocatedChunks, std::vector<std::string>* droppedSlots) {
+    auto inSource = [source](uint64_t offset, uint64_t length) {
+        return source && offset <= source->size() && length <= source->size() - offset;
+    };
+
+    // 只保留仍被引用的块，按槽的顺序排列
+    std::string data;
+    ChunkMap placedChunks;
+    std::vector<uint64_t> chunkOrder;
+    std::map<std::string, Slot> placedSlots;
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> placed;
+    for (const auto& [name, slot] : slots) {
+        Slot moved = slot;
+        if (!slot.chunks.empty()) {
+            bool intact = true;
+            for (uint64_t hash : slot.chunks) {
+                auto chunk = chunks.find(hash);
+                intact = intact && chunk != chunks.end() && inSource(chunk->second.offset, chunk->second.length);
+            }
+            if (!intact) {
+                if (droppedSlots) {
+                    droppedSlots->push_back(name);
+                }
+                continue;
+            }
+            for (uint64_t hash : slot.chunks) {
+                if (placedChunks.count(hash) == 0) {
+                    Chunk chunk = chunks.at(hash);
+                    data.append(source->data() + chunk.offset, static_cast<size_t>(chunk.length));
+                    chunk.offset = data.size() - chunk.length;
+                    placedChunks.emplace(hash, chunk);
+                    chunkOrder.push_back(hash);
+                }
+            }
+            moved.offset = 0;
+            placedSlots.emplace(name, std::move(moved));
+            continue;
+        }
+        if (!inSource(slot.offset, slot.length)) {
+            if (droppedSlots) {
+                droppedSlots->push_back(name);
+            }
+            continue;
+        }
+        auto key = std::make_pair(slot.offset, slot.length);
+        auto it = placed.find(key);
+        if (it == placed.end()) {
+            it = placed.emplace(key, data.size()).first;
+            data.append(source->data() + slot.offset, static_cast<size_t>(slot.length));
+        }
+        moved.offset = it->second;
+        placedSlots.emplace(name, std::move(moved));
+    }
+
+    std::string table;
+    ByteWriter tableWriter(table);
+    tableWriter.writeVarUint(chunkOrder.size());
+    for (uint64_t hash : chunkOrder) {
+        const Chunk& chunk = placedChunks.at(hash);
+        writeU64(tableWriter, hash);
+        tableWriter.writeVarUint(chunk.offset);
+        tableWriter.writeVarUint(chunk.length);
+        tableWriter.writeU32(chunk.checksum);
+    }
+    tableWriter.writeVarUint(placedSlots.size());
+    for (const auto& [name, slot] : placedSlots) {
+        tableWriter.writeString(name);
+        tableWriter.writeString(slot.summary);
+        tableWriter.writeVarUint(slot.offset);
+        tableWriter.writeVarUint(slot.length);
+        tableWriter.writeU32(slot.checksum);
+        tableWriter.writeVarUint(slot.chunks.size());
+        for (uint64_t hash : slot.chunks) {
+            writeU64(tableWriter, hash);
+        }
+    }
+
+    uint64_t dataStart = kHeaderSize + table.size();
+    std::string image;
+    image.reserve(static_cast<size_t>(dataStart + data.size()));
+    ByteWriter writer(image);
+    writer.writeBytes(kMagic, sizeof(kMagic));
+    writer.writeU16(kVersion);
+    writer.writeU16(0);
+    writer.writeU32(static_cast<uint32_t>(table.size()));
+    writer.writeU32(Crc32c::compute(table.data(), table.size()));
+    writeU64(writer, dataStart + data.size());
+    writer.writeU32(Crc32c::compute(image.data(), image.size()));
+    image += table;
+    image += data;
+
+    if (relocatedSlots) {
+        for (auto& entry : placedSlots) {
+            if (entry.second.chunks.empty()) {
+                entry.second.offset += dataStart;
+            }
+        }
+        *relocatedSlots = std::move(placedSlots);
+    }
+    if (relocatedChunks) {
+        for (auto& entry : placedChunks) {
+            entry.second.offset += dataStart;
+        }
+        *relocatedChunks = std::move(placedChunks);
+    }
+    return image;
+}
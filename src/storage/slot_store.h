@@ -0,0 +1,111 @@
+// =============================================
+// 文件: slot_store.h
+// 描述: 单文件存档槽容器（saves/slots.db）。所有存档槽保存在一个日志结构的文件中，
+//       列出、重命名、复制与删除都是内存中槽表的操作，只向文件追加一条小记录。
+//       存档可按调用方给出的边界切成块，块按内容哈希在所有槽间共享：
+//       槽只记录块哈希清单，保存相近的存档时只写入变化的块。
+// 布局: 文件头 [魔数 "MUDB"][版本 u16][保留 u16][槽表长度 u32][槽表 CRC32C u32]
+//              [日志起点 u64][文件头 CRC32C u32]
+//       槽表 [块数][每块: 哈希 u64][数据偏移][数据长度][数据 CRC32C u32]（版本 2 起）
+//            [槽数][每槽: 名称][摘要][数据偏移][数据长度][数据 CRC32C u32]
+//            [块数][块哈希 u64...]（版本 2 起；块数非零时数据由这些块拼接而成，偏移无意义）
+//       数据 槽表引用的存档数据与块
+//       日志 [类型 u8][长度 u32][内容 CRC32C u32][记录头 CRC32C u32][内容]，类型为
+//            PUT（名称、摘要、存档数据）、DELETE（名称）、RENAME / COPY（名称、新名称）、
+//            CHUNK（哈希、块数据）、PUT_CHUNKS（名称、摘要、总长度、块哈希清单）
+// 说明: 打开时先读槽表再按顺序重放日志。内容校验失败的记录被跳过，该槽保持上一版本；
+//       清单引用的块总是在同一次追加中先于清单写入，块缺失的清单视为损坏。
+//       记录头损坏（写到一半断电）时其后的日志无法定位，打开后立即整理。
+//       被覆盖或删除的数据（含不再被引用的块）在无效字节超过有效字节时整理回收：在调用线程拼出新文件，
+//       写盘交给后台写入器原子替换。摘要由调用方编码，容器不解析。
+//       容器不写终端：损坏、校验失败等说明经 onError 交给调用方。
+// =============================================
+#pragma once
+#include "async_save_writer.h"
+#include "mapped_file.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class SlotStore {
+public:
+    // onError 在调用容器方法的线程上调用；后台写盘的错误随完成回调派发
+    using ErrorHandler = std::function<void(const std::string&)>;
+    SlotStore(std::string filePath, AsyncSaveWriter& writer, ErrorHandler onError = nullptr);
+
+    // 读取容器并重放日志；文件不存在时创建空容器。返回是否可用
+    bool open();
+    const std::string& getFilePath() const { return filePath_; }
+
+    // 槽表查询（仅访问内存）
+    std::vector<std::string> list() const;
+    bool contains(const std::string& name) const { return slots_.count(name) > 0; }
+    // 槽的摘要；槽不存在时返回 nullptr
+    const std::string* summary(const std::string& name) const;
+
+    // 读取槽数据并校验；槽不存在或数据损坏时返回 nullptr。
+    // 会等待已提交的写入完成，返回的映射在槽被覆盖或整理后仍然有效
+    std::shared_ptr<const MappedFile> read(const std::string& name);
+
+    // 写入槽数据。async 为 true 时由后台写入器追加，完成后回调；否则同步写入。
+    // 返回 false 表示未能提交，此时不会回调
+    using Completion = AsyncSaveWriter::Completion;
+    bool put(const std::string& name, const std::string& summary, const std::string& data, bool async = false,
+             Completion onComplete = nullptr);
+    // 按 chunkEnds（各块的结束位置，递增）切块写入，容器中已有的块不再写入。
+    // chunkEnds 为空或块哈希冲突时整份写入
+    bool put(const std::string& name, const std::string& summary, const std::string& data,
+             const std::vector<size_t>& chunkEnds, bool async = false, Completion onComplete = nullptr);
+    bool remove(const std::string& name);
+    // 目标槽已存在时失败；复制只记录引用，不重复写入数据
+    bool rename(const std::string& from, const std::string& to);
+    bool copy(const std::string& from, const std::string& to);
+
+    // 无效数据超过有效数据（且达到一定大小）时整理
+    void compactIfNeeded();
+    void compact();
+
+private:
+    struct Slot {
+        std::string summary;
+        uint64_t offset = 0;   // 数据在文件中的位置
+        uint64_t length = 0;
+        uint32_t checksum = 0;
+        std::vector<uint64_t> chunks;   // 非空时数据由这些块依次拼接而成
+    };
+    struct Chunk {
+        uint64_t offset = 0;
+        uint64_t length = 0;
+        uint32_t checksum = 0;
+    };
+    using ChunkMap = std::unordered_map<uint64_t, Chunk>;
+
+    bool reloadIfStale();
+    bool load(const MappedFile& file, bool& needsCompaction);
+    bool applyRecord(uint8_t kind, const char* payload, size_t size, uint64_t payloadOffset);
+    // 追加一条日志记录；返回记录内容在文件中的起始位置
+    bool appendRecord(uint8_t kind, const std::string& payload, bool async, Completion onComplete,
+                      uint64_t& payloadOffset);
+    // 追加已编码的若干条记录（一次写入）
+    bool appendEncoded(std::string records, bool async, Completion onComplete);
+    std::shared_ptr<const MappedFile> mapCurrent();
+    uint64_t liveBytes() const;
+    // droppedSlots 收集数据已不在 source 范围内、未能写入新文件的槽
+    static std::string encodeImage(const std::map<std::string, Slot>& slots, const ChunkMap& chunks,
+                                   const MappedFile* source, std::map<std::string, Slot>* relocatedSlots,
+                                   ChunkMap* relocatedChunks, std::vector<std::string>* droppedSlots = nullptr);
+    void reportError(const std::string& message) const;
+
+    std::string filePath_;
+    AsyncSaveWriter& writer_;
+    ErrorHandler onError_;
+    std::map<std::string, Slot> slots_;   // 按名称排序，列表顺序稳定
+    ChunkMap chunks_;                     // 按内容哈希索引的共享块（可能已无槽引用，整理时回收）
+    uint64_t fileSize_ = 0;               // 含已提交但尚未落盘的追加
+    bool stale_ = false;                  // 后台追加失败：内存中的偏移不可信，需重新读取
+    std::shared_ptr<const MappedFile> image_;   // 最近一次映射的文件
+};
@@ -1,8 +1,11 @@
 // =============================================
 // 文件: storage.cpp
-// 描述: 存档系统实现。包含 JSON 序列化/反序列化与文件 IO。
+// 描述: 存档系统实现。包含 JSON 序列化/反序列化、格式识别与文件 IO。
 // =============================================
 #include "storage.h"
+#include "lz_codec.h"
+#include "save_migration.h"
+#include "save_schema.h"
 #include <fstream>
 #include <iostream>
 #include <filesystem>
@@ -20,34 +23,7 @@ SaveResult GameSave::saveGame(const Player& player, const std::string& saveFileN
 }
 
 SaveResult GameSave::saveGame(const Player& player, int currentBlockId, const std::string& saveFileName) {
-    try {
-        nlohmann::json saveData;
-        
-        // 序列化玩家数据
-        saveData["player"] = serializePlayer(player);
-        
-        // 保存地图状态
-        saveData["currentBlockId"] = currentBlockId;
-        
-        // 添加保存时间戳
-        saveData["saveTime"] = getCurrentTimeString();
-        saveData["version"] = "1.0";
-        
-        // 写入文件
-        std::string filePath = getSaveFilePath(saveFileName);
-        std::ofstream file(filePath);
-        if (!file.is_open()) {
-            return SaveResult::FILE_ERROR;
-        }
-        
-        file << saveData.dump(4); // 格式化输出，缩进4个空格
-        file.close();
-        
-        return SaveResult::SUCCESS;
-    } catch (const std::exception& e) {
-        std::cerr << "保存游戏时发生错误: " << e.what() << std::endl;
-        return SaveResult::SERIALIZATION_ERROR;
-    }
+    return writeSave(player, currentBlockId, getCurrentTimeString(), saveFileName);
 }
 
 SaveResult GameSave::loadGame(Player& player, const std::string& saveFileName) {
@@ -56,106 +32,302 @@ SaveResult GameSave::loadGame(Player& player, const std::string& saveFileName) {
 }
 
 SaveResult GameSave::loadGame(Player& player, int& currentBlockId, const std::string& saveFileName) {
+    std::string saveTime;
+    return readSave(player, currentBlockId, saveTime, saveFileName);
+}
+
+SaveResult GameSave::writeSave(const Player& player, int currentBlockId, const std::string& saveTime,
+                               const std::string& saveFileName) {
     try {
-        std::string filePath = getSaveFilePath(saveFileName);
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
-            return SaveResult::FILE_NOT_FOUND;
-        }
+        std::string data;
+        std::vector<size_t> chunkEnds;
+        encodeSave(player, currentBlockId, saveTime, saveFileName, data, slotStore_ ? &chunkEnds : nullptr);
         
-        nlohmann::json saveData;
-        file >> saveData;
-        file.close();
-        
-        // 验证数据完整性
-        if (!saveData.contains("player")) {
-            return SaveResult::INVALID_DATA;
+        // 等待后台写入完成，避免旧的后台请求覆盖本次同步写入
+        asyncWriter_.waitIdle();
+        // 整份覆盖日志存档槽后，原有日志不再适用
+        if (saveFileName == journal_.slot) {
+            journal_.baseValid = false;
+        }
+        if (slotStore_) {
+            SaveInfo info = makeSaveInfo(player, saveTime);
+            return slotStore_->put(saveFileName, encodeSummary(info), data, chunkEnds) ? SaveResult::SUCCESS
+                                                                                      : SaveResult::FILE_ERROR;
+        }
+        std::string error;
+        bool written = AsyncSaveWriter::writeFileAtomically(getSaveFilePath(saveFileName), data, true, &error);
+        reportError(error);
+        if (!written) {
+            return SaveResult::FILE_ERROR;
         }
         
-        // 反序列化玩家数据
-        deserializePlayer(player, saveData["player"]);
-        
-        // 加载地图状态
-        currentBlockId = saveData.value("currentBlockId", 0);
+        // 刚写入的摘要直接进入缓存，列表时无需再读取
+        updateSaveIndex(saveFileName, makeSaveInfo(player, saveTime));
         
         return SaveResult::SUCCESS;
     } catch (const std::exception& e) {
-        std::cerr << "加载游戏时发生错误: " << e.what() << std::endl;
+        std::cerr << "保存游戏时发生错误: " << e.what() << std::endl;
         return SaveResult::SERIALIZATION_ERROR;
     }
 }
 
-bool GameSave::saveExists(const std::string& saveFileName) const {
-    std::string filePath = getSaveFilePath(saveFileName);
-    return std::filesystem::exists(filePath);
+void GameSave::saveGameAsync(const Player& player, int currentBlockId, const std::string& saveFileName,
+                             SaveCallback onComplete) {
+    std::string saveTime = getCurrentTimeString();
+    std::string data;
+    std::vector<size_t> chunkEnds;
+    try {
+        encodeSave(player, currentBlockId, saveTime, saveFileName, data, slotStore_ ? &chunkEnds : nullptr);
+    } catch (const std::exception& e) {
+        std::cerr << "保存游戏时发生错误: " << e.what() << std::endl;
+        if (onComplete) {
+            onComplete(SaveResult::SERIALIZATION_ERROR);
+        }
+        return;
+    }
+    
+    if (saveFileName == journal_.slot) {
+        journal_.baseValid = false;
+    }
+    
+    // 回调在 UI 线程派发，摘要缓存只在该线程更新，无需加锁
+    SaveInfo info = makeSaveInfo(player, saveTime);
+    if (slotStore_) {
+        // 摘要随槽数据一起写入容器，无需另外缓存
+        bool submitted = slotStore_->put(saveFileName, encodeSummary(info), data, chunkEnds, true,
+            [this, onComplete](bool success, const std::string& error) {
+                reportError(error);
+                if (onComplete) {
+                    onComplete(success ? SaveResult::SUCCESS : SaveResult::FILE_ERROR);
+                }
+            });
+        if (!submitted && onComplete) {
+            onComplete(SaveResult::FILE_ERROR);
+        }
+        return;
+    }
+    asyncWriter_.submit(getSaveFilePath(saveFileName), std::move(data),
+        [this, saveFileName, info, onComplete](bool success, const std::string& error) {
+            reportError(error);
+            if (success) {
+                updateSaveIndex(saveFileName, info);
+            }
+            if (onComplete) {
+                onComplete(success ? SaveResult::SUCCESS : SaveResult::FILE_ERROR);
+            }
+        }, true);
+}
+
+void GameSave::reportError(const std::string& message) const {
+    if (errorHandler_ && !message.empty()) {
+        errorHandler_(message);
+    }
+}
+
+size_t GameSave::dispatchSaveCompletions() {
+    return asyncWriter_.dispatchCompletions();
+}
+
+void GameSave::setSaveNotifier(std::function<void()> notifier) {
+    asyncWriter_.setNotifier(std::move(notifier));
+}
+
+void GameSave::encodeSave(const Player& player, int currentBlockId, const std::string& saveTime,
+                          const std::string& saveFileName, std::string& data,
+                          std::vector<size_t>* chunkEnds) const {
+    if (chunkEnds) {
+        chunkEnds->clear();
+    }
+    if (formatForFile(saveFileName) == SaveFormat::BINARY) {
+        // 压缩后的数据无法按对象切块，整份存储
+        encodeBinary(player, currentBlockId, saveTime, data, compressionEnabled_ ? nullptr : chunkEnds);
+        if (compressionEnabled_) {
+            data = LzCodec::compress(data);
+        }
+        return;
+    }
+    
+    nlohmann::json saveData;
+    
+    // 序列化玩家数据
+    saveData["player"] = serializePlayer(player);
+    
+    // 保存地图状态
+    saveData["currentBlockId"] = currentBlockId;
+    
+    // 添加保存时间戳
+    saveData["saveTime"] = saveTime;
+    // 结构版本：键名排在 "meta" 与 "player" 之前，加载器读到记录前即可确定迁移计划
+    saveData["formatVersion"] = kSaveSchemaVersion;
+    
+    // 存档摘要：键名排在 "player" 之前，列表时读到此处即可停止解析
+    saveData["meta"] = {
+        {"playerName", player.name},
+        {"level", player.level},
+        {"x", player.x},
+        {"y", player.y},
+        {"teamSize", static_cast<int>(player.teamMembers.size())},
+        {"inventorySize", static_cast<int>(player.inventory.getCurrentSize())},
+        {"saveTime", saveTime}
+    };
+    
+    if (compressionEnabled_) {
+        // 序列化文本直接流入压缩器，不生成完整的未压缩文本
+        LzEncoder encoder(data);
+        LzOutputBuffer buffer(encoder);
+        std::ostream stream(&buffer);
+        stream << std::setw(4) << saveData;
+        encoder.finish();
+        return;
+    }
+    data = saveData.dump(4); // 格式化输出，缩进4个空格
 }
 
-GameSave::SaveInfo GameSave::getSaveInfo(const std::string& saveFileName) const {
+GameSave::SaveInfo GameSave::makeSaveInfo(const Player& player, const std::string& saveTime) const {
     SaveInfo info;
+    info.playerName = player.name;
+    info.level = player.level;
+    info.x = player.x;
+    info.y = player.y;
+    info.saveTime = saveTime;
+    info.teamSize = static_cast<int>(player.teamMembers.size());
+    info.inventorySize = static_cast<int>(player.inventory.getCurrentSize());
+    return info;
+}
+
+SaveResult GameSave::readSave(Player& player, int& currentBlockId, std::string& saveTime,
+                              const std::string& saveFileName) {
+    // 先等后台写入落盘，保证读到的是最近一次保存
+    asyncWriter_.waitIdle();
     
+    loadWarnings_.clear();
+    // 加载与日志重放都会改动背包，期间不记录日志
+    bool wasPaused = journal_.paused;
+    journal_.paused = true;
+    SaveResult result = decodeSave(player, currentBlockId, saveTime, saveFileName);
+    journal_.paused = wasPaused;
+    return result;
+}
+
+SaveResult GameSave::decodeSave(Player& player, int& currentBlockId, std::string& saveTime,
+                                const std::string& saveFileName) {
     try {
-        std::string filePath = getSaveFilePath(saveFileName);
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
-            return info;
+        if (slotStore_) {
+            // 容器中的槽没有日志与备份；读到的数据已通过校验
+            lastJournalLoad_ = JournalLoad{};
+            std::shared_ptr<const MappedFile> slot = slotStore_->read(saveFileName);
+            if (!slot) {
+                return slotStore_->contains(saveFileName) ? SaveResult::CORRUPTED : SaveResult::FILE_NOT_FOUND;
+            }
+            return decodeSnapshot(slot, player, currentBlockId, saveTime, saveFileName);
         }
         
-        nlohmann::json saveData;
-        file >> saveData;
-        file.close();
+        // 映射整个存档，映射只在本次加载期间使用；背包物品复制出来，留到首次访问时再解码
+        std::string filePath = getSaveFilePath(saveFileName);
+        std::shared_ptr<const MappedFile> snapshot = MappedFile::open(filePath);
+        if (!snapshot) {
+            return SaveResult::FILE_NOT_FOUND;
+        }
+        SaveResult result = decodeSnapshot(snapshot, player, currentBlockId, saveTime, saveFileName);
         
-        if (saveData.contains("player")) {
-            const auto& playerData = saveData["player"];
-            info.playerName = playerData.value("name", "");
-            
-            // 安全地获取数值，添加类型检查
-            if (playerData.contains("level") && playerData["level"].is_number()) {
-                info.level = playerData["level"].get<int>();
-            } else {
-                info.level = 1;
-            }
-            
-            if (playerData.contains("x") && playerData["x"].is_number()) {
-                info.x = playerData["x"].get<int>();
-            } else {
-                info.x = 0;
-            }
-            
-            if (playerData.contains("y") && playerData["y"].is_number()) {
-                info.y = playerData["y"].get<int>();
-            } else {
-                info.y = 0;
-            }
-            
-            if (playerData.contains("teamSize") && playerData["teamSize"].is_number()) {
-                info.teamSize = playerData["teamSize"].get<int>();
-            } else {
-                info.teamSize = 0;
-            }
-            
-            if (playerData.contains("inventorySize") && playerData["inventorySize"].is_number()) {
-                info.inventorySize = playerData["inventorySize"].get<int>();
-            } else {
-                info.inventorySize = 0;
+        // 存档损坏时改用上一版备份（解码失败不会改动玩家），并用备份覆盖损坏的存档
+        if (result == SaveResult::CORRUPTED || result == SaveResult::SERIALIZATION_ERROR ||
+            result == SaveResult::INVALID_DATA) {
+            std::shared_ptr<const MappedFile> backup = MappedFile::open(AsyncSaveWriter::backupPathFor(filePath));
+            if (backup && decodeSnapshot(backup, player, currentBlockId, saveTime, saveFileName) == SaveResult::SUCCESS) {
+                loadWarnings_.push_back("存档已损坏，已从备份恢复: " + saveFileName);
+                AsyncSaveWriter::writeFileAtomically(filePath, std::string(backup->data(), backup->size()));
+                restoreJournalBackup(*backup, saveFileName);
+                eraseSaveIndex(saveFileName);
+                snapshot = backup;
+                result = SaveResult::SUCCESS;
             }
         }
+        if (result != SaveResult::SUCCESS) {
+            return result;
+        }
         
-        info.saveTime = saveData.value("saveTime", "");
+        // 快照之后的改动记录在日志中；日志若是接在损坏的快照之后，会因基线不符被丢弃
+        return replayJournal(*snapshot, player, currentBlockId, saveTime, saveFileName);
     } catch (const std::exception& e) {
-        std::cerr << "获取存档信息时发生错误: " << e.what() << std::endl;
+        std::cerr << "加载游戏时发生错误: " << e.what() << std::endl;
+        return SaveResult::SERIALIZATION_ERROR;
     }
-    
-    return info;
+}
+
+SaveResult GameSave::decodeSnapshot(const std::shared_ptr<const MappedFile>& snapshot, Player& player,
+                                    int& currentBlockId, std::string& saveTime, const std::string& saveFileName) {
+    // 按文件头识别格式，与扩展名无关；日志校验的是磁盘上的原始字节，解压结果另存
+    std::shared_ptr<const MappedFile> image = snapshot;
+    if (LzCodec::isCompressed(snapshot->data(), snapshot->size())) {
+        std::string decompressed;
+        if (!LzCodec::decompress(snapshot->data(), snapshot->size(), decompressed)) {
+            std::cerr << "存档解压失败，文件可能已损坏: " << saveFileName << std::endl;
+            return SaveResult::CORRUPTED;
+        }
+        image = MappedFile::fromBuffer(std::move(decompressed));
+    }
+    return isBinarySave(image->data(), image->size())
+        ? decodeBinary(image, player, currentBlockId, saveTime)
+        : decodeJson(image->data(), image->size(), player, currentBlockId, saveTime);
+}
+
+bool GameSave::readFile(const std::string& filePath, std::string& data) const {
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::streamsize size = file.tellg();
+    if (size < 0) {
+        return false;
+    }
+    data.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(&data[0], size));
+}
+
+SaveResult GameSave::convertSave(const std::string& sourceFileName, const std::string& targetFileName) {
+    // 经由内存中的玩家对象中转，两种格式共用同一套序列化规则
+    Player player("", 0, 0);
+    int currentBlockId = 0;
+    std::string saveTime;
+    SaveResult result = readSave(player, currentBlockId, saveTime, sourceFileName);
+    if (result != SaveResult::SUCCESS) {
+        return result;
+    }
+    return writeSave(player, currentBlockId, saveTime, targetFileName);
+}
+
+SaveFormat GameSave::formatForFile(const std::string& saveFileName) {
+    return std::filesystem::path(saveFileName).extension() == ".sav" ? SaveFormat::BINARY : SaveFormat::JSON;
+}
+
+std::string GameSave::withFormat(const std::string& saveFileName, SaveFormat format) {
+    std::filesystem::path path(saveFileName);
+    path.replace_extension(format == SaveFormat::BINARY ? ".sav" : ".json");
+    return path.string();
+}
+
+bool GameSave::saveExists(const std::string& saveFileName) const {
+    if (slotStore_) {
+        return slotStore_->contains(saveFileName);
+    }
+    std::string filePath = getSaveFilePath(saveFileName);
+    return std::filesystem::exists(filePath);
 }
 
 std::vector<std::string> GameSave::listSaveFiles() const {
+    if (slotStore_) {
+        return slotStore_->list();
+    }
     std::vector<std::string> saveFiles;
     
     try {
         std::string savesDir = "saves";
         if (std::filesystem::exists(savesDir)) {
             for (const auto& entry : std::filesystem::directory_iterator(savesDir)) {
-                if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                auto extension = entry.path().extension();
+                if (entry.is_regular_file() && (extension == ".json" || extension == ".sav")) {
                     saveFiles.push_back(entry.path().filename().string());
                 }
             }
@@ -169,24 +341,191 @@ std::vector<std::string> GameSave::listSaveFiles() const {
 
 bool GameSave::deleteSave(const std::string& saveFileName) const {
     try {
+        if (saveFileName == journal_.slot) {
+            journal_.baseValid = false;
+        }
+        if (slotStore_) {
+            return slotStore_->remove(saveFileName);
+        }
+        // 排队中的后台写入会重新创建文件，先等其完成
+        asyncWriter_.waitIdle();
         std::string filePath = getSaveFilePath(saveFileName);
-        return std::filesystem::remove(filePath);
+        eraseSaveIndex(saveFileName);
+        std::error_code error;
+        std::filesystem::remove(getJournalFilePath(saveFileName), error);
+        std::filesystem::remove(AsyncSaveWriter::backupPathFor(getJournalFilePath(saveFileName)), error);
+        std::filesystem::remove(AsyncSaveWriter::backupPathFor(filePath), error);
+        bool removed = std::filesystem::remove(filePath);
+        refreshSaveCatalog(saveFileName);
+        return removed;
     } catch (const std::exception& e) {
         std::cerr << "删除存档时发生错误: " << e.what() << std::endl;
         return false;
     }
 }
 
-// 序列化方法实现
-nlohmann::json GameSave::serializePlayer(const Player& player) const {
-    nlohmann::json playerJson;
+bool GameSave::renameSave(const std::string& fromFileName, const std::string& toFileName) {
+    if (fromFileName == journal_.slot || toFileName == journal_.slot) {
+        journal_.baseValid = false;
+    }
+    if (slotStore_) {
+        return slotStore_->rename(fromFileName, toFileName);
+    }
+    try {
+        asyncWriter_.waitIdle();
+        if (!saveExists(fromFileName) || saveExists(toFileName)) {
+            return false;
+        }
+        // 快照、日志与备份一起改名，日志头中的快照哈希仍然匹配
+        std::string fromPath = getSaveFilePath(fromFileName);
+        std::string toPath = getSaveFilePath(toFileName);
+        std::filesystem::rename(fromPath, toPath);
+        std::error_code error;
+        if (std::filesystem::exists(getJournalFilePath(fromFileName), error)) {
+            std::filesystem::rename(getJournalFilePath(fromFileName), getJournalFilePath(toFileName), error);
+        }
+        if (std::filesystem::exists(AsyncSaveWriter::backupPathFor(fromPath), error)) {
+            std::filesystem::rename(AsyncSaveWriter::backupPathFor(fromPath), AsyncSaveWriter::backupPathFor(toPath),
+                                    error);
+        }
+        std::string fromJournalBackup = AsyncSaveWriter::backupPathFor(getJournalFilePath(fromFileName));
+        if (std::filesystem::exists(fromJournalBackup, error)) {
+            std::filesystem::rename(fromJournalBackup, AsyncSaveWriter::backupPathFor(getJournalFilePath(toFileName)),
+                                    error);
+        }
+        eraseSaveIndex(fromFileName);
+        refreshSaveCatalog(fromFileName);
+        refreshSaveCatalog(toFileName);
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "重命名存档时发生错误: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool GameSave::copySave(const std::string& fromFileName, const std::string& toFileName) {
+    if (toFileName == journal_.slot) {
+        journal_.baseValid = false;
+    }
+    if (slotStore_) {
+        return slotStore_->copy(fromFileName, toFileName);
+    }
+    try {
+        asyncWriter_.waitIdle();
+        if (!saveExists(fromFileName) || saveExists(toFileName)) {
+            return false;
+        }
+        std::filesystem::copy_file(getSaveFilePath(fromFileName), getSaveFilePath(toFileName));
+        std::error_code error;
+        if (std::filesystem::exists(getJournalFilePath(fromFileName), error)) {
+            std::filesystem::copy_file(getJournalFilePath(fromFileName), getJournalFilePath(toFileName), error);
+        }
+        refreshSaveCatalog(toFileName);
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "复制存档时发生错误: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool GameSave::setSlotStoreEnabled(bool enabled) {
+    if (enabled == isSlotStoreEnabled()) {
+        return true;
+    }
+    // 切换前后的存档槽不是同一份数据，日志基线一律作废
+    asyncWriter_.waitIdle();
+    journal_.baseValid = false;
+    lastJournalLoad_ = JournalLoad{};
     
-    // 基本信息
-    playerJson["name"] = player.name;
-    playerJson["x"] = player.x;
-    playerJson["y"] = player.y;
-    playerJson["level"] = player.level;
-    playerJson["experience"] = player.experience;
+    if (!enabled) {
+        if (!exportSaveDirectory(*slotStore_)) {
+            return false;
+        }
+        slotStore_.reset();
+        return true;
+    }
+    
+    auto store = std::make_unique<SlotStore>(getSaveFilePath("slots.db"), asyncWriter_,
+                                             [this](const std::string& message) { reportError(message); });
+    if (!store->open()) {
+        reportError("无法打开存档容器: " + store->getFilePath());
+        return false;
+    }
+    // 导入失败的存档留在目录中，下次启用时再试
+    importSaveDirectory(*store);
+    slotStore_ = std::move(store);
+    return true;
+}
+
+bool GameSave::importSaveDirectory(SlotStore& store) {
+    bool allImported = true;
+    for (const std::string& fileName : listSaveFiles()) {
+        if (store.contains(fileName)) {
+            reportError("存档容器中已有同名存档，跳过导入: " + fileName);
+            allImported = false;
+            continue;
+        }
+        std::string filePath = getSaveFilePath(fileName);
+        std::string data;
+        std::vector<size_t> chunkEnds;
+        SaveInfo info;
+        std::error_code error;
+        bool hasJournal = std::filesystem::exists(getJournalFilePath(fileName), error);
+        if (hasJournal || (formatForFile(fileName) == SaveFormat::BINARY && !compressionEnabled_)) {
+            // 带日志的存档槽先合并成一份完整快照（容器不保存日志）；
+            // 二进制存档重新编码以取得分块边界，与其他槽共享相同的块
+            Player player("", 0, 0);
+            int currentBlockId = 0;
+            std::string saveTime;
+            if (readSave(player, currentBlockId, saveTime, fileName) != SaveResult::SUCCESS) {
+                allImported = false;
+                continue;
+            }
+            encodeSave(player, currentBlockId, saveTime, fileName, data, &chunkEnds);
+            info = makeSaveInfo(player, saveTime);
+        } else if (!readFile(filePath, data)) {
+            allImported = false;
+            continue;
+        } else {
+            readSaveInfo(filePath, info);
+        }
+        
+        if (!store.put(fileName, encodeSummary(info), data, chunkEnds)) {
+            return false;
+        }
+        eraseSaveIndex(fileName);
+        std::filesystem::remove(filePath, error);
+        std::filesystem::remove(getJournalFilePath(fileName), error);
+        std::filesystem::remove(AsyncSaveWriter::backupPathFor(getJournalFilePath(fileName)), error);
+        std::filesystem::remove(AsyncSaveWriter::backupPathFor(filePath), error);
+    }
+    return allImported;
+}
+
+bool GameSave::exportSaveDirectory(SlotStore& store) {
+    for (const std::string& fileName : store.list()) {
+        std::string filePath = getSaveFilePath(fileName);
+        std::shared_ptr<const MappedFile> slot = store.read(fileName);
+        if (!slot) {
+            reportError("存档槽已损坏，无法导出: " + fileName);
+            return false;
+        }
+        std::string error;
+        if (!AsyncSaveWriter::writeFileAtomically(filePath, std::string(slot->data(), slot->size()), false, &error)) {
+            reportError(error);
+            return false;
+        }
+    }
+    // 全部写出后才删除容器，中途失败时容器仍完整
+    asyncWriter_.waitIdle();
+    std::error_code error;
+    std::filesystem::remove(store.getFilePath(), error);
+    return true;
+}
+
+// 序列化方法实现：标量字段按 save_schema.h 的字段表写出，嵌套的队伍、装备与背包在此组装
+nlohmann::json GameSave::serializePlayer(const Player& player) const {
+    nlohmann::json playerJson = toJson(recordOf(player));
     
     // 队伍成员
     nlohmann::json teamArray = nlohmann::json::array();
@@ -196,16 +535,6 @@ nlohmann::json GameSave::serializePlayer(const Player& player) const {
     playerJson["teamMembers"] = teamArray;
     playerJson["teamSize"] = static_cast<int>(player.teamMembers.size());
     
-    // 当前活跃成员索引
-    int activeIndex = -1;
-    for (size_t i = 0; i < player.teamMembers.size(); ++i) {
-        if (player.teamMembers[i] == player.activeMember) {
-            activeIndex = static_cast<int>(i);
-            break;
-        }
-    }
-    playerJson["activeMemberIndex"] = activeIndex;
-    
     // 背包
     playerJson["inventory"] = serializeInventory(player.inventory);
     playerJson["inventorySize"] = static_cast<int>(player.inventory.getCurrentSize());
@@ -214,16 +543,7 @@ nlohmann::json GameSave::serializePlayer(const Player& player) const {
 }
 
 nlohmann::json GameSave::serializeTeamMember(const TeamMember& member) const {
-    nlohmann::json memberJson;
-    
-    memberJson["name"] = member.getName();
-    memberJson["level"] = member.getLevel();
-    memberJson["currentHealth"] = member.getCurrentHealth();
-    memberJson["baseHealth"] = member.getBaseHealth();
-    memberJson["baseAttack"] = member.getBaseAttack();
-    memberJson["baseDefense"] = member.getBaseDefense();
-    // 保存队伍状态
-    memberJson["status"] = memberStatusToString(member.getStatus());
+    nlohmann::json memberJson = toJson(recordOf(member));
     
     // 装备的武器
     if (member.getEquippedWeapon()) {
@@ -239,54 +559,7 @@ nlohmann::json GameSave::serializeTeamMember(const TeamMember& member) const {
 }
 
 nlohmann::json GameSave::serializeItem(const Item& item) const {
-    nlohmann::json itemJson;
-    
-    itemJson["name"] = item.getName();
-    itemJson["type"] = itemTypeToString(item.getType());
-    itemJson["rarity"] = rarityToString(item.getRarity());
-    itemJson["description"] = item.getDescription();
-    itemJson["quantity"] = item.getQuantity();
-    
-    // 根据物品类型添加特定属性
-    switch (item.getType()) {
-        case ItemType::WEAPON: {
-            const Weapon* weapon = dynamic_cast<const Weapon*>(&item);
-            if (weapon) {
-                itemJson["weaponType"] = weaponTypeToString(weapon->getWeaponType());
-                itemJson["attackPower"] = weapon->getAttackPower();
-                itemJson["durability"] = weapon->getDurability();
-            }
-            break;
-        }
-        case ItemType::ARTIFACT: {
-            const Artifact* artifact = dynamic_cast<const Artifact*>(&item);
-            if (artifact) {
-                itemJson["artifactType"] = artifactTypeToString(artifact->getArtifactType());
-                itemJson["mainStat"] = artifact->getMainStat();
-                itemJson["subStats"] = artifact->getSubStats();
-            }
-            break;
-        }
-        case ItemType::FOOD: {
-            const Food* food = dynamic_cast<const Food*>(&item);
-            if (food) {
-                itemJson["foodType"] = foodTypeToString(food->getFoodType());
-                itemJson["effectValue"] = food->getEffectValue();
-                itemJson["duration"] = food->getDuration();
-            }
-            break;
-        }
-        case ItemType::MATERIAL: {
-            const Material* material = dynamic_cast<const Material*>(&item);
-            if (material) {
-                itemJson["materialType"] = materialTypeToString(material->getMaterialType());
-                itemJson["isStackable"] = material->isStackable();
-            }
-            break;
-        }
-    }
-    
-    return itemJson;
+    return toJson(recordOf(item));
 }
 
 nlohmann::json GameSave::serializeInventory(const Inventory& inventory) const {
@@ -304,172 +577,31 @@ nlohmann::json GameSave::serializeInventory(const Inventory& inventory) const {
     return inventoryJson;
 }
 
-// 反序列化方法实现
-void GameSave::deserializePlayer(Player& player, const nlohmann::json& json) const {
-    // 基本信息
-    player.name = json.value("name", "");
-    player.x = json.value("x", 0);
-    player.y = json.value("y", 0);
-    player.level = json.value("level", 1);
-    player.experience = json.value("experience", 0);
-    
-    // 清空现有队伍成员
-    player.teamMembers.clear();
-    player.activeMember = nullptr;
-    
-    // 加载队伍成员
-    if (json.contains("teamMembers") && json["teamMembers"].is_array()) {
-        for (const auto& memberJson : json["teamMembers"]) {
-            auto member = deserializeTeamMember(memberJson);
-            if (member) {
-                player.teamMembers.push_back(member);
-            }
-        }
-    }
-    
-    // 设置活跃成员
-    int activeIndex = json.value("activeMemberIndex", -1);
+void GameSave::restoreActiveMember(Player& player, int activeIndex) const {
     if (activeIndex >= 0 && activeIndex < static_cast<int>(player.teamMembers.size())) {
         player.activeMember = player.teamMembers[activeIndex];
-        // 确保该成员标记为上场
-        if (player.activeMember && !player.activeMember->isActive()) {
-            player.activeMember->setStatus(MemberStatus::ACTIVE);
-        }
     } else if (!player.teamMembers.empty()) {
         player.activeMember = player.teamMembers[0];
-        if (player.activeMember && !player.activeMember->isActive()) {
-            player.activeMember->setStatus(MemberStatus::ACTIVE);
-        }
-    }
-    
-    // 加载背包
-    if (json.contains("inventory")) {
-        deserializeInventory(player.inventory, json["inventory"]);
-    }
-}
-
-std::shared_ptr<TeamMember> GameSave::deserializeTeamMember(const nlohmann::json& json) const {
-    try {
-        std::string name = json.value("name", "");
-        int level = json.value("level", 1);
-        
-        auto member = std::make_shared<TeamMember>(name, level);
-        
-        // 设置当前生命值
-        member->setCurrentHealth(json.value("currentHealth", member->getTotalHealth()));
-        
-        // 加载装备的武器
-        if (json.contains("equippedWeapon")) {
-            auto weapon = deserializeItem(json["equippedWeapon"]);
-            if (weapon && weapon->getType() == ItemType::WEAPON) {
-                auto weaponPtr = std::dynamic_pointer_cast<Weapon>(weapon);
-                if (weaponPtr) {
-                    member->equipWeapon(weaponPtr);
-                }
-            }
-        }
-        
-        // 加载装备的圣遗物
-        if (json.contains("equippedArtifact")) {
-            auto artifact = deserializeItem(json["equippedArtifact"]);
-            if (artifact && artifact->getType() == ItemType::ARTIFACT) {
-                auto artifactPtr = std::dynamic_pointer_cast<Artifact>(artifact);
-                if (artifactPtr) {
-                    member->equipArtifact(artifactPtr);
-                }
-            }
-        }
-        
-        // 加载队伍状态（默认为待命）
-        if (json.contains("status")) {
-            std::string statusStr = json.value("status", "STANDBY");
-            member->setStatus(stringToMemberStatus(statusStr));
-        }
-        
-        return member;
-    } catch (const std::exception& e) {
-        std::cerr << "反序列化队伍成员时发生错误: " << e.what() << std::endl;
-        return nullptr;
     }
-}
-
-std::shared_ptr<Item> GameSave::deserializeItem(const nlohmann::json& json) const {
-    try {
-        std::string name = json.value("name", "");
-        ItemType type = stringToItemType(json.value("type", ""));
-        Rarity rarity = stringToRarity(json.value("rarity", "ONE_STAR"));
-        std::string description = json.value("description", "");
-        int quantity = json.value("quantity", 1);
-        
-        std::shared_ptr<Item> item;
-        
-        switch (type) {
-            case ItemType::WEAPON: {
-                WeaponType weaponType = stringToWeaponType(json.value("weaponType", ""));
-                int attackPower = json.value("attackPower", 0);
-                int durability = json.value("durability", 100);
-                
-                item = std::make_shared<Weapon>(name, weaponType, rarity, description, attackPower, durability);
-                break;
-            }
-            case ItemType::ARTIFACT: {
-                ArtifactType artifactType = stringToArtifactType(json.value("artifactType", ""));
-                std::string mainStat = json.value("mainStat", "");
-                std::vector<std::string> subStats = json.value("subStats", std::vector<std::string>());
-                
-                item = std::make_shared<Artifact>(name, artifactType, rarity, description, mainStat, subStats);
-                break;
-            }
-            case ItemType::FOOD: {
-                FoodType foodType = stringToFoodType(json.value("foodType", ""));
-                int effectValue = json.value("effectValue", 0);
-                int duration = json.value("duration", 0);
-                
-                item = std::make_shared<Food>(name, foodType, rarity, description, effectValue, duration);
-                break;
-            }
-            case ItemType::MATERIAL: {
-                MaterialType materialType = stringToMaterialType(json.value("materialType", ""));
-                bool isStackable = json.value("isStackable", true);
-                
-                item = std::make_shared<Material>(name, materialType, rarity, description, isStackable);
-                break;
-            }
-            default:
-                return nullptr;
-        }
-        
-        if (item) {
-            item->setQuantity(quantity);
-        }
-        
-        return item;
-    } catch (const std::exception& e) {
-        std::cerr << "反序列化物品时发生错误: " << e.what() << std::endl;
-        return nullptr;
+    // 确保该成员标记为上场
+    if (player.activeMember && !player.activeMember->isActive()) {
+        player.activeMember->setStatus(MemberStatus::ACTIVE);
     }
 }
 
-void GameSave::deserializeInventory(Inventory& inventory, const nlohmann::json& json) const {
-    try {
-        // 设置背包容量
-        size_t maxCapacity = json.value("maxCapacity", 100);
-        inventory.setMaxCapacity(maxCapacity);
-        
-        // 清空现有物品
-        inventory.removeAllItems();
-        
-        // 加载物品
-        if (json.contains("items") && json["items"].is_array()) {
-            for (const auto& itemJson : json["items"]) {
-                auto item = deserializeItem(itemJson);
-                if (item) {
-                    inventory.addItem(item);
-                }
-            }
+void GameSave::restoreInventoryItems(Inventory& inventory, size_t maxCapacity,
+                                     const std::vector<std::shared_ptr<Item>>& items) const {
+    // 设置背包容量并清空现有物品
+    inventory.setMaxCapacity(maxCapacity);
+    inventory.removeAllItems();
+    
+    // 整批放入，只触发一次变化通知
+    if (inventory.addItems(items) == InventoryResult::FULL) {
+        // 存档物品超出容量时退回逐个放入，尽量保留能放下的物品
+        std::cerr << "存档中的物品超出背包容量，部分物品未能加载" << std::endl;
+        for (const auto& item : items) {
+            inventory.addItem(item);
         }
-    } catch (const std::exception& e) {
-        std::cerr << "反序列化背包时发生错误: " << e.what() << std::endl;
     }
 }
 
@@ -486,132 +618,3 @@ std::string GameSave::getCurrentTimeString() const {
 std::string GameSave::getSaveFilePath(const std::string& fileName) const {
     return "saves/" + fileName;
 }
-
-// 类型转换方法实现
-std::string GameSave::itemTypeToString(ItemType type) const {
-    switch (type) {
-        case ItemType::WEAPON: return "WEAPON";
-        case ItemType::ARTIFACT: return "ARTIFACT";
-        case ItemType::FOOD: return "FOOD";
-        case ItemType::MATERIAL: return "MATERIAL";
-        default: return "UNKNOWN";
-    }
-}
-
-ItemType GameSave::stringToItemType(const std::string& str) const {
-    if (str == "WEAPON") return ItemType::WEAPON;
-    if (str == "ARTIFACT") return ItemType::ARTIFACT;
-    if (str == "FOOD") return ItemType::FOOD;
-    if (str == "MATERIAL") return ItemType::MATERIAL;
-    return ItemType::WEAPON; // 默认值
-}
-
-std::string GameSave::weaponTypeToString(WeaponType type) const {
-    switch (type) {
-        case WeaponType::ONE_HANDED_SWORD: return "ONE_HANDED_SWORD";
-        case WeaponType::TWO_HANDED_SWORD: return "TWO_HANDED_SWORD";
-        case WeaponType::BOW: return "BOW";
-        case WeaponType::CATALYST: return "CATALYST";
-        default: return "ONE_HANDED_SWORD";
-    }
-}
-
-WeaponType GameSave::stringToWeaponType(const std::string& str) const {
-    if (str == "ONE_HANDED_SWORD") return WeaponType::ONE_HANDED_SWORD;
-    if (str == "TWO_HANDED_SWORD") return WeaponType::TWO_HANDED_SWORD;
-    if (str == "BOW") return WeaponType::BOW;
-    if (str == "CATALYST") return WeaponType::CATALYST;
-    return WeaponType::ONE_HANDED_SWORD;
-}
-
-std::string GameSave::artifactTypeToString(ArtifactType type) const {
-    switch (type) {
-        case ArtifactType::FLOWER_OF_LIFE: return "FLOWER_OF_LIFE";
-        case ArtifactType::PLUME_OF_DEATH: return "PLUME_OF_DEATH";
-        case ArtifactType::SANDS_OF_EON: return "SANDS_OF_EON";
-        case ArtifactType::GOBLET_OF_EONOTHEM: return "GOBLET_OF_EONOTHEM";
-        case ArtifactType::CIRCLET_OF_LOGOS: return "CIRCLET_OF_LOGOS";
-        default: return "FLOWER_OF_LIFE";
-    }
-}
-
-ArtifactType GameSave::stringToArtifactType(const std::string& str) const {
-    if (str == "FLOWER_OF_LIFE") return ArtifactType::FLOWER_OF_LIFE;
-    if (str == "PLUME_OF_DEATH") return ArtifactType::PLUME_OF_DEATH;
-    if (str == "SANDS_OF_EON") return ArtifactType::SANDS_OF_EON;
-    if (str == "GOBLET_OF_EONOTHEM") return ArtifactType::GOBLET_OF_EONOTHEM;
-    if (str == "CIRCLET_OF_LOGOS") return ArtifactType::CIRCLET_OF_LOGOS;
-    return ArtifactType::FLOWER_OF_LIFE;
-}
-
-std::string GameSave::foodTypeToString(FoodType type) const {
-    switch (type) {
-        case FoodType::RECOVERY: return "RECOVERY";
-        case FoodType::ATTACK: return "ATTACK";
-        case FoodType::ADVENTURE: return "ADVENTURE";
-        case FoodType::DEFENSE: return "DEFENSE";
-        default: return "RECOVERY";
-    }
-}
-
-FoodType GameSave::stringToFoodType(const std::string& str) const {
-    if (str == "RECOVERY") return FoodType::RECOVERY;
-    if (str == "ATTACK") return FoodType::ATTACK;
-    if (str == "ADVENTURE") return FoodType::ADVENTURE;
-    if (str == "DEFENSE") return FoodType::DEFENSE;
-    return FoodType::RECOVERY;
-}
-
-std::string GameSave::materialTypeToString(MaterialType type) const {
-    switch (type) {
-        case MaterialType::MONSTER_DROP: return "MONSTER_DROP";
-        case MaterialType::COOKING_INGREDIENT: return "COOKING_INGREDIENT";
-        default: return "MONSTER_DROP";
-    }
-}
-
-MaterialType GameSave::stringToMaterialType(const std::string& str) const {
-    if (str == "MONSTER_DROP") return MaterialType::MONSTER_DROP;
-    if (str == "COOKING_INGREDIENT") return MaterialType::COOKING_INGREDIENT;
-    return MaterialType::MONSTER_DROP;
-}
-
-std::string GameSave::rarityToString(Rarity rarity) const {
-    switch (rarity) {
-        case Rarity::ONE_STAR: return "ONE_STAR";
-        case Rarity::TWO_STAR: return "TWO_STAR";
-        case Rarity::THREE_STAR: return "THREE_STAR";
-        case Rarity::FOUR_STAR: return "FOUR_STAR";
-        case Rarity::FIVE_STAR: return "FIVE_STAR";
-        default: return "ONE_STAR";
-    }
-}
-
-Rarity GameSave::stringToRarity(const std::string& str) const {
-    if (str == "ONE_STAR") return Rarity::ONE_STAR;
-    if (str == "TWO_STAR") return Rarity::TWO_STAR;
-    if (str == "THREE_STAR") return Rarity::THREE_STAR;
-    if (str == "FOUR_STAR") return Rarity::FOUR_STAR;
-    if (str == "FIVE_STAR") return Rarity::FIVE_STAR;
-    return Rarity::ONE_STAR;
-}
-
-// 队伍成员状态转换
-std::string GameSave::memberStatusToString(MemberStatus status) const {
-    switch (status) {
-        case MemberStatus::ACTIVE:
-            return "ACTIVE";
-        case MemberStatus::STANDBY:
-            return "STANDBY";
-        case MemberStatus::INJURED:
-            return "INJURED";
-        default:
-            return "STANDBY";
-    }
-}
-
-MemberStatus GameSave::stringToMemberStatus(const std::string& str) const {
-    if (str == "ACTIVE") return MemberStatus::ACTIVE;
-    if (str == "INJURED") return MemberStatus::INJURED;
-    return MemberStatus::STANDBY;
-}
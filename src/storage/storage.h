@@ -1,13 +1,23 @@
 // =============================================
 // 文件: storage.h
 // 描述: 存档系统接口声明，负责序列化/反序列化玩家、队伍与背包。
-// 说明: 使用 nlohmann::json 与文件系统进行读写。
+// 说明: 支持 JSON（.json，可读）与紧凑二进制（.sav）两种格式，
+//       加载时按文件头自动识别；二进制格式实现见 binary_save.cpp。
+//       两种格式都可再经 LZ 压缩（见 lz_codec.h），读取时同样按文件头识别。
+//       二进制格式与压缩帧带 CRC32C 校验；整份写入时保留上一版为 <存档>.bak，
+//       存档损坏时自动从备份恢复。
+//       可选的单文件容器模式（见 slot_store.h）把所有存档槽放在 saves/slots.db 中。
 // =============================================
 #pragma once
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <functional>
 #include <nlohmann/json.hpp>
+#include "async_save_writer.h"
+#include "mapped_file.h"
+#include "slot_store.h"
 #include "../player/player.h"
 #include "../core/team_member.h"
 #include "../core/inventory.h"
@@ -19,7 +29,14 @@ enum class SaveResult {
     FILE_ERROR,
     SERIALIZATION_ERROR,
     INVALID_DATA,
-    FILE_NOT_FOUND
+    FILE_NOT_FOUND,
+    CORRUPTED       // 校验失败
+};
+
+// 存档格式
+enum class SaveFormat {
+    JSON,
+    BINARY
 };
 
 // 游戏状态保存类
@@ -33,21 +50,48 @@ public:
     SaveResult saveGame(const Player& player, const std::string& saveFileName = "save.json");
     SaveResult saveGame(const Player& player, int currentBlockId, const std::string& saveFileName = "save.json");
     
+    // 后台保存：在调用线程序列化当前状态，写盘在后台线程完成（临时文件 + 原子替换）。
+    // 连续多次保存同一文件时只写最新状态；onComplete 在 dispatchSaveCompletions() 中回调
+    using SaveCallback = std::function<void(SaveResult)>;
+    void saveGameAsync(const Player& player, int currentBlockId, const std::string& saveFileName,
+                       SaveCallback onComplete = nullptr);
+    // 日志存档（实现见 save_journal.cpp）：存档槽由快照与追加日志（<存档名>.journal）组成。
+    // 两次保存之间的背包增删按操作记录，玩家与队伍按记录差异，保存时只追加这些小记录；
+    // 日志增长到与快照相当时压缩：重写完整快照并清空日志。加载时自动重放日志。
+    // beginJournal 在新游戏或加载后调用，开始记录该玩家的改动；
+    // loadedFileName 为刚加载的存档时，后续保存可直接接着该存档的日志追加
+    void beginJournal(Player& player, int currentBlockId, const std::string& loadedFileName = "");
+    void saveGameJournaled(const Player& player, int currentBlockId, const std::string& saveFileName,
+                           SaveCallback onComplete = nullptr);
+    
+    // 在 UI 线程派发后台保存的完成回调，返回派发数量
+    size_t dispatchSaveCompletions();
+    // 后台保存完成时的通知（在写入线程调用），用于唤醒 UI 线程
+    void setSaveNotifier(std::function<void()> notifier);
+    // 存档读写的错误与警告（如写盘失败）交给 handler，在 UI 线程调用；未设置时不输出。
+    // 界面运行时终端由界面占用，存档代码不直接写终端
+    void setErrorHandler(std::function<void(const std::string&)> handler) { errorHandler_ = std::move(handler); }
+    
     // 加载游戏状态
     SaveResult loadGame(Player& player, const std::string& saveFileName = "save.json");
     SaveResult loadGame(Player& player, int& currentBlockId, const std::string& saveFileName = "save.json");
     
+    // 最近一次加载中跳过或自动修复的内容（日志中的无效记录、从备份恢复等）。
+    // 加载成功时也可能非空，由调用方决定如何提示；每次加载开始时清空
+    const std::vector<std::string>& getLoadWarnings() const { return loadWarnings_; }
+    
     // 检查存档是否存在
     bool saveExists(const std::string& saveFileName = "save.json") const;
     
     // 获取存档信息
     struct SaveInfo {
         std::string playerName;
-        int level;
-        int x, y;
+        int level = 0;
+        int x = 0, y = 0;
         std::string saveTime;
-        int teamSize;
-        int inventorySize;
+        int teamSize = 0;
+        int inventorySize = 0;
+        bool corrupt = false;   // 摘要可读但存档其余部分校验失败
     };
     
     SaveInfo getSaveInfo(const std::string& saveFileName = "save.json") const;
@@ -55,46 +99,194 @@ public:
     // 列出所有存档文件
     std::vector<std::string> listSaveFiles() const;
     
+    // 列出所有存档及其摘要：一次目录扫描，摘要优先取缓存，
+    // 只对新增或已修改（修改时间/大小变化）的存档读取文件头
+    struct SaveListing {
+        std::string fileName;
+        SaveInfo info;
+    };
+    std::vector<SaveListing> listSaves() const;
+    
+    // 存档目录服务（实现见 save_catalog.cpp）：后台线程并行读取 saves/ 下所有存档的摘要，
+    // 之后监视目录（Linux 上用 inotify；没有 inotify 时在存档界面显示期间每秒比对修改时间）增量更新。
+    // 启动后 listSaves 直接返回内存中的目录，不访问磁盘（首次扫描未完成时等待其完成）。
+    // onChange 在目录线程调用：存档被增删或摘要变化（包括外部改动）时通知 UI 线程刷新；
+    // onError 同样在目录线程调用，交出扫描错误的说明
+    void startSaveCatalog(std::function<void()> onChange = nullptr,
+                          std::function<void(const std::string&)> onError = nullptr);
+    void stopSaveCatalog();
+    // 存档界面显示或隐藏时调用（见上）
+    void setSaveCatalogVisible(bool visible);
+    
     // 删除存档
     bool deleteSave(const std::string& saveFileName) const;
+    // 重命名与复制存档；源存档不存在或目标已存在时失败
+    bool renameSave(const std::string& fromFileName, const std::string& toFileName);
+    bool copySave(const std::string& fromFileName, const std::string& toFileName);
+    
+    // 单文件容器模式：启用时把 saves/ 下的存档移入 saves/slots.db，停用时移回目录。
+    // 容器模式下日志存档退化为整份保存（容器本身即追加写入）。返回是否切换成功
+    bool setSlotStoreEnabled(bool enabled);
+    bool isSlotStoreEnabled() const { return slotStore_ != nullptr; }
+
+    // 存档格式：由扩展名决定写入格式（.sav 为二进制，其余为 JSON）
+    static SaveFormat formatForFile(const std::string& saveFileName);
+    static std::string withFormat(const std::string& saveFileName, SaveFormat format);
+    
+    // 是否压缩新写入的存档（扩展名不变，读取时自动解压）
+    void setCompressionEnabled(bool enabled) { compressionEnabled_ = enabled; }
+    bool isCompressionEnabled() const { return compressionEnabled_; }
+    
+    // 存档格式互转：目标格式由目标文件扩展名决定，保留原存档时间
+    SaveResult convertSave(const std::string& sourceFileName, const std::string& targetFileName);
+    
+    // 把 saves/ 下的旧版 JSON 存档升级到当前结构版本（实现见 save_migration.cpp）。
+    // 已是当前版本的存档只读到版本号即跳过；其余由 workerCount 个线程（0 为 CPU 核数）并行解码重写，
+    // 带日志的存档槽在调用线程合并日志后重写。容器模式下不做任何事
+    struct MigrationReport {
+        size_t upgraded = 0;
+        size_t current = 0;
+        size_t failed = 0;
+    };
+    MigrationReport migrateSaveDirectory(unsigned workerCount = 0);
 
 private:
+    // 读写入口：按格式编码/解码整份存档
+    SaveResult writeSave(const Player& player, int currentBlockId, const std::string& saveTime,
+                         const std::string& saveFileName);
+    SaveResult readSave(Player& player, int& currentBlockId, std::string& saveTime,
+                        const std::string& saveFileName);
+    SaveResult decodeSave(Player& player, int& currentBlockId, std::string& saveTime,
+                          const std::string& saveFileName);
+    // 解码单个快照文件（按文件头识别压缩与格式），不重放日志
+    SaveResult decodeSnapshot(const std::shared_ptr<const MappedFile>& snapshot, Player& player,
+                              int& currentBlockId, std::string& saveTime, const std::string& saveFileName);
+    bool readFile(const std::string& filePath, std::string& data) const;
+    // 按目标格式编码整份存档，并生成对应摘要。chunkEnds 非空时给出分块边界
+    // （仅未压缩的二进制存档有边界，供容器按块共享，见 SlotStore）
+    void encodeSave(const Player& player, int currentBlockId, const std::string& saveTime,
+                    const std::string& saveFileName, std::string& data,
+                    std::vector<size_t>* chunkEnds = nullptr) const;
+    SaveInfo makeSaveInfo(const Player& player, const std::string& saveTime) const;
+    
+    // 存档摘要缓存（实现见 save_index.cpp）：以修改时间与文件大小校验，
+    // 持久化到 saves/.save_index，重启后列表仍无需读取存档
+    struct SaveIndexEntry {
+        int64_t modifiedTime;
+        uint64_t fileSize;
+        SaveInfo info;
+    };
+    void loadSaveIndex() const;
+    void storeSaveIndex() const;
+    void updateSaveIndex(const std::string& saveFileName, const SaveInfo& info) const;
+    void eraseSaveIndex(const std::string& saveFileName) const;
+    bool readSaveInfo(const std::string& filePath, SaveInfo& info) const;
+    // 存档槽的修改时间与大小（索引的校验依据）：有日志（<文件>.journal）时取两者中较新的
+    // 修改时间与两者大小之和；存档文件不存在时返回 false
+    static bool statSaveFile(const std::string& filePath, int64_t& modifiedTime, uint64_t& fileSize);
+    bool readCompressedSaveInfo(const char* data, size_t size, SaveInfo& info) const;
+    // 容器中每个槽的摘要与索引使用相同的编码
+    static std::string encodeSummary(const SaveInfo& info);
+    static bool decodeSummary(const std::string& data, SaveInfo& info);
+    
+    // 单文件容器与存档目录之间的迁移：成功移入（移出）后删除原文件
+    bool importSaveDirectory(SlotStore& store);
+    bool exportSaveDirectory(SlotStore& store);
+    
+    // 存档目录（实现见 save_catalog.cpp）。本对象自己的写入、删除与改名立即同步到目录，
+    // 不等文件系统通知，之后列表即可看到
+    class SaveCatalog;
+    struct SaveCatalogDeleter {
+        void operator()(SaveCatalog* catalog) const;
+    };
+    // entry 为空时重新读取该存档的文件头
+    void refreshSaveCatalog(const std::string& saveFileName, const SaveIndexEntry* entry = nullptr) const;
+    std::vector<SaveListing> listCatalog() const;
+    
+    // 存档日志（实现见 save_journal.cpp）
+    struct JournalState {
+        std::string slot;                            // 正在记录日志的存档槽
+        bool baseValid = false;                      // 磁盘上的快照 + 日志是否等于上次保存时的状态
+        uint64_t baseHash = 0;                       // 快照内容哈希，写在日志头，防止日志接到别的快照上
+        uint64_t snapshotSize = 0;
+        uint64_t journalSize = 0;
+        std::string lastPlayerRecord;                // 上次保存时的玩家记录，用于比较差异
+        std::vector<std::string> lastMemberRecords;  // 上次保存时各队伍成员的记录
+        std::string pendingOps;                      // 尚未写入的背包操作记录
+        bool paused = false;                         // 加载与重放期间不记录
+    };
+    // 最近一次加载时读到的日志状态，供 beginJournal 接续
+    struct JournalLoad {
+        std::string slot;
+        uint64_t baseHash = 0;
+        uint64_t snapshotSize = 0;
+        uint64_t journalSize = 0;
+        bool reusable = false;
+    };
+    std::string getJournalFilePath(const std::string& saveFileName) const;
+    void recordInventoryOp(const InventoryOp& op);
+    void compactJournal(const Player& player, int currentBlockId, const std::string& saveFileName,
+                        SaveCallback onComplete);
+    SaveResult replayJournal(const MappedFile& snapshot, Player& player, int& currentBlockId,
+                             std::string& saveTime, const std::string& saveFileName);
+    // 快照已从备份恢复：当前日志接不上该快照而日志备份（压缩前的旧日志）可以时，用后者替换日志
+    void restoreJournalBackup(const MappedFile& snapshot, const std::string& saveFileName);
+    // 快照 filePath 的日志中最后一次完整提交的摘要覆盖 info（损坏标记沿用快照）；
+    // 没有与该快照匹配的日志时返回 false
+    bool readJournalSummary(const std::string& filePath, const MappedFile& snapshot, SaveInfo& info) const;
+    
+    // 二进制格式（实现见 binary_save.cpp）。解码时背包段不立即解析：
+    // 背包持有物品数据的副本（不持有映射），首次访问物品时才解码（见 Inventory::setPendingItems）
+    static bool isBinarySave(const std::string& data);
+    static bool isBinarySave(const char* data, size_t size);
+    // chunkEnds 收集分块边界：文件头、玩家、每个队伍成员、背包按内容切成的页各自成块，
+    // 未改动的成员与物品页在各存档间字节相同
+    void encodeBinary(const Player& player, int currentBlockId, const std::string& saveTime, std::string& out,
+                      std::vector<size_t>* chunkEnds = nullptr) const;
+    SaveResult decodeBinary(const std::shared_ptr<const MappedFile>& image, Player& player, int& currentBlockId,
+                            std::string& saveTime) const;
+    bool readBinaryInfo(const char* data, size_t size, SaveInfo& info) const;
+    
+    // 两种格式共用的恢复逻辑
+    void restoreActiveMember(Player& player, int activeIndex) const;
+    void restoreInventoryItems(Inventory& inventory, size_t maxCapacity,
+                               const std::vector<std::shared_ptr<Item>>& items) const;
+    
     // 序列化相关方法
     nlohmann::json serializePlayer(const Player& player) const;
     nlohmann::json serializeTeamMember(const TeamMember& member) const;
     nlohmann::json serializeItem(const Item& item) const;
     nlohmann::json serializeInventory(const Inventory& inventory) const;
     
-    // 反序列化相关方法
-    void deserializePlayer(Player& player, const nlohmann::json& json) const;
-    std::shared_ptr<TeamMember> deserializeTeamMember(const nlohmann::json& json) const;
-    std::shared_ptr<Item> deserializeItem(const nlohmann::json& json) const;
-    void deserializeInventory(Inventory& inventory, const nlohmann::json& json) const;
+    // 反序列化（实现见 json_load.cpp）：SAX 流式解析，直接构造玩家、队伍成员与物品；
+    // 旧版本存档在解析过程中按 save_migration.h 的迁移计划改名键、修正记录
+    class JsonLoadHandler;
+    SaveResult decodeJson(const char* data, size_t size, Player& player, int& currentBlockId,
+                          std::string& saveTime) const;
     
     // 辅助方法
     std::string getCurrentTimeString() const;
     std::string getSaveFilePath(const std::string& fileName) const;
     
-    // 物品类型转换
-    std::string itemTypeToString(ItemType type) const;
-    ItemType stringToItemType(const std::string& str) const;
+    bool compressionEnabled_ = false;
     
-    std::string weaponTypeToString(WeaponType type) const;
-    WeaponType stringToWeaponType(const std::string& str) const;
+    mutable std::unordered_map<std::string, SaveIndexEntry> saveIndex_;
+    mutable bool saveIndexLoaded_ = false;
     
-    std::string artifactTypeToString(ArtifactType type) const;
-    ArtifactType stringToArtifactType(const std::string& str) const;
+    mutable JournalState journal_;   // deleteSave（const）删除日志存档槽时需作废基线
+    JournalLoad lastJournalLoad_;
+    std::vector<std::string> loadWarnings_;
     
-    std::string foodTypeToString(FoodType type) const;
-    FoodType stringToFoodType(const std::string& str) const;
+    // 启用单文件容器时非空；槽数据同样经后台写入器写盘
+    std::unique_ptr<SlotStore> slotStore_;
     
-    std::string materialTypeToString(MaterialType type) const;
-    MaterialType stringToMaterialType(const std::string& str) const;
+    // 启用存档目录服务时非空；listSaves 合并目录的修订到摘要缓存后持久化
+    std::unique_ptr<SaveCatalog, SaveCatalogDeleter> catalog_;
+    mutable uint64_t catalogMergedRevision_ = 0;
     
-    std::string rarityToString(Rarity rarity) const;
-    Rarity stringToRarity(const std::string& str) const;
-
-    // 队伍成员状态转换
-    std::string memberStatusToString(MemberStatus status) const;
-    MemberStatus stringToMemberStatus(const std::string& str) const;
+    std::function<void(const std::string&)> errorHandler_;
+    void reportError(const std::string& message) const;
+    
+    // 后台写入器放在最后：析构时最先销毁，先写完剩余存档再释放其他成员
+    mutable AsyncSaveWriter asyncWriter_;
 };
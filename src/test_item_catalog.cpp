@@ -0,0 +1,107 @@
+// =============================================
+// 文件: test_item_catalog.cpp
+// 描述: 物品目录测试：发布的 data/items.json 与内置定义表一致、完美哈希对全部名称无冲突、
+//       未收录名称查不到、无效条目被跳过并报告。任何一项失败时返回非零。
+// 构建: cmake -DCPP_MUD_OUC_BUILD_TESTS=ON 后构建 test_item_catalog，在构建目录运行
+//       （或以目录文件路径为参数）
+// =============================================
+#include "core/item_catalog.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& description) {
+    std::cout << (condition ? "  [通过] " : "  [失败] ") << description << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+bool sameDefinition(const ItemDefinition& a, const ItemDefinition& b) {
+    return a.name == b.name && a.type == b.type && a.subType == b.subType &&
+           a.rarity == b.rarity && a.starter == b.starter;
+}
+
+void testShippedFile(const std::string& path) {
+    std::cout << "\n[发布的目录文件]" << std::endl;
+    ItemCatalog& catalog = ItemCatalog::instance();
+    check(catalog.verifyIndex(), "内置定义的完美哈希无冲突");
+
+    std::vector<ItemDefinition> builtins = catalog.getDefinitions();
+    std::string error;
+    check(catalog.loadFromFile(path, &error), "加载 " + path);
+    check(error.empty(), "发布的文件没有无效条目" + (error.empty() ? "" : "：" + error));
+
+    // 文件与内置定义表一致：条目数不变，每条定义逐字段相同
+    check(catalog.size() == builtins.size(), "文件条目与内置定义一一对应");
+    bool allSame = true;
+    for (const ItemDefinition& builtin : builtins) {
+        const ItemDefinition* loaded = catalog.find(builtin.name);
+        if (!loaded || !sameDefinition(*loaded, builtin)) {
+            std::cout << "    不一致: " << builtin.name << std::endl;
+            allSame = false;
+        }
+    }
+    check(allSame, "文件中每条定义与内置定义相同");
+    check(catalog.verifyIndex(), "加载后的完美哈希无冲突");
+
+    check(catalog.find("不存在的物品") == nullptr, "未收录名称返回空");
+    check(catalog.find("") == nullptr, "空名称返回空");
+    check(catalog.create("苹果", 3) != nullptr, "按名称创建实例");
+}
+
+void testInvalidEntries() {
+    std::cout << "\n[无效条目]" << std::endl;
+    ItemCatalog& catalog = ItemCatalog::instance();
+    size_t before = catalog.size();
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "cpp_mud_item_catalog_test.json";
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << R"({ "items": [
+            {"name": "测试草药", "type": "MATERIAL", "subType": "COOKING_INGREDIENT", "rarity": "ONE_STAR"},
+            {"name": "坏条目", "type": "SHIELD", "subType": "ROUND", "rarity": "ONE_STAR"},
+            {"type": "FOOD", "subType": "RECOVERY", "rarity": "ONE_STAR"}
+        ] })";
+    }
+
+    std::string error;
+    check(catalog.loadFromFile(path.string(), &error), "含无效条目的文件仍然加载");
+    check(!error.empty(), "无效条目被报告");
+    check(catalog.size() == before + 1, "有效条目被追加，无效条目被跳过");
+    check(catalog.contains("测试草药") && !catalog.contains("坏条目"), "只收录有效条目");
+    check(catalog.verifyIndex(), "追加后的完美哈希无冲突");
+
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "{ \"items\": [";
+    }
+    error.clear();
+    check(!catalog.loadFromFile(path.string(), &error), "无法解析的文件返回失败");
+    check(!error.empty(), "解析错误被报告");
+    check(catalog.size() == before + 1 && catalog.verifyIndex(), "解析失败时保持现有定义");
+
+    error.clear();
+    check(!catalog.loadFromFile((path.parent_path() / "cpp_mud_no_such_catalog.json").string(), &error),
+          "文件不存在时返回失败");
+    std::filesystem::remove(path);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== 物品目录测试 ===" << std::endl;
+    std::string path = argc > 1 ? argv[1] : "data/items.json";
+
+    testShippedFile(path);
+    testInvalidEntries();
+
+    std::cout << "\n=== 测试完成，失败 " << failures << " 项 ===" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,484 @@
+// =============================================
+// 文件: test_save_storage.cpp
+// 描述: 存档存储层测试：CRC32C、LZ 帧、分段二进制存档、存档日志（含压缩后的备份恢复）、单文件容器
+//       （含块共享）、注入合成步骤的结构版本迁移，以及目录与容器之间的导入导出。
+//       覆盖往返、截断/损坏与校验失败。
+//       在临时目录下运行，不触碰真实存档；任何一项失败时返回非零。
+// 构建: cmake -DCPP_MUD_OUC_BUILD_TESTS=ON 后构建 test_save_storage
+// =============================================
+#include "storage/storage.h"
+#include "storage/slot_store.h"
+#include "storage/lz_codec.h"
+#include "storage/crc32c.h"
+#include "storage/async_save_writer.h"
+#include "storage/save_migration.h"
+#include "player/player.h"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& description) {
+    std::cout << (condition ? "  [通过] " : "  [失败] ") << description << std::endl;
+    if (!condition) {
+        ++failures;
+    }
+}
+
+std::string readAll(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeAll(const std::filesystem::path& path, const std::string& data) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void flipByte(const std::filesystem::path& path, size_t position) {
+    std::string data = readAll(path);
+    data[position] = static_cast<char>(data[position] ^ 0x5A);
+    writeAll(path, data);
+}
+
+void truncateTo(const std::filesystem::path& path, size_t size) {
+    std::filesystem::resize_file(path, size);
+}
+
+// 后台保存完成前反复派发完成回调
+bool waitFor(GameSave& save, const bool& done) {
+    for (int i = 0; i < 400 && !done; ++i) {
+        save.dispatchSaveCompletions();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    save.dispatchSaveCompletions();
+    return done;
+}
+
+void fillPlayer(Player& player) {
+    for (int i = 0; i < 40; ++i) {
+        player.inventory.addItem(std::make_shared<Weapon>("测试剑" + std::to_string(i), WeaponType::ONE_HANDED_SWORD,
+                                                          Rarity::ONE_STAR, "用于存档测试的武器", 5 + i, 10));
+    }
+}
+
+bool samePlayer(const Player& expected, const Player& actual) {
+    auto expectedItems = expected.inventory.getAllItems();
+    auto actualItems = actual.inventory.getAllItems();
+    if (expected.name != actual.name || expected.x != actual.x || expected.y != actual.y ||
+        expected.level != actual.level || expectedItems.size() != actualItems.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < expectedItems.size(); ++i) {
+        if (expectedItems[i]->getName() != actualItems[i]->getName() ||
+            expectedItems[i]->getQuantity() != actualItems[i]->getQuantity()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testCrc32c() {
+    std::cout << "\n[CRC32C]" << std::endl;
+    const std::string text = "123456789";
+    check(Crc32c::compute(text.data(), text.size()) == 0xE3069283u, "标准测试向量");
+    uint32_t partial = Crc32c::compute(text.data(), 4);
+    check(Crc32c::compute(text.data() + 4, text.size() - 4, partial) == 0xE3069283u, "分段续算与整段一致");
+}
+
+void testLzFrames() {
+    std::cout << "\n[LZ 帧]" << std::endl;
+    std::string input;
+    for (int i = 0; i < 20000; ++i) {
+        input += "存档数据 " + std::to_string(i % 97) + ";";
+    }
+    std::string frame = LzCodec::compress(input);
+    std::string output;
+    check(LzCodec::isCompressed(frame), "压缩结果带帧头");
+    check(frame.size() < input.size(), "重复数据被压缩");
+    check(LzCodec::decompress(frame, output) && output == input, "压缩往返");
+    check(LzCodec::verify(frame.data(), frame.size()), "完整帧通过校验");
+
+    std::string truncated = frame.substr(0, frame.size() / 2);
+    check(!LzCodec::decompress(truncated, output), "截断的帧解压失败");
+    check(!LzCodec::verify(truncated.data(), truncated.size()), "截断的帧未通过校验");
+
+    std::string corrupted = frame;
+    corrupted[corrupted.size() / 2] ^= 0x5A;
+    check(!LzCodec::decompress(corrupted, output), "块数据损坏时 CRC 校验失败");
+    check(!LzCodec::verify(corrupted.data(), corrupted.size()), "块数据损坏时未通过校验");
+
+    std::string empty = LzCodec::compress(std::string());
+    check(LzCodec::decompress(empty, output) && output.empty(), "空数据往返");
+}
+
+void testSectionedSave() {
+    std::cout << "\n[分段二进制存档]" << std::endl;
+    GameSave save;
+    Player player("存档测试", 7, 9);
+    player.level = 5;
+    fillPlayer(player);
+
+    for (bool compressed : {false, true}) {
+        std::string fileName = compressed ? "lz.sav" : "plain.sav";
+        std::string label = compressed ? "（压缩）" : "（未压缩）";
+        save.setCompressionEnabled(compressed);
+        check(save.saveGame(player, 3, fileName) == SaveResult::SUCCESS, "保存" + label);
+        Player loaded("", 0, 0);
+        int blockId = 0;
+        check(save.loadGame(loaded, blockId, fileName) == SaveResult::SUCCESS && blockId == 3 &&
+              samePlayer(player, loaded), "往返" + label);
+    }
+    save.setCompressionEnabled(false);
+
+    // 第二次保存后才有 .bak；主文件损坏时从备份恢复
+    std::filesystem::path path = std::filesystem::path("saves") / "plain.sav";
+    check(save.saveGame(player, 3, "plain.sav") == SaveResult::SUCCESS, "再次保存生成备份");
+    check(std::filesystem::exists(AsyncSaveWriter::backupPathFor(path.string())), "备份文件存在");
+    flipByte(path, std::filesystem::file_size(path) / 2);
+    Player restored("", 0, 0);
+    int blockId = 0;
+    check(save.loadGame(restored, blockId, "plain.sav") == SaveResult::SUCCESS && samePlayer(player, restored),
+          "数据段损坏时从备份恢复");
+
+    // 没有备份时截断与校验失败都应报告错误，不得加载出半份数据
+    std::filesystem::remove(AsyncSaveWriter::backupPathFor(path.string()));
+    check(save.saveGame(player, 3, "single.sav") == SaveResult::SUCCESS, "保存无备份的存档");
+    std::filesystem::path single = std::filesystem::path("saves") / "single.sav";
+    std::string intact = readAll(single);
+    truncateTo(single, intact.size() / 2);
+    Player truncated("", 0, 0);
+    check(save.loadGame(truncated, blockId, "single.sav") != SaveResult::SUCCESS, "截断的存档加载失败");
+
+    writeAll(single, intact);
+    flipByte(single, intact.size() - 8);
+    Player corrupted("", 0, 0);
+    check(save.loadGame(corrupted, blockId, "single.sav") == SaveResult::CORRUPTED, "数据 CRC 校验失败的存档加载失败");
+}
+
+void testJournal() {
+    std::cout << "\n[存档日志]" << std::endl;
+    GameSave save;
+    Player player("日志测试", 1, 1);
+    fillPlayer(player);
+    save.beginJournal(player, 2);
+
+    bool done = false;
+    save.saveGameJournaled(player, 2, "journal.json", [&done](SaveResult) { done = true; });
+    check(waitFor(save, done), "首次日志保存（写快照）");
+
+    // 之后的改动只追加到日志
+    std::filesystem::path journalPath = std::filesystem::path("saves") / "journal.json.journal";
+    player.x = 12;
+    player.inventory.removeItem("测试剑3");
+    player.inventory.addItem(std::make_shared<Weapon>("日志之剑", WeaponType::ONE_HANDED_SWORD, Rarity::THREE_STAR,
+                                                      "日志追加的物品", 30, 10));
+    done = false;
+    save.saveGameJournaled(player, 2, "journal.json", [&done](SaveResult) { done = true; });
+    check(waitFor(save, done), "追加日志保存");
+    check(std::filesystem::exists(journalPath) && std::filesystem::file_size(journalPath) > 0, "日志文件已写入");
+    uint64_t committedSize = std::filesystem::file_size(journalPath);
+
+    GameSave reader;
+    Player loaded("", 0, 0);
+    int blockId = 0;
+    check(reader.loadGame(loaded, blockId, "journal.json") == SaveResult::SUCCESS && samePlayer(player, loaded),
+          "快照 + 日志重放往返");
+
+    // 未完整提交的尾部记录被忽略，恢复到上一次提交
+    Player committed("", 0, 0);
+    reader.loadGame(committed, blockId, "journal.json");
+    player.y = 30;
+    done = false;
+    save.saveGameJournaled(player, 2, "journal.json", [&done](SaveResult) { done = true; });
+    waitFor(save, done);
+    truncateTo(journalPath, static_cast<size_t>(committedSize + (std::filesystem::file_size(journalPath) - committedSize) / 2));
+    GameSave tailReader;
+    Player partial("", 0, 0);
+    check(tailReader.loadGame(partial, blockId, "journal.json") == SaveResult::SUCCESS &&
+          samePlayer(committed, partial), "日志尾部截断时回到上一次提交");
+    check(!tailReader.getLoadWarnings().empty(), "截断的日志经加载警告报告");
+}
+
+void testJournalBackup() {
+    std::cout << "\n[日志压缩与备份恢复]" << std::endl;
+    GameSave save;
+    Player player("备份测试", 1, 1);
+    fillPlayer(player);
+    save.beginJournal(player, 2);
+    auto saveAs = [&](const std::string& fileName) {
+        bool done = false;
+        save.saveGameJournaled(player, 2, fileName, [&done](SaveResult) { done = true; });
+        return waitFor(save, done);
+    };
+
+    // 快照 S1 + 日志 J1（x = 12）
+    check(saveAs("backup.sav"), "写入快照");
+    player.x = 12;
+    check(saveAs("backup.sav"), "追加日志");
+    Player expected("", 0, 0);
+    int blockId = 0;
+    GameSave().loadGame(expected, blockId, "backup.sav");
+
+    // 换到别的存档槽再换回来：重新压缩，旧快照与旧日志各留一份备份
+    player.y = 40;
+    check(saveAs("other.sav") && saveAs("backup.sav"), "压缩日志");
+    std::filesystem::path snapshot = std::filesystem::path("saves") / "backup.sav";
+    check(std::filesystem::exists("saves/backup.sav.bak") && std::filesystem::exists("saves/backup.sav.journal.bak"),
+          "旧快照与旧日志都有备份");
+
+    // 新快照损坏：从备份恢复时连同旧日志一起重放，不丢失压缩前的改动
+    flipByte(snapshot, std::filesystem::file_size(snapshot) - 8);
+    GameSave reader;
+    Player restored("", 0, 0);
+    check(reader.loadGame(restored, blockId, "backup.sav") == SaveResult::SUCCESS && samePlayer(expected, restored) &&
+          restored.x == 12, "快照备份 + 日志备份恢复到压缩前的状态");
+    check(!reader.getLoadWarnings().empty(), "从备份恢复经加载警告报告");
+}
+
+void testSlotStore() {
+    std::cout << "\n[单文件容器]" << std::endl;
+    AsyncSaveWriter writer;
+    std::vector<std::string> errors;
+    auto onError = [&errors](const std::string& message) { errors.push_back(message); };
+    const std::string storePath = "saves/store_test.db";
+
+    std::string first(200000, 'a');
+    std::string second(200000, 'b');
+    {
+        SlotStore store(storePath, writer, onError);
+        check(store.open(), "创建空容器");
+        check(store.put("one", "摘要一", first) && store.put("two", "摘要二", second), "写入两个槽");
+        check(store.rename("two", "three") && !store.contains("two"), "重命名");
+        check(store.copy("one", "copy") && store.remove("one"), "复制与删除");
+        check(!store.rename("copy", "three"), "目标已存在时重命名失败");
+    }
+    {
+        SlotStore store(storePath, writer, onError);
+        check(store.open(), "重新打开容器");
+        auto copied = store.read("copy");
+        auto renamed = store.read("three");
+        check(copied && std::string(copied->data(), copied->size()) == first, "复制的槽重放后数据一致");
+        check(renamed && std::string(renamed->data(), renamed->size()) == second, "重命名的槽重放后数据一致");
+        check(store.summary("three") && *store.summary("three") == "摘要二", "摘要随槽保存");
+        check(!store.contains("one"), "删除在重放后仍然生效");
+    }
+
+    // 末尾记录写到一半：忽略该记录，之前的槽保持不变并报告给调用方
+    {
+        SlotStore store(storePath, writer, onError);
+        store.open();
+        store.put("tail", "", std::string(5000, 't'));
+    }
+    // 容器可能把整理交给后台写入器；改动文件前先等它写完
+    writer.waitIdle();
+    truncateTo(storePath, static_cast<size_t>(std::filesystem::file_size(storePath) - 100));
+    errors.clear();
+    {
+        SlotStore store(storePath, writer, onError);
+        check(store.open(), "末尾记录不完整时仍可打开");
+        check(!store.contains("tail") && store.contains("three"), "不完整的记录被忽略");
+        check(!errors.empty(), "不完整的记录经 onError 报告");
+    }
+
+    // 槽数据损坏：读取失败并报告，不返回损坏的数据
+    writer.waitIdle();
+    std::filesystem::remove(storePath);
+    {
+        SlotStore store(storePath, writer, onError);
+        store.open();
+        store.put("victim", "", second);
+    }
+    writer.waitIdle();
+    std::string image = readAll(storePath);
+    size_t dataPosition = image.rfind(second.substr(0, 64));
+    flipByte(storePath, dataPosition + 10);
+    errors.clear();
+    {
+        SlotStore store(storePath, writer, onError);
+        store.open();
+        check(store.read("victim") == nullptr, "数据 CRC 校验失败时读取失败");
+        check(!errors.empty(), "校验失败经 onError 报告");
+    }
+
+    // 文件头损坏：不覆盖原文件
+    writer.waitIdle();
+    writeAll(storePath, std::string("MUDB") + std::string(40, '\0'));
+    errors.clear();
+    {
+        SlotStore store(storePath, writer, onError);
+        check(!store.open(), "文件头损坏时打开失败");
+        check(!errors.empty() && std::filesystem::file_size(storePath) == 44, "文件头损坏时报告且不覆盖");
+    }
+
+    // 块共享：相近的存档只写入变化的块
+    writer.waitIdle();
+    std::filesystem::remove(storePath);
+    {
+        SlotStore store(storePath, writer, onError);
+        store.open();
+        std::string base;
+        std::vector<size_t> chunkEnds;
+        for (int i = 0; i < 8; ++i) {
+            base += std::string(16384, static_cast<char>('A' + i));
+            chunkEnds.push_back(base.size());
+        }
+        check(store.put("base", "", base, chunkEnds), "分块写入");
+        uint64_t before = std::filesystem::file_size(storePath);
+        std::string variant = base;
+        variant[chunkEnds[5] + 7] = 'z';
+        check(store.put("variant", "", variant, chunkEnds), "写入只改动一块的存档");
+        uint64_t growth = std::filesystem::file_size(storePath) - before;
+        check(growth < variant.size() / 4, "只写入变化的块（增长 " + std::to_string(growth) + " 字节）");
+        auto readBack = store.read("variant");
+        check(readBack && std::string(readBack->data(), readBack->size()) == variant, "分块槽拼接后数据一致");
+        store.compact();
+    }
+    {
+        SlotStore store(storePath, writer, onError);
+        check(store.open() && store.read("base") && store.read("variant"), "整理后两个分块槽仍可读取");
+    }
+}
+
+// 合成的 v1 -> v2 迁移：v1 的玩家经验键名为 "exp"、武器攻击力为 "atk"，耐久按十分制记录
+void upgradeSyntheticItem(ItemRecord& record) {
+    record.durability *= 10;
+}
+
+void testMigration() {
+    std::cout << "\n[结构版本迁移]" << std::endl;
+    check(MigrationPlan::planFor(kLegacySaveSchemaVersion) == nullptr, "登记的 v1 步骤不改动记录，不生成计划");
+    check(MigrationPlan::planFor(kSaveSchemaVersion) == nullptr, "当前版本不需要迁移");
+
+    const std::vector<SaveMigration> registered = saveMigrations();
+    replaceSaveMigrations({{kLegacySaveSchemaVersion, "合成改名",
+                            {{RecordKind::PLAYER, "exp", "experience"}, {RecordKind::ITEM, "atk", "attackPower"}},
+                            nullptr, nullptr, upgradeSyntheticItem}});
+    const MigrationPlan* plan = MigrationPlan::planFor(kLegacySaveSchemaVersion);
+    check(plan != nullptr, "注入的步骤生成迁移计划");
+    check(plan && plan->renameKey(RecordKind::PLAYER, "exp") == "experience" &&
+          plan->renameKey(RecordKind::MEMBER, "exp") == "exp" &&
+          plan->renameKey(RecordKind::ITEM, "durability") == "durability", "改名只作用于登记的记录与键");
+
+    // 版本 1 的存档：没有 formatVersion，版本号写在末尾
+    const std::string legacy = R"({
+        "currentBlockId": 4,
+        "player": {
+            "name": "迁移测试", "x": 2, "y": 3, "level": 6, "exp": 150, "activeMemberIndex": 0,
+            "inventory": { "maxCapacity": 50, "items": [
+                { "type": "WEAPON", "rarity": "THREE_STAR", "name": "旧剑", "description": "v1 武器",
+                  "quantity": 1, "weaponType": "ONE_HANDED_SWORD", "atk": 42, "durability": 7 } ] },
+            "teamMembers": [ { "name": "旅行者", "level": 6, "status": "ACTIVE" } ]
+        },
+        "saveTime": "2020-01-01 00:00:00",
+        "version": "1.0"
+    })";
+    writeAll(std::filesystem::path("saves") / "legacy.json", legacy);
+
+    GameSave save;
+    Player loaded("", 0, 0);
+    int blockId = 0;
+    check(save.loadGame(loaded, blockId, "legacy.json") == SaveResult::SUCCESS && blockId == 4, "加载 v1 存档");
+    auto items = loaded.inventory.getAllItems();
+    auto weapon = items.size() == 1 ? std::dynamic_pointer_cast<Weapon>(items[0]) : nullptr;
+    check(loaded.experience == 150, "玩家键改名后写入新字段");
+    check(weapon && weapon->getAttackPower() == 42, "物品键改名后写入新字段");
+    check(weapon && weapon->getDurability() == 70, "物品修正函数被调用");
+
+    // 批量升级后按当前版本重写，再次加载不经过迁移
+    GameSave::MigrationReport report = save.migrateSaveDirectory(1);
+    std::string rewritten = readAll(std::filesystem::path("saves") / "legacy.json");
+    check(report.upgraded >= 1 && rewritten.find("\"formatVersion\": " + std::to_string(kSaveSchemaVersion)) !=
+                                      std::string::npos, "批量升级写入当前版本号");
+    check(rewritten.find("\"attackPower\": 42") != std::string::npos &&
+          rewritten.find("\"atk\"") == std::string::npos, "升级后的存档使用新键名");
+    Player upgraded("", 0, 0);
+    check(save.loadGame(upgraded, blockId, "legacy.json") == SaveResult::SUCCESS &&
+          upgraded.experience == 150 && upgraded.inventory.getAllItems().size() == 1 &&
+          std::dynamic_pointer_cast<Weapon>(upgraded.inventory.getAllItems()[0])->getDurability() == 70,
+          "升级后的存档不再重复迁移");
+
+    replaceSaveMigrations(registered);
+    check(MigrationPlan::planFor(kLegacySaveSchemaVersion) == nullptr, "恢复登记的步骤");
+    std::filesystem::remove(std::filesystem::path("saves") / "legacy.json");
+}
+
+void testImportExport() {
+    std::cout << "\n[目录与容器互转]" << std::endl;
+    std::filesystem::remove_all("saves");
+    std::filesystem::create_directories("saves");
+    std::vector<std::string> errors;
+    GameSave save;
+    save.setErrorHandler([&errors](const std::string& message) { errors.push_back(message); });
+    Player player("导入测试", 4, 4);
+    fillPlayer(player);
+    check(save.saveGame(player, 1, "move_a.json") == SaveResult::SUCCESS &&
+          save.saveGame(player, 1, "move_b.sav") == SaveResult::SUCCESS, "在目录中保存存档");
+
+    check(save.setSlotStoreEnabled(true), "启用容器并导入");
+    check(!std::filesystem::exists("saves/move_a.json") && !std::filesystem::exists("saves/move_b.sav"),
+          "导入后删除目录中的存档");
+    Player loaded("", 0, 0);
+    int blockId = 0;
+    check(save.loadGame(loaded, blockId, "move_b.sav") == SaveResult::SUCCESS && samePlayer(player, loaded),
+          "从容器加载导入的存档");
+
+    // 目录中出现与容器同名的存档：跳过并报告给调用方
+    check(save.setSlotStoreEnabled(false), "停用容器并导出");
+    check(std::filesystem::exists("saves/move_a.json") && !std::filesystem::exists("saves/slots.db"),
+          "导出后存档回到目录、容器被删除");
+    Player exported("", 0, 0);
+    check(save.loadGame(exported, blockId, "move_a.json") == SaveResult::SUCCESS && samePlayer(player, exported),
+          "从目录加载导出的存档");
+
+    check(save.setSlotStoreEnabled(true), "再次启用容器");
+    check(save.saveGame(player, 1, "clash.json") == SaveResult::SUCCESS, "在容器中保存");
+    save.setSlotStoreEnabled(false);
+    // 容器已导出；手工放回一个同名的容器槽制造冲突
+    {
+        AsyncSaveWriter writer;
+        SlotStore store("saves/slots.db", writer);
+        store.open();
+        store.put("clash.json", "", readAll("saves/clash.json"));
+    }
+    errors.clear();
+    check(save.setSlotStoreEnabled(true), "存在冲突时仍可启用容器");
+    check(!errors.empty() && std::filesystem::exists("saves/clash.json"), "同名存档跳过导入并报告");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 存档存储测试 ===" << std::endl;
+
+    std::filesystem::path workDir = std::filesystem::temp_directory_path() / "cpp_mud_save_storage_test";
+    std::filesystem::remove_all(workDir);
+    std::filesystem::create_directories(workDir / "saves");
+    std::filesystem::current_path(workDir);
+
+    try {
+        testCrc32c();
+        testLzFrames();
+        testSectionedSave();
+        testJournal();
+        testJournalBackup();
+        testSlotStore();
+        testMigration();
+        testImportExport();
+    } catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "\n=== 测试完成，失败 " << failures << " 项 ===" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
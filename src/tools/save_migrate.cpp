@@ -0,0 +1,21 @@
+// =============================================
+// 文件: save_migrate.cpp
+// 描述: 存档批量升级：把当前目录 saves/ 下的旧版 JSON 存档升级到当前结构版本。
+// 用法: save_migrate [线程数=CPU 核数]
+// 说明: 需以 -DCPP_MUD_OUC_BUILD_SAVE_TOOLS=ON 配置。升级前的存档保留为 <存档>.bak。
+// =============================================
+#include "../storage/save_migration.h"
+#include "../storage/storage.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv) {
+    unsigned workerCount = argc > 1 ? static_cast<unsigned>(std::max(0, std::atoi(argv[1]))) : 0;
+
+    GameSave gameSave;
+    GameSave::MigrationReport report = gameSave.migrateSaveDirectory(workerCount);
+    std::printf("结构版本 %d：升级 %zu 个，已是最新 %zu 个，失败 %zu 个\n", kSaveSchemaVersion, report.upgraded,
+                report.current, report.failed);
+    return report.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+// =============================================
+// 文件: fuzzy_index.cpp
+// 描述: 模糊检索索引实现。
+// 打分: 每个命中字符计基础分，落在词首（汉字音节首字母/单词首字母）
+//       与紧接上一个命中字符时加分，起始偏移与中间跳过的字符扣分。
+// =============================================
+#include "fuzzy_index.hpp"
+#include "pinyin.hpp"
+#include "utf8.hpp"
+#include <algorithm>
+
+namespace {
+
+constexpr int kMatchScore = 16;
+constexpr int kWordStartBonus = 10;
+constexpr int kConsecutiveBonus = 8;
+constexpr int kExactBonus = 30;
+
+bool isSeparator(char32_t codePoint) {
+    return codePoint <= U' ' || codePoint == 0x3000 ||
+           codePoint == U'_' || codePoint == U'-' || codePoint == U'.' || codePoint == U'·';
+}
+
+} // namespace
+
+uint32_t FuzzyIndex::charMask(char32_t codePoint) {
+    if (codePoint >= U'a' && codePoint <= U'z') {
+        return 1u << (codePoint - U'a');
+    }
+    if (codePoint >= U'0' && codePoint <= U'9') {
+        return 1u << 26;
+    }
+    return 1u << (27 + codePoint % 5);
+}
+
+void FuzzyIndex::appendChar(Key& key, char32_t codePoint, bool wordStart) {
+    key.text.push_back(codePoint);
+    key.wordStarts.push_back(wordStart);
+    key.mask |= charMask(codePoint);
+}
+
+FuzzyIndex::Entry FuzzyIndex::makeEntry(const std::string& text) {
+    Entry entry;
+    bool wordStart = true;
+    bool previousHan = false;
+    for (char32_t codePoint : Utf8::DecodeFolded(text)) {
+        if (isSeparator(codePoint)) {
+            wordStart = true;
+            continue;
+        }
+
+        const char* syllable = Pinyin::SyllableOf(codePoint);
+        bool start = wordStart || syllable || previousHan;
+        appendChar(entry.original, codePoint, start);
+
+        if (syllable) {
+            appendChar(entry.initials, static_cast<char32_t>(syllable[0]), true);
+            for (const char* p = syllable; *p; ++p) {
+                appendChar(entry.full, static_cast<char32_t>(*p), p == syllable);
+            }
+        } else {
+            if (start) {
+                appendChar(entry.initials, codePoint, true);
+            }
+            appendChar(entry.full, codePoint, start);
+        }
+
+        previousHan = syllable != nullptr;
+        wordStart = false;
+    }
+    return entry;
+}
+
+int FuzzyIndex::scoreKey(const std::u32string& query, uint32_t queryMask, const Key& key) {
+    if (query.size() > key.text.size() || (key.mask & queryMask) != queryMask) {
+        return -1;
+    }
+
+    // 从首字符的每个出现位置各做一次贪心子序列匹配，取最高分
+    int best = -1;
+    for (size_t first = 0; first + query.size() <= key.text.size(); ++first) {
+        if (key.text[first] != query[0]) {
+            continue;
+        }
+
+        int score = 0;
+        size_t previous = first;
+        size_t position = first;
+        bool matched = true;
+        for (size_t q = 0; q < query.size(); ++q) {
+            while (position < key.text.size() && key.text[position] != query[q]) {
+                ++position;
+            }
+            if (position == key.text.size()) {
+                matched = false;
+                break;
+            }
+            score += kMatchScore;
+            if (key.wordStarts[position]) {
+                score += kWordStartBonus;
+            }
+            if (q > 0 && position == previous + 1) {
+                score += kConsecutiveBonus;
+            }
+            previous = position;
+            ++position;
+        }
+        if (!matched) {
+            // 更靠后的起点只会让剩余文本更短，不可能再匹配
+            break;
+        }
+
+        int gaps = static_cast<int>(previous - first + 1 - query.size());
+        score -= static_cast<int>(first) + gaps * 2;
+        if (first == 0 && query.size() == key.text.size()) {
+            score += kExactBonus;
+        }
+        best = std::max(best, score);
+    }
+    return best;
+}
+
+void FuzzyIndex::add(uint32_t id, const std::string& text) {
+    entries_[id] = makeEntry(text);
+}
+
+void FuzzyIndex::remove(uint32_t id) {
+    entries_.erase(id);
+}
+
+std::vector<FuzzyIndex::Match> FuzzyIndex::search(const std::string& query, size_t limit) const {
+    std::u32string folded;
+    uint32_t queryMask = 0;
+    for (char32_t codePoint : Utf8::DecodeFolded(query)) {
+        if (!isSeparator(codePoint)) {
+            folded.push_back(codePoint);
+            queryMask |= charMask(codePoint);
+        }
+    }
+
+    std::vector<Match> matches;
+    if (folded.empty()) {
+        return matches;
+    }
+
+    for (const auto& [id, entry] : entries_) {
+        int score = std::max({scoreKey(folded, queryMask, entry.original),
+                              scoreKey(folded, queryMask, entry.initials),
+                              scoreKey(folded, queryMask, entry.full)});
+        if (score >= 0) {
+            matches.push_back({id, score});
+        }
+    }
+
+    auto byRank = [](const Match& a, const Match& b) {
+        return a.score != b.score ? a.score > b.score : a.id < b.id;
+    };
+    if (limit > 0 && matches.size() > limit) {
+        std::partial_sort(matches.begin(), matches.begin() + limit, matches.end(), byRank);
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end(), byRank);
+    }
+    return matches;
+}
@@ -0,0 +1,51 @@
+// =============================================
+// 文件: fuzzy_index.hpp
+// 描述: 模糊检索索引。插入时预先计算原文、拼音首字母与全拼三种检索键，
+//       查询时对各键做子序列匹配打分并排序，查询耗时与拼音转换无关。
+// =============================================
+
+#ifndef CPP_MUD_OUC_FUZZY_INDEX_HPP
+#define CPP_MUD_OUC_FUZZY_INDEX_HPP
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class FuzzyIndex {
+public:
+    struct Match {
+        uint32_t id;
+        int score;
+    };
+
+    void add(uint32_t id, const std::string& text);
+    void remove(uint32_t id);
+    void clear() { entries_.clear(); }
+    size_t size() const { return entries_.size(); }
+
+    // 按得分从高到低返回匹配项（同分按 id 升序）；limit 为 0 表示不限数量
+    std::vector<Match> search(const std::string& query, size_t limit = 0) const;
+
+private:
+    // 检索键：码点序列 + 词首标记 + 出现字符的位掩码（用于快速排除）
+    struct Key {
+        std::u32string text;
+        std::vector<bool> wordStarts;
+        uint32_t mask = 0;
+    };
+
+    struct Entry {
+        Key original;
+        Key initials;
+        Key full;
+    };
+
+    static uint32_t charMask(char32_t codePoint);
+    static void appendChar(Key& key, char32_t codePoint, bool wordStart);
+    static Entry makeEntry(const std::string& text);
+    static int scoreKey(const std::u32string& query, uint32_t queryMask, const Key& key);
+
+    std::unordered_map<uint32_t, Entry> entries_;
+};
+
+#endif //CPP_MUD_OUC_FUZZY_INDEX_HPP
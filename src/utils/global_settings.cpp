@@ -7,6 +7,10 @@
 
 // 静态成员定义
 bool GlobalSettings::ai_enabled_ = false; // 默认禁用
+bool GlobalSettings::binary_save_enabled_ = false; // 默认使用 JSON 存档
+bool GlobalSettings::save_compression_enabled_ = true; // 默认压缩存档
+int GlobalSettings::autosave_interval_seconds_ = 60; // 默认每分钟最多自动保存一次
+bool GlobalSettings::slot_store_enabled_ = false; // 默认每个存档一个文件
 
 bool GlobalSettings::IsAIEnabled() {
     return ai_enabled_;
@@ -15,3 +19,35 @@ bool GlobalSettings::IsAIEnabled() {
 void GlobalSettings::SetAIEnabled(bool enabled) {
     ai_enabled_ = enabled;
 }
+
+bool GlobalSettings::IsBinarySaveEnabled() {
+    return binary_save_enabled_;
+}
+
+void GlobalSettings::SetBinarySaveEnabled(bool enabled) {
+    binary_save_enabled_ = enabled;
+}
+
+bool GlobalSettings::IsSaveCompressionEnabled() {
+    return save_compression_enabled_;
+}
+
+void GlobalSettings::SetSaveCompressionEnabled(bool enabled) {
+    save_compression_enabled_ = enabled;
+}
+
+int GlobalSettings::GetAutosaveIntervalSeconds() {
+    return autosave_interval_seconds_;
+}
+
+void GlobalSettings::SetAutosaveIntervalSeconds(int seconds) {
+    autosave_interval_seconds_ = seconds < 0 ? 0 : seconds;
+}
+
+bool GlobalSettings::IsSlotStoreEnabled() {
+    return slot_store_enabled_;
+}
+
+void GlobalSettings::SetSlotStoreEnabled(bool enabled) {
+    slot_store_enabled_ = enabled;
+}
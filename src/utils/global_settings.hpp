@@ -14,8 +14,28 @@ public:
     // 设置AI建议开关状态
     static void SetAIEnabled(bool enabled);
     
+    // 新建存档是否使用二进制格式（.sav）
+    static bool IsBinarySaveEnabled();
+    static void SetBinarySaveEnabled(bool enabled);
+    
+    // 新写入的存档是否压缩（读取时自动识别，与格式设置相互独立）
+    static bool IsSaveCompressionEnabled();
+    static void SetSaveCompressionEnabled(bool enabled);
+    
+    // 定时自动保存的间隔（秒），0 表示只在离开游戏界面时保存；无改动时不会写盘
+    static int GetAutosaveIntervalSeconds();
+    static void SetAutosaveIntervalSeconds(int seconds);
+    
+    // 是否把所有存档放在单文件容器 saves/slots.db 中（否则每个存档一个文件）
+    static bool IsSlotStoreEnabled();
+    static void SetSlotStoreEnabled(bool enabled);
+    
 private:
     static bool ai_enabled_;
+    static bool binary_save_enabled_;
+    static bool save_compression_enabled_;
+    static int autosave_interval_seconds_;
+    static bool slot_store_enabled_;
 };
 
 #endif //CPP_MUD_OUC_GLOBAL_SETTINGS_HPP
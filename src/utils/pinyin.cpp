@@ -0,0 +1,19 @@
+// =============================================
+// 文件: pinyin.cpp
+// 描述: 汉字拼音查询实现。
+// =============================================
+#include "pinyin.hpp"
+#include <algorithm>
+
+const char* Pinyin::SyllableOf(char32_t codePoint) {
+    if (codePoint < 0x3400 || codePoint > 0x9FFF) {
+        return nullptr;
+    }
+    const uint32_t* begin = pinyin_data::kCharSyllables;
+    const uint32_t* end = begin + pinyin_data::kCharSyllableCount;
+    const uint32_t* it = std::lower_bound(begin, end, static_cast<uint32_t>(codePoint) << 9);
+    if (it == end || (*it >> 9) != codePoint) {
+        return nullptr;
+    }
+    return pinyin_data::kSyllables[*it & 0x1FF];
+}
@@ -0,0 +1,24 @@
+// =============================================
+// 文件: pinyin.hpp
+// 描述: 汉字拼音查询。数据表见 pinyin_data.cpp（GB2312 常用汉字）。
+// =============================================
+
+#ifndef CPP_MUD_OUC_PINYIN_HPP
+#define CPP_MUD_OUC_PINYIN_HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace pinyin_data {
+extern const char* const kSyllables[];
+extern const size_t kSyllableCount;
+extern const uint32_t kCharSyllables[];
+extern const size_t kCharSyllableCount;
+} // namespace pinyin_data
+
+class Pinyin {
+public:
+    // 单个汉字的无声调拼音（小写，ü 记为 v）；未收录返回 nullptr
+    static const char* SyllableOf(char32_t codePoint);
+};
+
+#endif //CPP_MUD_OUC_PINYIN_HPP
@@ -0,0 +1,731 @@
+// =============================================
+// 文件: pinyin_data.cpp
+// 描述: 拼音数据表。覆盖 GB2312 一、二级汉字（6763 字），多音字取常用读音。
+// 说明: 由 ICU Han-Latin 转写生成（去声调，ü 记为 v），请勿手工编辑。
+// =============================================
+#include "pinyin.hpp"
+
+namespace pinyin_data {
+
+// 无声调音节表（按字典序）
+extern const char* const kSyllables[] = {
+    "a", "ai", "an", "ang", "ao", "ba", "bai", "ban", "bang", "bao", "bei", "ben",
+    "beng", "bi", "bian", "biao", "bie", "bin", "bing", "bo", "bu", "ca", "cai", "can",
+    "cang", "cao", "ce", "cen", "ceng", "cha", "chai", "chan", "chang", "chao", "che", "chen",
+    "cheng", "chi", "chong", "chou", "chu", "chuai", "chuan", "chuang", "chui", "chun", "chuo", "ci",
+    "cong", "cou", "cu", "cuan", "cui", "cun", "cuo", "da", "dai", "dan", "dang", "dao",
+    "de", "deng", "di", "dian", "diao", "die", "ding", "diu", "dong", "dou", "du", "duan",
+    "dui", "dun", "duo", "e", "ei", "en", "er", "fa", "fan", "fang", "fei", "fen",
+    "feng", "fou", "fu", "ga", "gai", "gan", "gang", "gao", "ge", "gei", "gen", "geng",
+    "gong", "gou", "gu", "gua", "guai", "guan", "guang", "gui", "gun", "guo", "ha", "hai",
+    "han", "hang", "hao", "he", "hei", "hen", "heng", "hong", "hou", "hu", "hua", "huai",
+    "huan", "huang", "hui", "hun", "huo", "ji", "jia", "jian", "jiang", "jiao", "jie", "jin",
+    "jing", "jiong", "jiu", "ju", "juan", "jue", "jun", "ka", "kai", "kan", "kang", "kao",
+    "ke", "ken", "keng", "kong", "kou", "ku", "kua", "kuai", "kuan", "kuang", "kui", "kun",
+    "kuo", "la", "lai", "lan", "lang", "lao", "le", "lei", "leng", "li", "lia", "lian",
+    "liang", "liao", "lie", "lin", "ling", "liu", "long", "lou", "lu", "luan", "lun", "luo",
+    "lv", "lve", "ma", "mai", "man", "mang", "mao", "me", "mei", "men", "meng", "mi",
+    "mian", "miao", "mie", "min", "ming", "miu", "mo", "mou", "mu", "n", "na", "nai",
+    "nan", "nang", "nao", "ne", "nei", "nen", "neng", "ni", "nian", "niang", "niao", "nie",
+    "nin", "ning", "niu", "nong", "nou", "nu", "nuan", "nuo", "nv", "nve", "o", "ou",
+    "pa", "pai", "pan", "pang", "pao", "pei", "pen", "peng", "pi", "pian", "piao", "pie",
+    "pin", "ping", "po", "pou", "pu", "qi", "qia", "qian", "qiang", "qiao", "qie", "qin",
+    "qing", "qiong", "qiu", "qu", "quan", "que", "qun", "ran", "rang", "rao", "re", "ren",
+    "reng", "ri", "rong", "rou", "ru", "ruan", "rui", "run", "ruo", "sa", "sai", "san",
+    "sang", "sao", "se", "sen", "seng", "sha", "shai", "shan", "shang", "shao", "she", "shei",
+    "shen", "sheng", "shi", "shou", "shu", "shua", "shuai", "shuan", "shuang", "shui", "shun", "shuo",
+    "si", "song", "sou", "su", "suan", "sui", "sun", "suo", "ta", "tai", "tan", "tang",
+    "tao", "te", "teng", "ti", "tian", "tiao", "tie", "ting", "tong", "tou", "tu", "tuan",
+    "tui", "tun", "tuo", "wa", "wai", "wan", "wang", "wei", "wen", "weng", "wo", "wu",
+    "xi", "xia", "xian", "xiang", "xiao", "xie", "xin", "xing", "xiong", "xiu", "xu", "xuan",
+    "xue", "xun", "ya", "yan", "yang", "yao", "ye", "yi", "yin", "ying", "yo", "yong",
+    "you", "yu", "yuan", "yue", "yun", "za", "zai", "zan", "zang", "zao", "ze", "zei",
+    "zen", "zeng", "zha", "zhai", "zhan", "zhang", "zhao", "zhe", "zhen", "zheng", "zhi", "zhong",
+    "zhou", "zhu", "zhua", "zhuai", "zhuan", "zhuang", "zhui", "zhun", "zhuo", "zi", "zong", "zou",
+    "zu", "zuan", "zui", "zun", "zuo",
+};
+extern const size_t kSyllableCount = sizeof(kSyllables) / sizeof(kSyllables[0]);
+
+// 汉字 -> 音节：每项为 (码点 << 9) | 音节下标，按码点升序
+extern const uint32_t kCharSyllables[] = {
+    0x09c0163, 0x09c0242, 0x09c06f5, 0x09c0f49, 0x09c1179, 0x09c1313, 0x09c151c, 0x09c1751, 0x09c187d, 0x09c1a14,
+    0x09c1d69, 0x09c2058, 0x09c2227, 0x09c2784, 0x09c28fa, 0x09c2aec, 0x09c2d22, 0x09c30fe, 0x09c3212, 0x09c3562,
+    0x09c3630, 0x09c3844, 0x09c3b2c, 0x09c3c24, 0x09c4443, 0x09c48a8, 0x09c4b5f, 0x09c4f14, 0x09c5068, 0x09c545c,
+    0x09c575e, 0x09c58f8, 0x09c5b7f, 0x09c6054, 0x09c642a, 0x09c68ab, 0x09c6d81, 0x09c7149, 0x09c7239, 0x09c754b,
+    0x09c7781, 0x09c7aa5, 0x09c7c87, 0x09c7eef, 0x09c86cb, 0x09c8a86, 0x09c8f46, 0x09c90bb, 0x09c9363, 0x09c977e,
+    0x09c994f, 0x09c9b76, 0x09c9c75, 0x09c9e4f, 0x09ca0a2, 0x09ca4f1, 0x09ca6e7, 0x09ca8f9, 0x09cac64, 0x09cb024,
+    0x09cb363, 0x09cb8c2, 0x09cba86, 0x09cbcf5, 0x09cbf62, 0x09cc150, 0x09cc353, 0x09ccd24, 0x09cd27d, 0x09ce0b7,
+    0x09ce2b1, 0x09ce70c, 0x09cfcf7, 0x09d0ca2, 0x09d1169, 0x09d137d, 0x09d1722, 0x09d184e, 0x09d1a28, 0x09d1d69,
+    0x09d1e9a, 0x09d236c, 0x09d2475, 0x09d26f5, 0x09d294f, 0x09d2a84, 0x09d305e, 0x09d355e, 0x09d3755, 0x09d3e7d,
+    0x09d4141, 0x09d434a, 0x09d448e, 0x09d4881, 0x09d4a6b, 0x09d4d63, 0x09d4e1f, 0x09d5072, 0x09d52c8, 0x09d5753,
+    0x09d5884, 0x09d5b3f, 0x09d5ca8, 0x09d64fb, 0x09d6613, 0x09d6b55, 0x09d7507, 0x09d7707, 0x09d7f63, 0x09d8120,
+    0x09d8307, 0x09d84a2, 0x09d8642, 0x09d8972, 0x09d8a83, 0x09d8cf4, 0x09d8e27, 0x09d9379, 0x09d9483, 0x09d9682,
+    0x09d9b08, 0x09d9c30, 0x09da2b2, 0x09da618, 0x09da989, 0x09dab22, 0x09dad34, 0x09daf79, 0x09db056, 0x09db352,
+    0x09dbb40, 0x09dbd07, 0x09dbef7, 0x09dc25c, 0x09dc638, 0x09dc8ac, 0x09dcb63, 0x09dd111, 0x09dd563, 0x09dd6c8,
+    0x09dd8bd, 0x09de160, 0x09de57f, 0x09de6ec, 0x09deb4f, 0x09dec7f, 0x09dee7e, 0x09df707, 0x09dfa53, 0x09dfe51,
+    0x09e02f5, 0x09e128e, 0x09e1563, 0x09e1b4f, 0x09e1c7d, 0x09e1e56, 0x09e204f, 0x09e2359, 0x09e2f7f, 0x09e3168,
+    0x09e327c, 0x09e347a, 0x09e3769, 0x09e3d13, 0x09e3f4b, 0x09e402a, 0x09e455e, 0x09e491c, 0x09e4a20, 0x09e4cb2,
+    0x09e4e18, 0x09e554b, 0x09e5781, 0x09e5e13, 0x09e6062, 0x09e64d3, 0x09e6807, 0x09e6cac, 0x09e7120, 0x09e742f,
+    0x09e7922, 0x09e7a7e, 0x09e863f, 0x09e8c39, 0x09e9b4b, 0x09e9c3e, 0x09e9f81, 0x09ea190, 0x09ea368, 0x09ea73b,
+    0x09eaa6f, 0x09eaf46, 0x09eb11e, 0x09eb369, 0x09eb563, 0x09eb656, 0x09eb990, 0x09eba61, 0x09ebcd9, 0x09ebf40,
+    0x09ec0d3, 0x09ec767, 0x09ec947, 0x09ecaf7, 0x09ece8b, 0x09ed2e9, 0x09ed8a1, 0x09edf60, 0x09ee006, 0x09ee67e,
+    0x09ee84e, 0x09eec7d, 0x09ef73d, 0x09ef881, 0x09efd63, 0x09eff22, 0x09f068d, 0x09f097e, 0x09f1025, 0x09f1296,
+    0x09f16a5, 0x09f1b22, 0x09f1f81, 0x09f2368, 0x09f28c7, 0x09f2e44, 0x09f3660, 0x09f3b63, 0x09f4151, 0x09f46b4,
+    0x09f4a81, 0x09f4d7c, 0x09f4e1a, 0x09f50f9, 0x09f5297, 0x09f541e, 0x09f58db, 0x09f5d4f, 0x09f5e74, 0x09f6afb,
+    0x09f7e0e, 0x09f8632, 0x09f884b, 0x09f8afe, 0x09f948a, 0x09f9d8c, 0x09f9ef9, 0x09fa0a5, 0x09fa367, 0x09faf2f,
+    0x09fb056, 0x09fb4a5, 0x09fb8f1, 0x09fba09, 0x09fbd69, 0x09fbef5, 0x09fc356, 0x09fc769, 0x09fcc27, 0x09fd15f,
+    0x09fd2a6, 0x09fd4a5, 0x09fda7f, 0x09fdd59, 0x09fde56, 0x09fe287, 0x09fe6e5, 0x09ff054, 0x09ff402, 0x09ffc0d,
+    0x0a01865, 0x0a01a0a, 0x0a01f24, 0x0a0243b, 0x0a02889, 0x0a03137, 0x0a03274, 0x0a03563, 0x0a0393b, 0x0a03e82,
+    0x0a04220, 0x0a04a93, 0x0a04c88, 0x0a05087, 0x0a052f7, 0x0a054d3, 0x0a05988, 0x0a05b4e, 0x0a05cb3, 0x0a07577,
+    0x0a0797e, 0x0a07cfc, 0x0a0875f, 0x0a08e7e, 0x0a0907d, 0x0a09910, 0x0a09d4b, 0x0a09eed, 0x0a0ab55, 0x0a0b590,
+    0x0a0b93f, 0x0a0ca7f, 0x0a0d98a, 0x0a0ece3, 0x0a0ef41, 0x0a0f6af, 0x0a0fc53, 0x0a0fe20, 0x0a10067, 0x0a10a56,
+    0x0a110a5, 0x0a11a08, 0x0a14638, 0x0a14b37, 0x0a14e11, 0x0a15028, 0x0a152df, 0x0a15834, 0x0a16404, 0x0a17425,
+    0x0a17719, 0x0a19f53, 0x0a1ad50, 0x0a1b4a9, 0x0a1cc86, 0x0a1cf18, 0x0a1d881, 0x0a1da7f, 0x0a1dd40, 0x0a1e72f,
+    0x0a1ea80, 0x0a1f6ec, 0x0a20c84, 0x0a20f5b, 0x0a21639, 0x0a2250c, 0x0a242a3, 0x0a27e4e, 0x0a2814f, 0x0a2836c,
+    0x0a2876a, 0x0a28958, 0x0a28a26, 0x0a28d7a, 0x0a29152, 0x0a29266, 0x0a29690, 0x0a29ac0, 0x0a2a248, 0x0a2a942,
+    0x0a2ab2c, 0x0a2ad5f, 0x0a2b43a, 0x0a2b845, 0x0a2c484, 0x0a2cb0c, 0x0a2d100, 0x0a2d605, 0x0a2d860, 0x0a2daad,
+    0x0a2dd50, 0x0a2e09f, 0x0a2e260, 0x0a2e665, 0x0a2e957, 0x0a2ea12, 0x0a2ecf5, 0x0a2ee87, 0x0a2f03f, 0x0a2f389,
+    0x0a2f760, 0x0a2f87f, 0x0a2fb23, 0x0a3007d, 0x0a3021f, 0x0a30485, 0x0a30ad0, 0x0a3105a, 0x0a31303, 0x0a3181a,
+    0x0a31b6e, 0x0a324ba, 0x0a32ac0, 0x0a32cbf, 0x0a32f0a, 0x0a33355, 0x0a3368a, 0x0a338db, 0x0a34065, 0x0a3457f,
+    0x0a3496a, 0x0a34ac4, 0x0a35612, 0x0a35844, 0x0a35e54, 0x0a36012, 0x0a36275, 0x0a36426, 0x0a36689, 0x0a36a99,
+    0x0a36d62, 0x0a36ea4, 0x0a37644, 0x0a37952, 0x0a37aaa, 0x0a38084, 0x0a388f5, 0x0a38d87, 0x0a38f2d, 0x0a392a8,
+    0x0a39640, 0x0a398ac, 0x0a39e7f, 0x0a3a231, 0x0a3b6ab, 0x0a3bad9, 0x0a3c07d, 0x0a3c250, 0x0a3c854, 0x0a3d656,
+    0x0a3daf1, 0x0a3de8c, 0x0a3e079, 0x0a3e63d, 0x0a3eaf7, 0x0a3ed58, 0x0a3f142, 0x0a3f204, 0x0a3f428, 0x0a3f67d,
+    0x0a3f83a, 0x0a3fa6c, 0x0a3ff71, 0x0a4003b, 0x0a40240, 0x0a4043b, 0x0a40707, 0x0a40c53, 0x0a40efa, 0x0a41163,
+    0x0a4148d, 0x0a41a28, 0x0a41d4c, 0x0a42357, 0x0a42476, 0x0a42d6b, 0x0a42eaa, 0x0a430ad, 0x0a43372, 0x0a4345a,
+    0x0a4362b, 0x0a43a28, 0x0a4411b, 0x0a448e6, 0x0a450e8, 0x0a452a5, 0x0a45610, 0x0a45a84, 0x0a45c63, 0x0a4603b,
+    0x0a46695, 0x0a46d7e, 0x0a46f25, 0x0a47100, 0x0a47319, 0x0a4742f, 0x0a47690, 0x0a47a67, 0x0a47e67, 0x0a4808c,
+    0x0a4824a, 0x0a4847d, 0x0a4873b, 0x0a4955c, 0x0a4989d, 0x0a49af7, 0x0a4a063, 0x0a4a27f, 0x0a4a93b, 0x0a4acf3,
+    0x0a4b949, 0x0a4bc7d, 0x0a4c31b, 0x0a4ca13, 0x0a4ce87, 0x0a4d321, 0x0a4d47f, 0x0a4de56, 0x0a4e45c, 0x0a4faee,
+    0x0a4fe81, 0x0a502f9, 0x0a50489, 0x0a510ec, 0x0a5207c, 0x0a52763, 0x0a536a5, 0x0a53b00, 0x0a53c07, 0x0a53e60,
+    0x0a5407e, 0x0a5434f, 0x0a544b7, 0x0a546aa, 0x0a55044, 0x0a55381, 0x0a554dd, 0x0a55682, 0x0a558ff, 0x0a55b1d,
+    0x0a562a5, 0x0a56483, 0x0a566a1, 0x0a57c6f, 0x0a57f22, 0x0a58613, 0x0a58f67, 0x0a592c0, 0x0a5975d, 0x0a5a0be,
+    0x0a5a4a3, 0x0a5ad5a, 0x0a5b08d, 0x0a5bec8, 0x0a5c8fb, 0x0a5e155, 0x0a5f209, 0x0a5f51d, 0x0a5fc61, 0x0a5ff4f,
+    0x0a6016c, 0x0a60a09, 0x0a60c30, 0x0a61158, 0x0a61af4, 0x0a61ee8, 0x0a62056, 0x0a62a0d, 0x0a62c76, 0x0a62e0a,
+    0x0a63322, 0x0a63451, 0x0a63b6d, 0x0a64080, 0x0a64299, 0x0a64751, 0x0a64c67, 0x0a65452, 0x0a65c9a, 0x0a672ec,
+    0x0a674ff, 0x0a67763, 0x0a67c0e, 0x0a67ed3, 0x0a68322, 0x0a686f7, 0x0a68b11, 0x0a68f21, 0x0a6914f, 0x0a6927a,
+    0x0a69407, 0x0a69c76, 0x0a69f55, 0x0a6a20a, 0x0a6a58c, 0x0a6a788, 0x0a6aa39, 0x0a6acb7, 0x0a6aecc, 0x0a6b413,
+    0x0a6b813, 0x0a6bc0e, 0x0a6be14, 0x0a6c178, 0x0a6c28b, 0x0a6c4b0, 0x0a6c768, 0x0a6c8b0, 0x0a6cc63, 0x0a6cf4e,
+    0x0a6d282, 0x0a6d74b, 0x0a6dd7e, 0x0a6deba, 0x0a6e164, 0x0a6e34b, 0x0a6e67d, 0x0a6e901, 0x0a6eab1, 0x0a6ee88,
+    0x0a6f155, 0x0a6f483, 0x0a6fefc, 0x0a70420, 0x0a7084b, 0x0a70b3f, 0x0a70ca5, 0x0a712a5, 0x0a7175e, 0x0a7195f,
+    0x0a71b1e, 0x0a72a1a, 0x0a730a5, 0x0a73474, 0x0a73a36, 0x0a73f6a, 0x0a74553, 0x0a7475f, 0x0a74a89, 0x0a74d19,
+    0x0a75028, 0x0a75286, 0x0a75d2c, 0x0a76d2c, 0x0a776ff, 0x0a77f52, 0x0a78313, 0x0a78417, 0x0a79168, 0x0a7921d,
+    0x0a7947d, 0x0a79768, 0x0a79928, 0x0a79a50, 0x0a7a24f, 0x0a7a924, 0x0a7acff, 0x0a7af23, 0x0a7b00e, 0x0a7b35a,
+    0x0a7b6e6, 0x0a7bf2e, 0x0a7c041, 0x0a7c694, 0x0a7c862, 0x0a7ca87, 0x0a7ccac, 0x0a7d03b, 0x0a7d294, 0x0a7d57e,
+    0x0a7d681, 0x0a7d97a, 0x0a7da05, 0x0a7dc42, 0x0a7de90, 0x0a7e135, 0x0a7e225, 0x0a7e522, 0x0a7e768, 0x0a7eaf2,
+    0x0a7ed62, 0x0a7ee6e, 0x0a7f12c, 0x0a7f336, 0x0a7f6a2, 0x0a7f840, 0x0a7fa7d, 0x0a8035a, 0x0a80625, 0x0a8085c,
+    0x0a80d61, 0x0a8106f, 0x0a8127d, 0x0a81440, 0x0a81940, 0x0a81ac4, 0x0a81c74, 0x0a81ea5, 0x0a82142, 0x0a82353,
+    0x0a82576, 0x0a82751, 0x0a82ab4, 0x0a82d5e, 0x0a82eb6, 0x0a8368a, 0x0a83aab, 0x0a83d45, 0x0a83f64, 0x0a84052,
+    0x0a8420d, 0x0a846fb, 0x0a84c55, 0x0a84e05, 0x0a85049, 0x0a85253, 0x0a8566c, 0x0a8593f, 0x0a85a92, 0x0a85d2a,
+    0x0a85ef5, 0x0a8637e, 0x0a86564, 0x0a8694f, 0x0a86a21, 0x0a87150, 0x0a8722c, 0x0a8774c, 0x0a87874, 0x0a87d4f,
+    0x0a8815e, 0x0a8864b, 0x0a88c38, 0x0a89024, 0x0a8945b, 0x0a89656, 0x0a8a0ca, 0x0a8a456, 0x0a8a763, 0x0a8a838,
+    0x0a8aae3, 0x0a8aca5, 0x0a8ae0a, 0x0a8b16a, 0x0a8b269, 0x0a8b6f8, 0x0a8b94f, 0x0a8c4cf, 0x0a8c8ac, 0x0a8cd68,
+    0x0a8d180, 0x0a8e262, 0x0a8e42f, 0x0a8e74b, 0x0a8ea6f, 0x0a8ecce, 0x0a8ee57, 0x0a8f0e9, 0x0a8f720, 0x0a8f875,
+    0x0a8fac4, 0x0a90087, 0x0a9056d, 0x0a9084a, 0x0a90ce8, 0x0a9176d, 0x0a9186f, 0x0a91c86, 0x0a91f67, 0x0a92056,
+    0x0a92580, 0x0a9288b, 0x0a92a62, 0x0a92c8b, 0x0a932ae, 0x0a93444, 0x0a936d9, 0x0a93b2c, 0x0a94666, 0x0a94976,
+    0x0a94d63, 0x0a94eaa, 0x0a95189, 0x0a952c2, 0x0a954bf, 0x0a9577e, 0x0a95961, 0x0a95a7d, 0x0a95e5c, 0x0a9636f,
+    0x0a9666b, 0x0a9687a, 0x0a97152, 0x0a97759, 0x0a97b5f, 0x0a97f63, 0x0a98001, 0x0a982f0, 0x0a98520, 0x0a98873,
+    0x0a98c4a, 0x0a98f47, 0x0a9906a, 0x0a9936e, 0x0a998e5, 0x0a99b53, 0x0a99c01, 0x0a99e5e, 0x0a9a099, 0x0a9a35e,
+    0x0a9a437, 0x0a9a754, 0x0a9a80d, 0x0a9aa7a, 0x0a9ae76, 0x0a9b297, 0x0a9b44a, 0x0a9b87d, 0x0a9badb, 0x0a9bcc7,
+    0x0a9bf66, 0x0a9ca5c, 0x0a9cce2, 0x0a9ce25, 0x0a9d11d, 0x0a9d2a5, 0x0a9d4ca, 0x0a9da95, 0x0a9dd54, 0x0a9e57b,
+    0x0a9e776, 0x0a9f414, 0x0a9f872, 0x0a9fa5f, 0x0a9fe5c, 0x0aa035f, 0x0aa0d33, 0x0aa0e2d, 0x0aa1201, 0x0aa1f50,
+    0x0aa2137, 0x0aa2390, 0x0aa294f, 0x0aa36b6, 0x0aa40a1, 0x0aa4533, 0x0aa4771, 0x0aa4878, 0x0aa4e7d, 0x0aa5454,
+    0x0aa5875, 0x0aa5d23, 0x0aa5f4b, 0x0aa6125, 0x0aa6220, 0x0aa66a5, 0x0aa6f66, 0x0aa7919, 0x0aa7d46, 0x0aa7e75,
+    0x0aa837a, 0x0aa8691, 0x0aa8988, 0x0aa8d1c, 0x0aa92ab, 0x0aa9400, 0x0aaa034, 0x0aaab38, 0x0aaac39, 0x0aab829,
+    0x0aac252, 0x0aac8ec, 0x0aacb19, 0x0aacc9d, 0x0aacf72, 0x0aad4e4, 0x0aad916, 0x0aadb84, 0x0aadcd7, 0x0aaea13,
+    0x0aaec42, 0x0aaeea0, 0x0aaf154, 0x0aaf625, 0x0aaf93b, 0x0aafc86, 0x0ab008b, 0x0ab0367, 0x0ab054b, 0x0ab06cc,
+    0x0ab091b, 0x0ab0e9d, 0x0ab1082, 0x0ab1274, 0x0ab146c, 0x0ab1641, 0x0ab1edf, 0x0ab2364, 0x0ab28e2, 0x0ab302a,
+    0x0ab327a, 0x0ab3950, 0x0ab3a6f, 0x0ab3e9a, 0x0ab4f5b, 0x0ab62a5, 0x0ab6776, 0x0ab6ac1, 0x0ab6eea, 0x0ab729a,
+    0x0ab7769, 0x0ab7aaf, 0x0ab7c95, 0x0ab8800, 0x0ab8b59, 0x0ab932f, 0x0ab9801, 0x0ab9b33, 0x0aba290, 0x0aba437,
+    0x0aba714, 0x0aba823, 0x0abad2e, 0x0abb922, 0x0abba5c, 0x0abbe82, 0x0abc34d, 0x0abc72c, 0x0abc825, 0x0abca6e,
+    0x0abcd33, 0x0abd06b, 0x0abd4fb, 0x0abd6d7, 0x0abd86f, 0x0abdec9, 0x0abe441, 0x0abe601, 0x0abeb40, 0x0abee04,
+    0x0abfb2e, 0x0abfd2e, 0x0ac003e, 0x0ac02f5, 0x0ac1019, 0x0ac127e, 0x0ac18ee, 0x0ac1c57, 0x0ac1e62, 0x0ac315a,
+    0x0ac36b6, 0x0ac3ca3, 0x0ac3e46, 0x0ac460c, 0x0ac4965, 0x0ac4ebf, 0x0ac5829, 0x0ac5aeb, 0x0ac6381, 0x0ac6421,
+    0x0ac698e, 0x0ac6d2c, 0x0ac72a9, 0x0ac7750, 0x0ac7e70, 0x0ac981c, 0x0ac9a81, 0x0ac9d62, 0x0aca83d, 0x0acaef4,
+    0x0acb089, 0x0acb2fb, 0x0acb8b0, 0x0acc4e2, 0x0acc883, 0x0acd0f5, 0x0acd24b, 0x0acd571, 0x0acd763, 0x0acd922,
+    0x0ace289, 0x0acec57, 0x0acf712, 0x0acf8ec, 0x0ad0b0c, 0x0ad0c6e, 0x0ad1c6e, 0x0ad1f3b, 0x0ad2615, 0x0ad4754,
+    0x0ad5e7c, 0x0ad6f04, 0x0ad7889, 0x0ad94cd, 0x0ada8cd, 0x0adaf4b, 0x0adb4fe, 0x0adb72c, 0x0adba7f, 0x0adbc7a,
+    0x0adbf56, 0x0adc164, 0x0adc2cc, 0x0adc543, 0x0adc849, 0x0add675, 0x0addb6a, 0x0ade09b, 0x0ade230, 0x0ade94b,
+    0x0adeab2, 0x0adf2ac, 0x0adf462, 0x0adfa69, 0x0adfd42, 0x0adff68, 0x0ae06f4, 0x0ae0969, 0x0ae0d6a, 0x0ae1100,
+    0x0ae1369, 0x0ae14fc, 0x0ae3878, 0x0ae3f42, 0x0ae4721, 0x0ae516e, 0x0ae534b, 0x0ae545c, 0x0ae594f, 0x0ae5a67,
+    0x0ae5cec, 0x0ae5f63, 0x0ae603c, 0x0ae677c, 0x0ae7299, 0x0ae7420, 0x0ae76f5, 0x0ae7c7d, 0x0ae817e, 0x0ae8407,
+    0x0ae8e8a, 0x0ae9451, 0x0ae980b, 0x0ae9b36, 0x0ae9c8d, 0x0ae9e77, 0x0aea190, 0x0aea292, 0x0aeae97, 0x0aeb47f,
+    0x0aeb736, 0x0aeb8a5, 0x0aeba05, 0x0aebd4f, 0x0aebe53, 0x0aec186, 0x0aec2f2, 0x0aec89b, 0x0aecd36, 0x0aed146,
+    0x0aed259, 0x0aed4f1, 0x0aed63f, 0x0aedad3, 0x0aedeec, 0x0aee604, 0x0aeecc8, 0x0aeee90, 0x0aef625, 0x0aef822,
+    0x0af042c, 0x0af069d, 0x0af08ae, 0x0af0aae, 0x0af0cb0, 0x0af1757, 0x0af1844, 0x0af24a3, 0x0af2658, 0x0af364a,
+    0x0af4164, 0x0af424f, 0x0af4461, 0x0af476a, 0x0af4841, 0x0af4c91, 0x0af4f1c, 0x0af524b, 0x0af563f, 0x0af5b5e,
+    0x0af5c96, 0x0af648c, 0x0af68ce, 0x0af716a, 0x0af845f, 0x0af8601, 0x0af96b7, 0x0af9c24, 0x0af9f1b, 0x0afa4aa,
+    0x0afa814, 0x0afaa24, 0x0afb122, 0x0afb35d, 0x0afb469, 0x0afbad4, 0x0afbf69, 0x0afc014, 0x0afc8ec, 0x0afda38,
+    0x0afde02, 0x0afe97e, 0x0aff163, 0x0aff2e9, 0x0aff47d, 0x0affb15, 0x0b00095, 0x0b00537, 0x0b00c48, 0x0b00e83,
+    0x0b016eb, 0x0b01b42, 0x0b022f7, 0x0b02a4a, 0x0b03364, 0x0b03c41, 0x0b04074, 0x0b04209, 0x0b0483e, 0x0b0548d,
+    0x0b0615f, 0x0b06a46, 0x0b088a4, 0x0b09934, 0x0b09a24, 0x0b0a32f, 0x0b0a934, 0x0b0b137, 0x0b0bd12, 0x0b0ca5c,
+    0x0b0d73c, 0x0b0d96a, 0x0b0fd24, 0x0b10025, 0x0b102b8, 0x0b10684, 0x0b10b24, 0x0b11367, 0x0b1251c, 0x0b126c8,
+    0x0b132f8, 0x0b134a8, 0x0b13d75, 0x0b13f5a, 0x0b150c6, 0x0b15249, 0x0b1787d, 0x0b1820d, 0x0b18b67, 0x0b1a26f,
+    0x0b1aa6e, 0x0b1c904, 0x0b1d722, 0x0b1d907, 0x0b1dd85, 0x0b1e121, 0x0b1e690, 0x0b1ec75, 0x0b1f363, 0x0b2057e,
+    0x0b20828, 0x0b20e0a, 0x0b21a56, 0x0b21f51, 0x0b2289a, 0x0b22b50, 0x0b22d48, 0x0b2332f, 0x0b2344a, 0x0b23962,
+    0x0b23e61, 0x0b24964, 0x0b24a7c, 0x0b24e37, 0x0b2533c, 0x0b25535, 0x0b25656, 0x0b25b61, 0x0b25d60, 0x0b25e6d,
+    0x0b26322, 0x0b26941, 0x0b26f63, 0x0b27096, 0x0b2727e, 0x0b2744a, 0x0b27899, 0x0b282a7, 0x0b28478, 0x0b2895f,
+    0x0b28ef5, 0x0b290cb, 0x0b29254, 0x0b29653, 0x0b29c9a, 0x0b29f8b, 0x0b2a2f5, 0x0b2a80b, 0x0b2ab63, 0x0b2ac80,
+    0x0b2af38, 0x0b2b170, 0x0b2b550, 0x0b2c03f, 0x0b2c51e, 0x0b2ca04, 0x0b2e6e0, 0x0b2e8dd, 0x0b2eccb, 0x0b2f07f,
+    0x0b2f334, 0x0b2fa6e, 0x0b3032b, 0x0b3050c, 0x0b30652, 0x0b3094a, 0x0b30d85, 0x0b30e56, 0x0b310b6, 0x0b31507,
+    0x0b31b5f, 0x0b32446, 0x0b3267d, 0x0b32d61, 0x0b32e83, 0x0b332c1, 0x0b33cda, 0x0b3460d, 0x0b34969, 0x0b34b46,
+    0x0b35051, 0x0b3534f, 0x0b35569, 0x0b35667, 0x0b35cd3, 0x0b35f80, 0x0b36437, 0x0b372bc, 0x0b376f5, 0x0b37cfa,
+    0x0b38cc8, 0x0b39589, 0x0b39722, 0x0b3a082, 0x0b3a262, 0x0b3a52c, 0x0b3a757, 0x0b3a94b, 0x0b3af1b, 0x0b3b0f0,
+    0x0b3b561, 0x0b3b880, 0x0b3bb24, 0x0b3c681, 0x0b3caa1, 0x0b3d163, 0x0b3d87d, 0x0b3f21d, 0x0b3f764, 0x0b3ff89,
+    0x0b4034b, 0x0b40747, 0x0b408af, 0x0b40b5e, 0x0b40d05, 0x0b40e81, 0x0b410b1, 0x0b412f1, 0x0b418a5, 0x0b42333,
+    0x0b4274b, 0x0b430d5, 0x0b438ca, 0x0b43e88, 0x0b44120, 0x0b4463e, 0x0b44a4b, 0x0b452c0, 0x0b46369, 0x0b46547,
+    0x0b46952, 0x0b46cff, 0x0b47820, 0x0b4804b, 0x0b48cf2, 0x0b49349, 0x0b4940f, 0x0b4aa82, 0x0b4b47b, 0x0b4c40d,
+    0x0b4ce84, 0x0b4d49f, 0x0b4e965, 0x0b4ea1f, 0x0b4ed20, 0x0b4ef3f, 0x0b4f54f, 0x0b4ff5a, 0x0b524bc, 0x0b534bc,
+    0x0b5376a, 0x0b55404, 0x0b564ec, 0x0b56750, 0x0b56b65, 0x0b57025, 0x0b57c61, 0x0b5827e, 0x0b58515, 0x0b5927d,
+    0x0b59952, 0x0b5a401, 0x0b5a8f0, 0x0b5acee, 0x0b5b0a3, 0x0b5b979, 0x0b5c0a5, 0x0b5c23e, 0x0b5c75f, 0x0b5cc20,
+    0x0b5d2d1, 0x0b5d6c6, 0x0b5e2f8, 0x0b61350, 0x0b62c0d, 0x0b62f1b, 0x0b664d6, 0x0b66965, 0x0b66eb6, 0x0b68128,
+    0x0b6a189, 0x0b6a282, 0x0b6a689, 0x0b6a893, 0x0b6ab6c, 0x0b6af89, 0x0b6b035, 0x0b6b332, 0x0b6b456, 0x0b6b60a,
+    0x0b6b989, 0x0b6bb54, 0x0b6bebe, 0x0b6c409, 0x0b6c67d, 0x0b6c862, 0x0b6cadd, 0x0b6cd5c, 0x0b6d26b, 0x0b6d4b1,
+    0x0b6d8ce, 0x0b6e124, 0x0b6e217, 0x0b6e789, 0x0b6ea56, 0x0b6f50c, 0x0b6fad7, 0x0b700c0, 0x0b702d9, 0x0b70734,
+    0x0b70867, 0x0b70b77, 0x0b70f69, 0x0b71123, 0x0b71202, 0x0b7172d, 0x0b71949, 0x0b71e73, 0x0b726bf, 0x0b72a3a,
+    0x0b72f8a, 0x0b73065, 0x0b73380, 0x0b73442, 0x0b73749, 0x0b73963, 0x0b73a09, 0x0b73d22, 0x0b74026, 0x0b74320,
+    0x0b74490, 0x0b7475b, 0x0b74922, 0x0b74b68, 0x0b74c78, 0x0b75552, 0x0b75660, 0x0b7616e, 0x0b7666b, 0x0b7695f,
+    0x0b76b54, 0x0b76c7e, 0x0b77023, 0x0b7730a, 0x0b77a98, 0x0b77c11, 0x0b77f2f, 0x0b7847d, 0x0b7887d, 0x0b78b64,
+    0x0b78cbf, 0x0b78e94, 0x0b79856, 0x0b7a0bc, 0x0b7a46c, 0x0b7a769, 0x0b7bafb, 0x0b7bcc6, 0x0b7be1d, 0x0b7c263,
+    0x0b7c94f, 0x0b7caa9, 0x0b7d177, 0x0b7dca9, 0x0b7e078, 0x0b7f035, 0x0b7f248, 0x0b7f52c, 0x0b7f75d, 0x0b7f83b,
+    0x0b7ff23, 0x0b80254, 0x0b8091e, 0x0b80c80, 0x0b8134b, 0x0b8158f, 0x0b81f54, 0x0b8231d, 0x0b8284e, 0x0b82a57,
+    0x0b82c7f, 0x0b83023, 0x0b8351c, 0x0b83857, 0x0b83a20, 0x0b84568, 0x0b84968, 0x0b84aa9, 0x0b84f61, 0x0b85857,
+    0x0b86286, 0x0b86859, 0x0b87122, 0x0b87364, 0x0b87425, 0x0b8768f, 0x0b878d3, 0x0b87a83, 0x0b87d4b, 0x0b87ed6,
+    0x0b88087, 0x0b882ec, 0x0b8841c, 0x0b88a87, 0x0b890ff, 0x0b8933b, 0x0b89482, 0x0b8974f, 0x0b89d22, 0x0b89ef1,
+    0x0b8a07d, 0x0b8a355, 0x0b8ab78, 0x0b8b24b, 0x0b8bd24, 0x0b8c142, 0x0b8c2b4, 0x0b8c750, 0x0b8cab4, 0x0b8cc87,
+    0x0b8dc22, 0x0b8df45, 0x0b8e31b, 0x0b8f363, 0x0b8f4f5, 0x0b8ff69, 0x0b90331, 0x0b904f5, 0x0b9115e, 0x0b9187d,
+    0x0b91af7, 0x0b920f5, 0x0b9221b, 0x0b9281d, 0x0b92cff, 0x0b92e5a, 0x0b93152, 0x0b93204, 0x0b9349f, 0x0b9363b,
+    0x0b93805, 0x0b94490, 0x0b94661, 0x0b9535f, 0x0b95759, 0x0b9587e, 0x0b95aac, 0x0b96238, 0x0b9676b, 0x0b96a75,
+    0x0b96ec3, 0x0b97002, 0x0b97a44, 0x0b97e9a, 0x0b982ba, 0x0b98963, 0x0b9975d, 0x0b9a444, 0x0b9b37e, 0x0b9c351,
+    0x0b9c881, 0x0b9cb7d, 0x0b9ccb1, 0x0b9d04b, 0x0b9d569, 0x0b9daf9, 0x0b9e054, 0x0b9f68a, 0x0ba04a1, 0x0ba069e,
+    0x0ba0c93, 0x0ba0e26, 0x0ba1cf5, 0x0ba2834, 0x0ba2d5e, 0x0ba3689, 0x0ba3c69, 0x0ba4954, 0x0ba4d5f, 0x0ba4f2d,
+    0x0ba520c, 0x0ba5b78, 0x0ba5c62, 0x0ba6948, 0x0ba7b6e, 0x0ba7d61, 0x0ba8e7d, 0x0ba9521, 0x0ba96bc, 0x0ba98f7,
+    0x0bab10a, 0x0bab769, 0x0babaaf, 0x0bad32d, 0x0bad789, 0x0bad94b, 0x0bade36, 0x0bae87d, 0x0bb0579, 0x0bb32ab,
+    0x0bb3a3d, 0x0bb6f63, 0x0bb8a3f, 0x0bb9b4b, 0x0bbb62a, 0x0bbba2a, 0x0bbbd80, 0x0bbc35d, 0x0bbc421, 0x0bbca60,
+    0x0bbcd90, 0x0bbcef9, 0x0bbd087, 0x0bbd260, 0x0bbd74f, 0x0bbdc1d, 0x0bbdefe, 0x0bbe27d, 0x0bbe563, 0x0bbe72c,
+    0x0bbe805, 0x0bbef53, 0x0bbfb5d, 0x0bbfc83, 0x0bc020d, 0x0bc0522, 0x0bc0614, 0x0bc0b26, 0x0bc0c50, 0x0bc1122,
+    0x0bc1950, 0x0bc1f4b, 0x0bc2179, 0x0bc2337, 0x0bc28e9, 0x0bc2ae4, 0x0bc2d3e, 0x0bc30a7, 0x0bc337e, 0x0bc3580,
+    0x0bc3613, 0x0bc397e, 0x0bc3a3e, 0x0bc4c38, 0x0bc4f7d, 0x0bc5b50, 0x0bc5c08, 0x0bc6227, 0x0bc6f4b, 0x0bc7020,
+    0x0bc7772, 0x0bc7869, 0x0bc7aba, 0x0bc84bf, 0x0bc894e, 0x0bc8a56, 0x0bc9879, 0x0bca8b8, 0x0bcaac8, 0x0bcb779,
+    0x0bcbc56, 0x0bcc250, 0x0bcc42b, 0x0bce459, 0x0bce6f1, 0x0bce8d4, 0x0bcec12, 0x0bcf157, 0x0bcf561, 0x0bcf678,
+    0x0bcf968, 0x0bcfb68, 0x0bcfe66, 0x0bd00ec, 0x0bd0985, 0x0bd0cfc, 0x0bd0e0d, 0x0bd142b, 0x0bd1667, 0x0bd1f5a,
+    0x0bd20b0, 0x0bd234f, 0x0bd2695, 0x0bd2965, 0x0bd2a3e, 0x0bd2ce8, 0x0bd2e3f, 0x0bd32c1, 0x0bd345f, 0x0bd3856,
+    0x0bd3ce7, 0x0bd3e52, 0x0bd4153, 0x0bd4b59, 0x0bd4c46, 0x0bd4f90, 0x0bd5b3f, 0x0bd660d, 0x0bd6a02, 0x0bd6d24,
+    0x0bd6e8e, 0x0bd7167, 0x0bd7346, 0x0bd7d69, 0x0bd92a7, 0x0bd94a0, 0x0bda283, 0x0bda404, 0x0bda69c, 0x0bdaca9,
+    0x0bdb61f, 0x0bdd155, 0x0bdd4ab, 0x0bde964, 0x0bded5f, 0x0bdef3f, 0x0bdf47f, 0x0bdfc60, 0x0bdfed4, 0x0be008c,
+    0x0be020e, 0x0be0563, 0x0be06f5, 0x0be08db, 0x0be1163, 0x0be140d, 0x0be1763, 0x0be1f22, 0x0be2322, 0x0be2660,
+    0x0be2b64, 0x0be2e56, 0x0be3073, 0x0be3625, 0x0be3e3e, 0x0be4179, 0x0be4abf, 0x0be4d52, 0x0be4e75, 0x0be52dd,
+    0x0be5484, 0x0be5abf, 0x0be5f49, 0x0be6310, 0x0be7239, 0x0be74f8, 0x0be780d, 0x0be8061, 0x0bea07d, 0x0bea467,
+    0x0bea63a, 0x0beaab0, 0x0bead43, 0x0beae7a, 0x0beb17e, 0x0bebb63, 0x0bec31b, 0x0bec557, 0x0bec940, 0x0becd5f,
+    0x0bed216, 0x0bed40f, 0x0bed811, 0x0bedaeb, 0x0bee179, 0x0bee365, 0x0bee625, 0x0beee51, 0x0bef363, 0x0bef622,
+    0x0bef80d, 0x0bf014a, 0x0bf037d, 0x0bf0432, 0x0bf0884, 0x0bf0a38, 0x0bf0f5d, 0x0bf1071, 0x0bf1360, 0x0bf1477,
+    0x0bf16b4, 0x0bf1874, 0x0bf215a, 0x0bf2542, 0x0bf2a9e, 0x0bf2e3c, 0x0bf30e5, 0x0bf3350, 0x0bf3820, 0x0bf4369,
+    0x0bf5079, 0x0bf555d, 0x0bf5b61, 0x0bf5d4b, 0x0bf6b7e, 0x0bf6e3c, 0x0bf7881, 0x0bf7a7a, 0x0bf8756, 0x0bf8956,
+    0x0bf8a0d, 0x0bf8d63, 0x0bf923b, 0x0bf987d, 0x0bf9b07, 0x0bf9e1f, 0x0bfa136, 0x0bfa339, 0x0bfa539, 0x0bfac35,
+    0x0bfaf7e, 0x0bfb14a, 0x0bfb2b9, 0x0bfbb3c, 0x0bfc17f, 0x0bfc226, 0x0bfc94f, 0x0bfcf68, 0x0bfd52d, 0x0bfd697,
+    0x0bfda0e, 0x0bfdd7e, 0x0bfe223, 0x0bfead4, 0x0bff0da, 0x0bff756, 0x0bffa75, 0x0bffc8c, 0x0bffe53, 0x0c00077,
+    0x0c00335, 0x0c0052d, 0x0c0074f, 0x0c008e3, 0x0c00a20, 0x0c00c2b, 0x0c01421, 0x0c01b90, 0x0c01d74, 0x0c01f60,
+    0x0c024dd, 0x0c0297d, 0x0c02ae4, 0x0c02c14, 0x0c03275, 0x0c03637, 0x0c038a7, 0x0c03b2c, 0x0c04038, 0x0c04363,
+    0x0c04a7d, 0x0c04ceb, 0x0c04f57, 0x0c0516a, 0x0c052d3, 0x0c05464, 0x0c05656, 0x0c05efa, 0x0c06a28, 0x0c0778a,
+    0x0c07848, 0x0c07f63, 0x0c082d1, 0x0c0855d, 0x0c08722, 0x0c096a7, 0x0c09a79, 0x0c0a093, 0x0c0a472, 0x0c0ab24,
+    0x0c0b360, 0x0c0b47a, 0x0c0ba7e, 0x0c0c47a, 0x0c0c789, 0x0c0c95a, 0x0c0cee0, 0x0c0d071, 0x0c0d24d, 0x0c0d490,
+    0x0c0d644, 0x0c0d93c, 0x0c0da60, 0x0c0df50, 0x0c0e0f6, 0x0c0e691, 0x0c0ec4b, 0x0c0f140, 0x0c0f35f, 0x0c0f48c,
+    0x0c0f61a, 0x0c0f8ce, 0x0c0fb6c, 0x0c0ff67, 0x0c1069b, 0x0c108f9, 0x0c11350, 0x0c1193b, 0x0c11a6c, 0x0c12563,
+    0x0c1287a, 0x0c12c0a, 0x0c1352d, 0x0c13700, 0x0c13a9a, 0x0c13f4f, 0x0c14168, 0x0c14678, 0x0c14d6b, 0x0c150d8,
+    0x0c15701, 0x0c1595b, 0x0c15af7, 0x0c15ec3, 0x0c16252, 0x0c1640a, 0x0c16834, 0x0c1707d, 0x0c17757, 0x0c1783b,
+    0x0c18afc, 0x0c18c27, 0x0c19484, 0x0c19749, 0x0c1a27c, 0x0c1ab3b, 0x0c1b14a, 0x0c1b475, 0x0c1b950, 0x0c1ba20,
+    0x0c1bf4b, 0x0c1c07a, 0x0c1cc3f, 0x0c1ce87, 0x0c1d017, 0x0c1d224, 0x0c1d60a, 0x0c1d8fa, 0x0c1da17, 0x0c1dc39,
+    0x0c1de65, 0x0c1e04a, 0x0c1e753, 0x0c1e986, 0x0c1ec79, 0x0c1f306, 0x0c1f557, 0x0c200f9, 0x0c20227, 0x0c20cf7,
+    0x0c21169, 0x0c21369, 0x0c21ac3, 0x0c21c0d, 0x0c21f63, 0x0c22a4b, 0x0c23569, 0x0c23e59, 0x0c2416c, 0x0c246a4,
+    0x0c24853, 0x0c24c9a, 0x0c24e9a, 0x0c2572f, 0x0c27f6a, 0x0c2902f, 0x0c294f7, 0x0c29879, 0x0c29d20, 0x0c2a31e,
+    0x0c2aac8, 0x0c2bb39, 0x0c2c4b8, 0x0c2ce7a, 0x0c2d08c, 0x0c2e14b, 0x0c2eb67, 0x0c2ee8e, 0x0c31610, 0x0c31d75,
+    0x0c328f9, 0x0c33a48, 0x0c34e26, 0x0c3506c, 0x0c352f5, 0x0c35884, 0x0c36e28, 0x0c37c6c, 0x0c38444, 0x0c39155,
+    0x0c39404, 0x0c396ba, 0x0c3a2bd, 0x0c3a49f, 0x0c3a8ab, 0x0c3ccdf, 0x0c3eabe, 0x0c3ff63, 0x0c40c5a, 0x0c4105c,
+    0x0c4154f, 0x0c4167f, 0x0c4195a, 0x0c41b24, 0x0c41d0a, 0x0c41f50, 0x0c42024, 0x0c4234e, 0x0c42482, 0x0c42af8,
+    0x0c42c7c, 0x0c42ef8, 0x0c43178, 0x0c434f5, 0x0c4367e, 0x0c43e7d, 0x0c4428d, 0x0c4447d, 0x0c44858, 0x0c44a3d,
+    0x0c45482, 0x0c4587f, 0x0c45cb0, 0x0c4662e, 0x0c46838, 0x0c46e75, 0x0c47a75, 0x0c47ca5, 0x0c47e51, 0x0c48133,
+    0x0c4820e, 0x0c48685, 0x0c48f1b, 0x0c49075, 0x0c49252, 0x0c49723, 0x0c49923, 0x0c49a16, 0x0c49d76, 0x0c4a2f4,
+    0x0c4a405, 0x0c4a637, 0x0c4a908, 0x0c4b146, 0x0c4b68e, 0x0c4c694, 0x0c4ccf7, 0x0c4cf7e, 0x0c4d29c, 0x0c4d4bd,
+    0x0c4d715, 0x0c4d960, 0x0c4dada, 0x0c4dc07, 0x0c4de22, 0x0c4e105, 0x0c4e607, 0x0c4ec56, 0x0c4f2ec, 0x0c4f84b,
+    0x0c4fd7a, 0x0c4fe24, 0x0c5007d, 0x0c50821, 0x0c51289, 0x0c51405, 0x0c52363, 0x0c52524, 0x0c52782, 0x0c52b41,
+    0x0c52c45, 0x0c52e8e, 0x0c5317b, 0x0c53456, 0x0c536e8, 0x0c53f43, 0x0c54094, 0x0c542b2, 0x0c544f8, 0x0c54875,
+    0x0c54a09, 0x0c550eb, 0x0c556ec, 0x0c55935, 0x0c56209, 0x0c56a3e, 0x0c572c6, 0x0c57623, 0x0c5795e, 0x0c57a27,
+    0x0c57ec3, 0x0c58456, 0x0c58981, 0x0c58a39, 0x0c58c1e, 0x0c58ec8, 0x0c590d4, 0x0c5929d, 0x0c59456, 0x0c59807,
+    0x0c59ae5, 0x0c59cab, 0x0c5a064, 0x0c5a487, 0x0c5a734, 0x0c5a805, 0x0c5ad46, 0x0c5ae04, 0x0c5b087, 0x0c5b388,
+    0x0c5b4e6, 0x0c5b77a, 0x0c5b806, 0x0c5bed3, 0x0c5c4ae, 0x0c5c67f, 0x0c5cb67, 0x0c5cc9f, 0x0c5ced9, 0x0c5d013,
+    0x0c5d372, 0x0c5d89c, 0x0c5db22, 0x0c5dc82, 0x0c5df7d, 0x0c5e260, 0x0c5e700, 0x0c5e927, 0x0c5ed6d, 0x0c5ee8f,
+    0x0c5f8f0, 0x0c5fb83, 0x0c5fd22, 0x0c5feca, 0x0c60225, 0x0c60463, 0x0c60f7e, 0x0c610fa, 0x0c61202, 0x0c61c96,
+    0x0c6233d, 0x0c62d47, 0x0c6357e, 0x0c636b1, 0x0c63b4e, 0x0c63d34, 0x0c63f55, 0x0c640ce, 0x0c6423a, 0x0c64481,
+    0x0c6477d, 0x0c6487d, 0x0c64a7a, 0x0c65001, 0x0c654df, 0x0c65636, 0x0c65f7c, 0x0c66511, 0x0c67363, 0x0c6753f,
+    0x0c67b49, 0x0c6854f, 0x0c6868a, 0x0c68b40, 0x0c68c9b, 0x0c69388, 0x0c696b4, 0x0c69805, 0x0c69a6c, 0x0c69d1d,
+    0x0c69ed7, 0x0c6a088, 0x0c6aa14, 0x0c6bca1, 0x0c6bf32, 0x0c6c27f, 0x0c6c478, 0x0c6c63b, 0x0c6ceeb, 0x0c6d2aa,
+    0x0c6da06, 0x0c6dc87, 0x0c6e201, 0x0c6ec2c, 0x0c6ee82, 0x0c6f4ca, 0x0c6f6d4, 0x0c70152, 0x0c7043f, 0x0c70e4a,
+    0x0c71123, 0x0c71240, 0x0c714f3, 0x0c71979, 0x0c71c7d, 0x0c71f38, 0x0c720f6, 0x0c724e5, 0x0c72d62, 0x0c73089,
+    0x0c740b5, 0x0c74536, 0x0c74622, 0x0c74a82, 0x0c74e93, 0x0c75144, 0x0c7535f, 0x0c75436, 0x0c75887, 0x0c75b3c,
+    0x0c75cf7, 0x0c76006, 0x0c766b0, 0x0c76864, 0x0c76f7e, 0x0c77039, 0x0c77417, 0x0c77865, 0x0c77d6a, 0x0c78969,
+    0x0c78c9a, 0x0c7930b, 0x0c79b8b, 0x0c79d5b, 0x0c79ec1, 0x0c7a13b, 0x0c7a41d, 0x0c7ad63, 0x0c7bc02, 0x0c7c15e,
+    0x0c7c34e, 0x0c7c629, 0x0c7d28c, 0x0c7d486, 0x0c7da82, 0x0c7e441, 0x0c7e96a, 0x0c7ed62, 0x0c7f176, 0x0c7fa9f,
+    0x0c7fefb, 0x0c8001f, 0x0c8025c, 0x0c804af, 0x0c80a81, 0x0c81629, 0x0c81978, 0x0c81e13, 0x0c82028, 0x0c82636,
+    0x0c82915, 0x0c8367f, 0x0c8392e, 0x0c83c5b, 0x0c8412b, 0x0c84314, 0x0c84cdf, 0x0c85537, 0x0c85807, 0x0c85a37,
+    0x0c868f7, 0x0c87555, 0x0c87a1d, 0x0c87e5c, 0x0c8824d, 0x0c8891e, 0x0c88b24, 0x0c88c06, 0x0c88f61, 0x0c89011,
+    0x0c89536, 0x0c8a412, 0x0c8a926, 0x0c8b177, 0x0c8bcb3, 0x0c8ce34, 0x0c8d2c6, 0x0c8db7e, 0x0c8f0c6, 0x0c8f2c6,
+    0x0c8f57b, 0x0c904a9, 0x0c90965, 0x0c90a89, 0x0c90eef, 0x0c92224, 0x0c92511, 0x0c92b2c, 0x0c92c6c, 0x0c9338f,
+    0x0c93d85, 0x0c94822, 0x0c952a9, 0x0c958f9, 0x0c95a13, 0x0c95c36, 0x0c96184, 0x0c96ad4, 0x0c96f55, 0x0c970b0,
+    0x0c97433, 0x0c9786c, 0x0c98059, 0x0c984a3, 0x0c98b1b, 0x0c99a19, 0x0c99cfc, 0x0c9a078, 0x0c9a4fb, 0x0c9aeec,
+    0x0c9b006, 0x0c9bd2e, 0x0c9c588, 0x0c9c957, 0x0c9cc15, 0x0ca00e6, 0x0ca127c, 0x0ca256f, 0x0ca3104, 0x0ca4b8d,
+    0x0ca5689, 0x0ca5ccd, 0x0ca5f7e, 0x0ca68f4, 0x0ca6af4, 0x0ca6d23, 0x0ca7168, 0x0ca7258, 0x0ca7660, 0x0ca7c51,
+    0x0ca7f7d, 0x0ca8a62, 0x0ca9154, 0x0ca92bf, 0x0ca983e, 0x0ca9ec3, 0x0caa286, 0x0caaa25, 0x0caac04, 0x0cab281,
+    0x0cab6a7, 0x0caba0d, 0x0cabc20, 0x0cac459, 0x0cac713, 0x0cacc49, 0x0cad681, 0x0cad884, 0x0cae124, 0x0cae4f9,
+    0x0cae97d, 0x0caee56, 0x0cb0f4c, 0x0cb1777, 0x0cb1811, 0x0cb2052, 0x0cb2207, 0x0cb269f, 0x0cb2e45, 0x0cb32a9,
+    0x0cb3675, 0x0cb3955, 0x0cb3f7c, 0x0cb434e, 0x0cb4883, 0x0cb4a25, 0x0cb4e56, 0x0cb5378, 0x0cb5788, 0x0cb5a47,
+    0x0cb5f2c, 0x0cb6156, 0x0cb7251, 0x0cb7969, 0x0cb7b22, 0x0cb82e7, 0x0cb8778, 0x0cb88ba, 0x0cb8ab4, 0x0cb8ce9,
+    0x0cb975b, 0x0cb9884, 0x0cb9cd3, 0x0cb9f8c, 0x0cba4ad, 0x0cbad63, 0x0cbaef5, 0x0cbc14f, 0x0cbc47d, 0x0cbcb09,
+    0x0cbcc39, 0x0cbce86, 0x0cbd17e, 0x0cbd371, 0x0cbd95d, 0x0cbdb5a, 0x0cbdc57, 0x0cbde9d, 0x0cbe059, 0x0cbe26c,
+    0x0cbed22, 0x0cbee99, 0x0cbf54a, 0x0cc016c, 0x0cc0403, 0x0cc0772, 0x0cc0c9b, 0x0cc146e, 0x0cc1820, 0x0cc1cc4,
+    0x0cc1e7b, 0x0cc2763, 0x0cc2950, 0x0cc2b56, 0x0cc3336, 0x0cc3b6f, 0x0cc3f57, 0x0cc4165, 0x0cc4a2d, 0x0cc4ebc,
+    0x0cc5190, 0x0cc5b7a, 0x0cc5f22, 0x0cc6369, 0x0cc68ba, 0x0cc6ad3, 0x0cc6c20, 0x0cc7980, 0x0cc7d52, 0x0cc8221,
+    0x0cc8679, 0x0cc9683, 0x0cc991c, 0x0cc9f5f, 0x0cca51a, 0x0cca754, 0x0cca962, 0x0ccab6c, 0x0ccac7a, 0x0ccae6c,
+    0x0ccb549, 0x0ccbe24, 0x0ccc214, 0x0ccc94f, 0x0cccc7a, 0x0ccd023, 0x0ccdcf4, 0x0ccde84, 0x0cce150, 0x0cce8fc,
+    0x0ccec84, 0x0ccee67, 0x0ccf57e, 0x0ccfca8, 0x0cd056f, 0x0cd095b, 0x0cd0f51, 0x0cd189a, 0x0cd2324, 0x0cd2cde,
+    0x0cd2e02, 0x0cd3ac4, 0x0cd4e01, 0x0cd507d, 0x0cd5cc8, 0x0cd6809, 0x0cd7352, 0x0cd7d45, 0x0cdb324, 0x0cdb75d,
+    0x0cdb961, 0x0cdbaf4, 0x0cdcd50, 0x0cdd2cd, 0x0cde16b, 0x0cde4ff, 0x0cde762, 0x0cde85f, 0x0cdee6f, 0x0cdf219,
+    0x0cdf8b8, 0x0cdfc1c, 0x0cdff3b, 0x0ce018e, 0x0ce116b, 0x0ce1368, 0x0ce150d, 0x0ce16eb, 0x0ce1a56, 0x0ce20ff,
+    0x0ce292b, 0x0ce2b7c, 0x0ce2ea0, 0x0ce374a, 0x0ce3a21, 0x0ce3ef5, 0x0ce4cbe, 0x0ce50c8, 0x0ce554b, 0x0ce56c6,
+    0x0ce580b, 0x0ce5b76, 0x0ce5f24, 0x0ce6381, 0x0ce68f4, 0x0ce6a4a, 0x0ce747d, 0x0ce7b59, 0x0ce8119, 0x0ce856d,
+    0x0ce8700, 0x0ce8c59, 0x0ce901d, 0x0ce931b, 0x0ce994f, 0x0ce9ca5, 0x0ce9f57, 0x0cea016, 0x0cea235, 0x0cea60f,
+    0x0cead79, 0x0ceb846, 0x0cebcf5, 0x0cebf24, 0x0cec05a, 0x0cec33d, 0x0ceca9e, 0x0ced160, 0x0ced2b6, 0x0ced4c1,
+    0x0ceda6d, 0x0cede0a, 0x0cee082, 0x0cee45b, 0x0cee761, 0x0ceea28, 0x0ceeee4, 0x0cef981, 0x0cefd2d, 0x0cefe07,
+    0x0cf027d, 0x0cf0861, 0x0cf0eec, 0x0cf134a, 0x0cf1651, 0x0cf2150, 0x0cf2b7c, 0x0cf2eab, 0x0cf310e, 0x0cf34bc,
+    0x0cf3869, 0x0cf3b7e, 0x0cf3c30, 0x0cf4524, 0x0cf4771, 0x0cf4aa5, 0x0cf4e7f, 0x0cf5024, 0x0cf54f8, 0x0cf5654,
+    0x0cf5b54, 0x0cf5e95, 0x0cf60f1, 0x0cf677e, 0x0cf6b54, 0x0cf6c7e, 0x0cf6e7e, 0x0cf7061, 0x0cf824a, 0x0cf86ac,
+    0x0cf8812, 0x0cf9e06, 0x0cfa0c7, 0x0cfa259, 0x0cfa4f5, 0x0cfa703, 0x0cfa90b, 0x0cfb17b, 0x0cfb351, 0x0cfb568,
+    0x0cfb867, 0x0cfbb46, 0x0cfbd76, 0x0cfc0d9, 0x0cfc43e, 0x0cfca1d, 0x0cfd286, 0x0cfd87f, 0x0cfde90, 0x0cfe0cb,
+    0x0cfe381, 0x0cfe6ad, 0x0cfe81e, 0x0cffa24, 0x0cfff22, 0x0d0017e, 0x0d00b76, 0x0d00e0f, 0x0d01178, 0x0d0137e,
+    0x0d014ae, 0x0d01644, 0x0d018b0, 0x0d01ca5, 0x0d01e9f, 0x0d02324, 0x0d02727, 0x0d02cf5, 0x0d02ea5, 0x0d03a63,
+    0x0d04354, 0x0d0535a, 0x0d05581, 0x0d0648f, 0x0d066a1, 0x0d06f60, 0x0d0706f, 0x0d0725e, 0x0d0785c, 0x0d07b6e,
+    0x0d07cb1, 0x0d08082, 0x0d08272, 0x0d08467, 0x0d08738, 0x0d08866, 0x0d08b4b, 0x0d08c99, 0x0d09002, 0x0d09202,
+    0x0d09488, 0x0d09988, 0x0d09d7e, 0x0d0a140, 0x0d0a314, 0x0d0a678, 0x0d0a887, 0x0d0aa86, 0x0d0c15e, 0x0d0c305,
+    0x0d0c57c, 0x0d0c63a, 0x0d0c8f5, 0x0d0caf9, 0x0d0cc76, 0x0d0ce67, 0x0d0d080, 0x0d0d385, 0x0d0d733, 0x0d0e856,
+    0x0d0ed40, 0x0d0ee89, 0x0d102a8, 0x0d1073f, 0x0d10abc, 0x0d10c08, 0x0d11e62, 0x0d12789, 0x0d12e5f, 0x0d1451d,
+    0x0d14cbe, 0x0d14f4f, 0x0d150a5, 0x0d15b33, 0x0d15f3b, 0x0d16155, 0x0d16724, 0x0d16a50, 0x0d1807f, 0x0d184ac,
+    0x0d192c0, 0x0d196f5, 0x0d19a68, 0x0d1a408, 0x0d1ab8a, 0x0d1b07d, 0x0d1b4eb, 0x0d1c137, 0x0d1c63e, 0x0d1dd17,
+    0x0d1e02c, 0x0d1e2a4, 0x0d1ea90, 0x0d1f37a, 0x0d1f465, 0x0d1f853, 0x0d20269, 0x0d20b63, 0x0d216a8, 0x0d21b7e,
+    0x0d21c2c, 0x0d22087, 0x0d22481, 0x0d23e46, 0x0d240f7, 0x0d248b3, 0x0d25b46, 0x0d26162, 0x0d26847, 0x0d27320,
+    0x0d27a2a, 0x0d27e2d, 0x0d28576, 0x0d2a955, 0x0d2ae7f, 0x0d2b428, 0x0d2baa7, 0x0d2bca4, 0x0d2c0cc, 0x0d2c6bc,
+    0x0d2cd5b, 0x0d2d67d, 0x0d2dc28, 0x0d2e38b, 0x0d2ee8c, 0x0d2f0fe, 0x0d2f365, 0x0d2f8af, 0x0d300f0, 0x0d30458,
+    0x0d3089f, 0x0d30d69, 0x0d30e23, 0x0d310b4, 0x0d31287, 0x0d31b55, 0x0d328a0, 0x0d32b0a, 0x0d33087, 0x0d3377c,
+    0x0d33808, 0x0d34e52, 0x0d35176, 0x0d35732, 0x0d35b55, 0x0d36234, 0x0d368ad, 0x0d36f01, 0x0d37734, 0x0d3825b,
+    0x0d3952b, 0x0d3982c, 0x0d39c1d, 0x0d3a077, 0x0d3a85b, 0x0d3b68d, 0x0d3be11, 0x0d3c181, 0x0d3daf5, 0x0d3e475,
+    0x0d3fa19, 0x0d3fe83, 0x0d41450, 0x0d42e28, 0x0d43137, 0x0d43f79, 0x0d442c6, 0x0d45150, 0x0d45472, 0x0d45ef8,
+    0x0d46365, 0x0d46af9, 0x0d47b8f, 0x0d47d6b, 0x0d48859, 0x0d48ef9, 0x0d4a146, 0x0d4b087, 0x0d4b224, 0x0d4b689,
+    0x0d4c353, 0x0d4cb81, 0x0d4e228, 0x0d4f2b0, 0x0d4f96a, 0x0d50136, 0x0d50950, 0x0d51cfb, 0x0d5215f, 0x0d522a3,
+    0x0d52e13, 0x0d540fc, 0x0d552ab, 0x0d5561d, 0x0d558be, 0x0d640f7, 0x0d6422f, 0x0d64478, 0x0d64756, 0x0d64969,
+    0x0d64ee3, 0x0d66569, 0x0d66f50, 0x0d67363, 0x0d674f5, 0x0d67c98, 0x0d68719, 0x0d68d56, 0x0d68f55, 0x0d692f7,
+    0x0d6985c, 0x0d6b31e, 0x0d6c57e, 0x0d6c77d, 0x0d6c82f, 0x0d6ca14, 0x0d6cd4f, 0x0d6cef5, 0x0d6d548, 0x0d6f238,
+    0x0d6f72c, 0x0d6f87f, 0x0d702c6, 0x0d70432, 0x0d70760, 0x0d7093c, 0x0d70c38, 0x0d70f1c, 0x0d7135d, 0x0d71524,
+    0x0d71617, 0x0d71aee, 0x0d7256c, 0x0d726a7, 0x0d72d7e, 0x0d73439, 0x0d7367d, 0x0d74211, 0x0d75563, 0x0d76724,
+    0x0d768e3, 0x0d76a47, 0x0d76f64, 0x0d77e3f, 0x0d7827a, 0x0d78462, 0x0d78b63, 0x0d7974f, 0x0d79ac8, 0x0d79ebc,
+    0x0d7a446, 0x0d7a769, 0x0d7a80d, 0x0d7aa0d, 0x0d7ac0d, 0x0d7aeec, 0x0d7b20d, 0x0d7b6ba, 0x0d7c378, 0x0d7d4c8,
+    0x0d7d66e, 0x0d7df36, 0x0d7e634, 0x0d7eb13, 0x0d7f324, 0x0d7fa7f, 0x0d80a20, 0x0d80cf4, 0x0d80eb0, 0x0d81aff,
+    0x0d81f22, 0x0d8203e, 0x0d822c3, 0x0d826b9, 0x0d828f5, 0x0d82aef, 0x0d82ccb, 0x0d8303b, 0x0d83352, 0x0d8342a,
+    0x0d83653, 0x0d83e56, 0x0d84244, 0x0d844fc, 0x0d84964, 0x0d84c6b, 0x0d84f60, 0x0d85002, 0x0d8535e, 0x0d85490,
+    0x0d85c39, 0x0d85eb4, 0x0d860fc, 0x0d8656c, 0x0d86929, 0x0d86b29, 0x0d87167, 0x0d87b45, 0x0d8813f, 0x0d8837e,
+    0x0d884fe, 0x0d88c33, 0x0d88e7a, 0x0d8926c, 0x0d8941d, 0x0d8a150, 0x0d8a8f5, 0x0d8ab1b, 0x0d8ae6c, 0x0d8b75d,
+    0x0d8b92c, 0x0d8bb0c, 0x0d8bc60, 0x0d8be80, 0x0d8c025, 0x0d8c34f, 0x0d8c937, 0x0d8d0bf, 0x0d8d262, 0x0d8d54a,
+    0x0d8e135, 0x0d8e47d, 0x0d8e80e, 0x0d8ed4c, 0x0d8f358, 0x0d8faf5, 0x0d8fc53, 0x0d902fb, 0x0d90563, 0x0d9074e,
+    0x0d90b6a, 0x0d90c6d, 0x0d91120, 0x0d91223, 0x0d91849, 0x0d91ef5, 0x0d920c8, 0x0d92637, 0x0d928c0, 0x0d93319,
+    0x0d936e9, 0x0d93e61, 0x0d942bc, 0x0d94654, 0x0d948e3, 0x0d94aa5, 0x0d94cb2, 0x0d94e18, 0x0d9534b, 0x0d95475,
+    0x0d956c6, 0x0d95b24, 0x0d95c87, 0x0d96346, 0x0d96546, 0x0d9666f, 0x0d97052, 0x0d97368, 0x0d9777e, 0x0d9797a,
+    0x0d97a62, 0x0d97d78, 0x0d97f5f, 0x0d98955, 0x0d98afe, 0x0d99300, 0x0d994f2, 0x0d998bf, 0x0d9a0a2, 0x0d9a673,
+    0x0d9a859, 0x0d9aa4f, 0x0d9acba, 0x0d9af2c, 0x0d9b650, 0x0d9bcd9, 0x0d9c0ac, 0x0d9c2e8, 0x0d9c413, 0x0d9c6f5,
+    0x0d9cad3, 0x0d9d181, 0x0d9d4a3, 0x0d9d75b, 0x0d9dce6, 0x0d9dec3, 0x0d9e135, 0x0d9e360, 0x0d9e767, 0x0d9ea0c,
+    0x0d9ed5c, 0x0d9eeae, 0x0d9f0b0, 0x0d9f4b3, 0x0d9f755, 0x0d9f8f2, 0x0d9fb72, 0x0d9fc84, 0x0da0282, 0x0da087a,
+    0x0da0f64, 0x0da1760, 0x0da18aa, 0x0da1c7d, 0x0da2511, 0x0da2f50, 0x0da3381, 0x0da3480, 0x0da36b3, 0x0da3c44,
+    0x0da4a83, 0x0da4f4b, 0x0da5473, 0x0da575a, 0x0da5d38, 0x0da624e, 0x0da6580, 0x0da670c, 0x0da6b5d, 0x0da7278,
+    0x0da767c, 0x0da7947, 0x0da7af6, 0x0da7ce5, 0x0da82ad, 0x0da867e, 0x0da8af7, 0x0da8c80, 0x0da8e81, 0x0da917c,
+    0x0da9588, 0x0da961a, 0x0da9a7a, 0x0da9c7d, 0x0da9ead, 0x0daa27b, 0x0daa475, 0x0daa6db, 0x0daa95d, 0x0dab37b,
+    0x0dab48a, 0x0dab808, 0x0dabd88, 0x0dac150, 0x0dac678, 0x0daccf4, 0x0dad26e, 0x0dad4a0, 0x0dadc56, 0x0dadf4f,
+    0x0dae969, 0x0daee6b, 0x0daf083, 0x0daf8bc, 0x0db0542, 0x0db0ad7, 0x0db1154, 0x0db131e, 0x0db1967, 0x0db1d52,
+    0x0db232f, 0x0db2688, 0x0db281b, 0x0db2b3b, 0x0db3738, 0x0db3aa1, 0x0db3c9e, 0x0db3ea7, 0x0db414b, 0x0db434e,
+    0x0db4678, 0x0db483e, 0x0db4d0f, 0x0db4e7f, 0x0db5179, 0x0db5316, 0x0db5456, 0x0db5665, 0x0db5d27, 0x0db5f5e,
+    0x0db6562, 0x0db6a6c, 0x0db706f, 0x0db7f88, 0x0db803f, 0x0db8989, 0x0db8b50, 0x0db8d54, 0x0db8ef5, 0x0db96ab,
+    0x0db9937, 0x0dba324, 0x0dbacce, 0x0dbb138, 0x0dbb230, 0x0dbba52, 0x0dbbd2d, 0x0dbc0ec, 0x0dbc239, 0x0dbc969,
+    0x0dbcc59, 0x0dbd764, 0x0dbd834, 0x0dbdc77, 0x0dbe320, 0x0dbe62d, 0x0dbee7b, 0x0dbf35f, 0x0dbf73c, 0x0dbf8c1,
+    0x0dc0afc, 0x0dc156a, 0x0dc18b0, 0x0dc1b89, 0x0dc1c46, 0x0dc207f, 0x0dc22c0, 0x0dc2969, 0x0dc2d20, 0x0dc2f20,
+    0x0dc3581, 0x0dc3b69, 0x0dc40ff, 0x0dc4246, 0x0dc4776, 0x0dc4813, 0x0dc4b4e, 0x0dc534c, 0x0dc5755, 0x0dc5b4b,
+    0x0dc5e5a, 0x0dc655b, 0x0dc6890, 0x0dc7168, 0x0dc74c1, 0x0dc86e5, 0x0dc88bc, 0x0dc9b43, 0x0dc9cc0, 0x0dca6ea,
+    0x0dca87f, 0x0dcac75, 0x0dcb153, 0x0dcb778, 0x0dcbe79, 0x0dcd681, 0x0dcdd5f, 0x0dcfd49, 0x0dcff22, 0x0dd069a,
+    0x0dd0a7f, 0x0dd0d5a, 0x0dd1258, 0x0dd1f37, 0x0dd216a, 0x0dd3090, 0x0dd38ad, 0x0dd3ec4, 0x0dd4563, 0x0dd4af4,
+    0x0dd4ea5, 0x0dd5550, 0x0dd5f2f, 0x0dd62fb, 0x0dd652e, 0x0dd6959, 0x0dd6d0a, 0x0dd6e7b, 0x0dd74d3, 0x0dd7734,
+    0x0dd7b0c, 0x0dd8228, 0x0dd84e7, 0x0dd8e3f, 0x0dd9789, 0x0dd9e56, 0x0dda276, 0x0dda789, 0x0dda938, 0x0ddab3a,
+    0x0ddae0d, 0x0ddb468, 0x0ddbd7e, 0x0ddbf5f, 0x0ddc11e, 0x0ddc2b8, 0x0ddc565, 0x0ddc8b4, 0x0ddca9f, 0x0ddccb1,
+    0x0ddd011, 0x0ddd336, 0x0dde83e, 0x0ddf275, 0x0de04ee, 0x0de0cf5, 0x0de12b0, 0x0de1eaf, 0x0de26a5, 0x0de295f,
+    0x0de2a19, 0x0de40c6, 0x0de489f, 0x0de535b, 0x0de5563, 0x0de56b8, 0x0de5ab9, 0x0de5eb3, 0x0de6324, 0x0de6779,
+    0x0de6c78, 0x0de7d60, 0x0de8d65, 0x0de8f54, 0x0de96a7, 0x0de9b4b, 0x0deb0e6, 0x0deb8f7, 0x0debcb0, 0x0dec479,
+    0x0decca1, 0x0dedb36, 0x0dedc21, 0x0dee51d, 0x0dee981, 0x0def11b, 0x0def41f, 0x0def940, 0x0df0824, 0x0df1022,
+    0x0df1259, 0x0df192c, 0x0df1b24, 0x0df1ceb, 0x0df389f, 0x0df4371, 0x0df4ea5, 0x0df6604, 0x0df6c1f, 0x0df7239,
+    0x0df807d, 0x0df84a7, 0x0df9331, 0x0dfa29e, 0x0dfa411, 0x0dfbc0d, 0x0dfc06e, 0x0dfc30c, 0x0dfdcf4, 0x0dfdf88,
+    0x0e022f4, 0x0e0346c, 0x0e03765, 0x0e04755, 0x0e06a53, 0x0e0736b, 0x0e09865, 0x0e09e6e, 0x0e0bc05, 0x0e0d67c,
+    0x0e0d80f, 0x0e0dac2, 0x0e0de3d, 0x0e0e07a, 0x0e0eaac, 0x0e0ed71, 0x0e0f086, 0x0e0f988, 0x0e0fd6e, 0x0e0fe17,
+    0x0e10160, 0x0e10a85, 0x0e112b0, 0x0e1142c, 0x0e11d5f, 0x0e12421, 0x0e12867, 0x0e12a8e, 0x0e12c49, 0x0e1337e,
+    0x0e1394b, 0x0e13af8, 0x0e1575b, 0x0e15887, 0x0e15b36, 0x0e15ce8, 0x0e15e85, 0x0e16335, 0x0e16612, 0x0e16f81,
+    0x0e17176, 0x0e1723f, 0x0e17722, 0x0e178a7, 0x0e17a25, 0x0e18075, 0x0e1832b, 0x0e1849f, 0x0e1873f, 0x0e190aa,
+    0x0e19560, 0x0e1b073, 0x0e1b2a1, 0x0e1b781, 0x0e1bf5f, 0x0e1c88f, 0x0e1cc50, 0x0e1cf1d, 0x0e1d162, 0x0e1d27a,
+    0x0e1d737, 0x0e1d883, 0x0e1db06, 0x0e1df50, 0x0e1ef49, 0x0e1f2eb, 0x0e1fa54, 0x0e2135f, 0x0e2146c, 0x0e2214f,
+    0x0e2266c, 0x0e22a78, 0x0e22cbd, 0x0e2303b, 0x0e2320a, 0x0e23453, 0x0e24c81, 0x0e25e21, 0x0e2615f, 0x0e2635f,
+    0x0e26d03, 0x0e28a47, 0x0e2955b, 0x0e29879, 0x0e29c7f, 0x0e2b969, 0x0e2bd19, 0x0e2c8bc, 0x0e2cd5a, 0x0e2cf7a,
+    0x0e2d14b, 0x0e2dd81, 0x0e2e409, 0x0e2e675, 0x0e2f00e, 0x0e2f544, 0x0e2fb1b, 0x0e30950, 0x0e31558, 0x0e31f5d,
+    0x0e3290a, 0x0e330ad, 0x0e33350, 0x0e33f24, 0x0e34163, 0x0e3516c, 0x0e35804, 0x0e366b8, 0x0e36b1c, 0x0e37350,
+    0x0e38703, 0x0e39ca9, 0x0e3a850, 0x0e3ab5f, 0x0e3c169, 0x0e3cb71, 0x0e3cf31, 0x0e3dd55, 0x0e3f352, 0x0e40c09,
+    0x0e43a89, 0x0e45033, 0x0e4557a, 0x0e458e4, 0x0e4616a, 0x0e46201, 0x0e46a89, 0x0e46c56, 0x0e46f62, 0x0e47005,
+    0x0e47241, 0x0e47761, 0x0e47b28, 0x0e47ee6, 0x0e48eed, 0x0e49007, 0x0e498e5, 0x0e49a46, 0x0e4a441, 0x0e4ad68,
+    0x0e4b35e, 0x0e4b6da, 0x0e4baf0, 0x0e4bec7, 0x0e4c2c8, 0x0e4c4a1, 0x0e4ccba, 0x0e4cec8, 0x0e4d34f, 0x0e4dc7f,
+    0x0e4de62, 0x0e4e521, 0x0e4eaf7, 0x0e4f339, 0x0e4f550, 0x0e4fd4f, 0x0e4fe62, 0x0e50150, 0x0e502a5, 0x0e5087d,
+    0x0e51446, 0x0e51687, 0x0e51a7f, 0x0e51eed, 0x0e5248f, 0x0e53e80, 0x0e55900, 0x0e55b00, 0x0e55e50, 0x0e560fe,
+    0x0e56802, 0x0e56d85, 0x0e56e66, 0x0e570b6, 0x0e57368, 0x0e5836c, 0x0e58499, 0x0e586da, 0x0e5883e, 0x0e5900a,
+    0x0e59ae8, 0x0e59d51, 0x0e5a075, 0x0e5a452, 0x0e5ae61, 0x0e5b287, 0x0e5bcd9, 0x0e5c071, 0x0e5c281, 0x0e5d10a,
+    0x0e5d323, 0x0e5d846, 0x0e5db51, 0x0e5dd22, 0x0e5de97, 0x0e5e17d, 0x0e5e369, 0x0e5e532, 0x0e5e769, 0x0e5e80d,
+    0x0e5ee88, 0x0e5f0a5, 0x0e5f564, 0x0e5f730, 0x0e5f8a0, 0x0e602a5, 0x0e60752, 0x0e614d3, 0x0e61caa, 0x0e62669,
+    0x0e62abf, 0x0e62c20, 0x0e62f63, 0x0e636be, 0x0e63816, 0x0e63a32, 0x0e63d1e, 0x0e642b3, 0x0e64475, 0x0e64b4b,
+    0x0e65357, 0x0e65581, 0x0e656ba, 0x0e6594b, 0x0e65d52, 0x0e662ce, 0x0e66874, 0x0e66f68, 0x0e670bc, 0x0e6721d,
+    0x0e67c76, 0x0e67f6a, 0x0e69a84, 0x0e6a179, 0x0e6a404, 0x0e6ae89, 0x0e6c0a9, 0x0e6d955, 0x0e6db34, 0x0e6df5d,
+    0x0e6fc78, 0x0e7095b, 0x0e70eb4, 0x0e71369, 0x0e7174a, 0x0e71c42, 0x0e7227d, 0x0e72c86, 0x0e736b6, 0x0e73f4c,
+    0x0e74411, 0x0e75349, 0x0e756bc, 0x0e75d4b, 0x0e75e78, 0x0e76152, 0x0e764ac, 0x0e76638, 0x0e76e3f, 0x0e77550,
+    0x0e77613, 0x0e780f2, 0x0e78490, 0x0e7907e, 0x0e792c3, 0x0e7951b, 0x0e79b7c, 0x0e79e89, 0x0e7a04f, 0x0e7a2ae,
+    0x0e7b260, 0x0e7bcb3, 0x0e7c181, 0x0e7ca4e, 0x0e7cf61, 0x0e7d26d, 0x0e7da07, 0x0e7e47a, 0x0e806fe, 0x0e80aa0,
+    0x0e80ca5, 0x0e812ad, 0x0e8155e, 0x0e81ea7, 0x0e82133, 0x0e83487, 0x0e83623, 0x0e84590, 0x0e84a75, 0x0e84cf5,
+    0x0e8509b, 0x0e854f5, 0x0e85949, 0x0e85c30, 0x0e8615f, 0x0e866ab, 0x0e868fb, 0x0e86aec, 0x0e86ce4, 0x0e878fd,
+    0x0e882ba, 0x0e8ab51, 0x0e8af6a, 0x0e8b2ce, 0x0e8b475, 0x0e8b765, 0x0e8b969, 0x0e8bd0e, 0x0e8bf16, 0x0e8db37,
+    0x0e8e067, 0x0e8ed61, 0x0e8ee01, 0x0e8fc83, 0x0e90034, 0x0e90230, 0x0e906a5, 0x0e90f5b, 0x0e91779, 0x0e91d65,
+    0x0e920b0, 0x0e93879, 0x0e93cf4, 0x0e94e0d, 0x0e95017, 0x0e952ff, 0x0e9754c, 0x0e9a56f, 0x0e9b863, 0x0e9bc41,
+    0x0e9c075, 0x0e9c4ee, 0x0e9c607, 0x0e9c904, 0x0e9cd47, 0x0e9dd4d, 0x0e9dee3, 0x0e9e8ac, 0x0e9ecf1, 0x0e9ee2f,
+    0x0e9fe14, 0x0ea097c, 0x0ea1abe, 0x0ea1e0c, 0x0ea2375, 0x0ea26ec, 0x0ea3059, 0x0ea3238, 0x0ea3520, 0x0ea393c,
+    0x0ea3f21, 0x0ea4b21, 0x0ea5167, 0x0ea5326, 0x0ea5656, 0x0ea5967, 0x0ea5a0c, 0x0ea5ed9, 0x0ea613c, 0x0ea6368,
+    0x0ea647e, 0x0ea6720, 0x0ea6a3f, 0x0ea6ecc, 0x0ea703f, 0x0ea753f, 0x0ea7676, 0x0ea7d6e, 0x0ea800d, 0x0ea8a20,
+    0x0ea9050, 0x0ea973c, 0x0ea9882, 0x0ea9d00, 0x0ea9f4b, 0x0eaa8e6, 0x0eab2ad, 0x0eab40b, 0x0eab77c, 0x0eab828,
+    0x0eacab5, 0x0eaccf5, 0x0ead450, 0x0eae51e, 0x0eae827, 0x0eaf07d, 0x0eaf349, 0x0eafe7d, 0x0eb0743, 0x0eb0c80,
+    0x0eb16ec, 0x0eb1f24, 0x0eb2363, 0x0eb24cf, 0x0eb2842, 0x0eb2c82, 0x0eb2ea9, 0x0eb325c, 0x0eb3486, 0x0eb3b1b,
+    0x0eb3ee1, 0x0eb40a5, 0x0eb4360, 0x0eb4768, 0x0eb4805, 0x0eb4a82, 0x0eb5763, 0x0eb58a5, 0x0eb5c2b, 0x0eb5e54,
+    0x0eb6181, 0x0eb62e8, 0x0eb64ec, 0x0eb6659, 0x0eb6890, 0x0eb6a2f, 0x0eb7039, 0x0eb737c, 0x0eb793a, 0x0eb7a87,
+    0x0eb7c7d, 0x0eb847e, 0x0eb875b, 0x0eb8976, 0x0eb8a12, 0x0eb8f7d, 0x0eb9167, 0x0eb9284, 0x0eb9500, 0x0eb9b63,
+    0x0eba560, 0x0eba97e, 0x0ebaa71, 0x0ebad5e, 0x0ebb045, 0x0ebb740, 0x0ebbcec, 0x0ebc4a5, 0x0ebc77e, 0x0ebc836,
+    0x0ebcd4f, 0x0ebcf19, 0x0ebd0a1, 0x0ebd478, 0x0ebd752, 0x0ebe136, 0x0ebe252, 0x0ebe825, 0x0ebf20d, 0x0ebf862,
+    0x0ebff4b, 0x0ec0169, 0x0ec0234, 0x0ec0781, 0x0ec0a39, 0x0ec1474, 0x0ec189d, 0x0ec2169, 0x0ec2a7e, 0x0ec2f63,
+    0x0ec30af, 0x0ec3315, 0x0ec3625, 0x0ec3f4c, 0x0ec407d, 0x0ec4407, 0x0ec48ad, 0x0ec4a1e, 0x0ec4d23, 0x0ec5237,
+    0x0ec5410, 0x0ec5736, 0x0ec5a0f, 0x0ec60b3, 0x0ec6627, 0x0ec6979, 0x0ec6b77, 0x0ec7101, 0x0ec78c6, 0x0ec7d64,
+    0x0ec7f65, 0x0ec8079, 0x0ec86ae, 0x0ec9801, 0x0ec9a07, 0x0eca963, 0x0ecacec, 0x0ecb83f, 0x0ecbc9e, 0x0ecc75b,
+    0x0ecd63f, 0x0ecdeff, 0x0ecf067, 0x0ecf63d, 0x0ecfa06, 0x0ecfc06, 0x0ed0571, 0x0ed083c, 0x0ed0c82, 0x0ed0e79,
+    0x0ed1067, 0x0ed165b, 0x0ed1c81, 0x0ed2201, 0x0ed266e, 0x0ed2d49, 0x0ed3350, 0x0ed48f2, 0x0ed5cec, 0x0ed6380,
+    0x0ed648a, 0x0ed6835, 0x0ed7ec3, 0x0ed8569, 0x0ed8b7f, 0x0ed8cea, 0x0ed9165, 0x0ed9563, 0x0ed9a6f, 0x0ed9c03,
+    0x0ed9f78, 0x0eda15f, 0x0eda27f, 0x0eda46f, 0x0eda89a, 0x0edac58, 0x0edae3b, 0x0edb0e6, 0x0edb721, 0x0edbebe,
+    0x0edca65, 0x0eddcc8, 0x0edde42, 0x0ede35a, 0x0ede4b9, 0x0ede97e, 0x0edf153, 0x0edf249, 0x0edf8e6, 0x0edfc49,
+    0x0ee0321, 0x0ee08c0, 0x0ee0ec1, 0x0ee1039, 0x0ee12bc, 0x0ee168d, 0x0ee1a94, 0x0ee3363, 0x0ee3521, 0x0ee3f7c,
+    0x0ee40c0, 0x0ee456a, 0x0ee4d89, 0x0ee5176, 0x0ee535b, 0x0ee5b31, 0x0ee5ebf, 0x0ee6a25, 0x0ee6c99, 0x0ee6e88,
+    0x0ee70c7, 0x0ee753d, 0x0ee795f, 0x0ee817b, 0x0ee837d, 0x0ee8733, 0x0ee8e3e, 0x0eea09e, 0x0eea27f, 0x0eeb55e,
+    0x0eeb684, 0x0eec329, 0x0eec531, 0x0eec646, 0x0eecaec, 0x0eeccc8, 0x0eed0d3, 0x0eed682, 0x0eed816, 0x0eef246,
+    0x0eefa9a, 0x0eefc5b, 0x0eeff0e, 0x0ef00ba, 0x0ef08c1, 0x0ef0a27, 0x0ef1890, 0x0ef1b2e, 0x0ef1d51, 0x0ef22c4,
+    0x0ef24b8, 0x0ef3eee, 0x0ef4024, 0x0ef44be, 0x0ef4aef, 0x0ef4ef9, 0x0ef5381, 0x0ef543d, 0x0ef592a, 0x0ef608d,
+    0x0ef6740, 0x0ef6aab, 0x0ef7778, 0x0ef7a62, 0x0ef7eff, 0x0ef9a89, 0x0efae28, 0x0efb6ba, 0x0efb883, 0x0efc522,
+    0x0efc763, 0x0efcb7e, 0x0efcf20, 0x0efd287, 0x0efd681, 0x0efd836, 0x0efda47, 0x0efdc01, 0x0efe722, 0x0efec7d,
+    0x0eff059, 0x0effb50, 0x0effc50, 0x0effe99, 0x0f0003a, 0x0f002b6, 0x0f00519, 0x0f0127c, 0x0f018f5, 0x0f01a8d,
+    0x0f0235e, 0x0f024ec, 0x0f0295f, 0x0f02d84, 0x0f02e22, 0x0f03049, 0x0f0355f, 0x0f03854, 0x0f03a4f, 0x0f03f76,
+    0x0f04746, 0x0f04a3e, 0x0f04d77, 0x0f04f7c, 0x0f05256, 0x0f0589d, 0x0f05a0e, 0x0f060eb, 0x0f068f2, 0x0f06f20,
+    0x0f0716d, 0x0f07201, 0x0f074a5, 0x0f076ae, 0x0f07940, 0x0f07ca5, 0x0f08028, 0x0f08a67, 0x0f08ece, 0x0f0985c,
+    0x0f09d57, 0x0f0a044, 0x0f0a550, 0x0f0ab2b, 0x0f0ad51, 0x0f0aef9, 0x0f0bb54, 0x0f0d54e, 0x0f0d6ad, 0x0f0d965,
+    0x0f0dab9, 0x0f0dd01, 0x0f0ee7f, 0x0f0f8eb, 0x0f10e42, 0x0f11240, 0x0f118b0, 0x0f11a01, 0x0f11d31, 0x0f1220a,
+    0x0f12648, 0x0f12f49, 0x0f1303f, 0x0f1340a, 0x0f136f5, 0x0f13823, 0x0f13e41, 0x0f14246, 0x0f14682, 0x0f14a0e,
+    0x0f14e0d, 0x0f160eb, 0x0f1627f, 0x0f1643e, 0x0f16736, 0x0f1681d, 0x0f1735b, 0x0f17cd4, 0x0f1822f, 0x0f18a08,
+    0x0f19314, 0x0f194a3, 0x0f19636, 0x0f1a0e6, 0x0f1a97b, 0x0f1aa90, 0x0f1b268, 0x0f1d0c6, 0x0f1d8fc, 0x0f1e4ff,
+    0x0f1e83d, 0x0f1eeab, 0x0f1f479, 0x0f20281, 0x0f20a49, 0x0f22680, 0x0f23cbe, 0x0f24815, 0x0f26813, 0x0f27522,
+    0x0f27722, 0x0f278a5, 0x0f27d1e, 0x0f2812c, 0x0f282f5, 0x0f28d52, 0x0f290f5, 0x0f2937e, 0x0f2a656, 0x0f2ad8c,
+    0x0f2af7e, 0x0f2b590, 0x0f2b6ff, 0x0f2b875, 0x0f2bb81, 0x0f2bd20, 0x0f2bf31, 0x0f2c02f, 0x0f2c4bf, 0x0f2cb53,
+    0x0f2cf3d, 0x0f2d0ee, 0x0f2da7d, 0x0f2df7c, 0x0f2ee3b, 0x0f2f07c, 0x0f2f4f5, 0x0f30012, 0x0f30283, 0x0f308b0,
+    0x0f30a1f, 0x0f31550, 0x0f31e56, 0x0f33588, 0x0f34f50, 0x0f36704, 0x0f37369, 0x0f37569, 0x0f376a5, 0x0f37afb,
+    0x0f37c6f, 0x0f38159, 0x0f3832c, 0x0f38742, 0x0f38c59, 0x0f39212, 0x0f396fe, 0x0f39b7f, 0x0f3a290, 0x0f3a4c1,
+    0x0f3aa0d, 0x0f3b0bf, 0x0f3bf8c, 0x0f3c6c6, 0x0f3c824, 0x0f3ccfb, 0x0f3cf60, 0x0f3d37e, 0x0f3d724, 0x0f3db89,
+    0x0f3de7d, 0x0f3e024, 0x0f3f082, 0x0f3f763, 0x0f3fa7a, 0x0f40150, 0x0f404a0, 0x0f40656, 0x0f40cb4, 0x0f41624,
+    0x0f41b1d, 0x0f41d29, 0x0f42907, 0x0f42e06, 0x0f4357e, 0x0f43c90, 0x0f44027, 0x0f4472f, 0x0f4674c, 0x0f46e7d,
+    0x0f4737c, 0x0f4763b, 0x0f4787e, 0x0f47a7d, 0x0f47e5b, 0x0f48cc8, 0x0f4a316, 0x0f4af31, 0x0f4e104, 0x0f4e95c,
+    0x0f4ec86, 0x0f4eefd, 0x0f4f150, 0x0f4f2fd, 0x0f4f493, 0x0f4fe2a, 0x0f50187, 0x0f50342, 0x0f506fa, 0x0f50977,
+    0x0f50c0e, 0x0f51161, 0x0f51af9, 0x0f52361, 0x0f5257e, 0x0f52b3d, 0x0f52c81, 0x0f52e2b, 0x0f53085, 0x0f53833,
+    0x0f53b4e, 0x0f53e95, 0x0f54090, 0x0f54a9a, 0x0f54c45, 0x0f5515d, 0x0f55969, 0x0f55a87, 0x0f56769, 0x0f57eae,
+    0x0f596a5, 0x0f5ad24, 0x0f5b378, 0x0f5bc84, 0x0f5be84, 0x0f5c179, 0x0f5c68a, 0x0f5cb40, 0x0f5cd2d, 0x0f5da82,
+    0x0f5de47, 0x0f5f381, 0x0f5f581, 0x0f5fb69, 0x0f5fe59, 0x0f60646, 0x0f6087d, 0x0f60c05, 0x0f6107d, 0x0f6157a,
+    0x0f61732, 0x0f61e75, 0x0f62354, 0x0f6280d, 0x0f62a7f, 0x0f63321, 0x0f6363e, 0x0f63c25, 0x0f640a5, 0x0f6493d,
+    0x0f64b2c, 0x0f64c56, 0x0f6500b, 0x0f65437, 0x0f65789, 0x0f6583e, 0x0f65d72, 0x0f66261, 0x0f6667e, 0x0f670f2,
+    0x0f6747f, 0x0f678ae, 0x0f67c0e, 0x0f68b52, 0x0f68efd, 0x0f6923d, 0x0f69683, 0x0f69900, 0x0f69e4f, 0x0f6a099,
+    0x0f6a381, 0x0f6a540, 0x0f6a837, 0x0f6ac1a, 0x0f6b094, 0x0f6b40d, 0x0f6b71a, 0x0f6bb7d, 0x0f6c16c, 0x0f6c4e4,
+    0x0f6dd22, 0x0f6e354, 0x0f6e51d, 0x0f6eb5f, 0x0f6ee97, 0x0f6f227, 0x0f6f65a, 0x0f6fcf7, 0x0f7007f, 0x0f70a0d,
+    0x0f71a62, 0x0f720fc, 0x0f72813, 0x0f72a7d, 0x0f72f30, 0x0f73893, 0x0f73af7, 0x0f74265, 0x0f7456a, 0x0f74d72,
+    0x0f74efa, 0x0f75146, 0x0f752b3, 0x0f75439, 0x0f75754, 0x0f75910, 0x0f75a7f, 0x0f76353, 0x0f7697c, 0x0f77181,
+    0x0f78279, 0x0f78d84, 0x0f78eed, 0x0f79874, 0x0f7a29a, 0x0f7a6af, 0x0f7b25b, 0x0f7b452, 0x0f7ba61, 0x0f7c233,
+    0x0f7caa5, 0x0f7cc0d, 0x0f7d425, 0x0f7dc9f, 0x0f7e2a5, 0x0f7eeeb, 0x0f7f845, 0x0f7fcc2, 0x0f80e32, 0x0f81667,
+    0x0f8192f, 0x0f81eb0, 0x0f82c47, 0x0f83e3f, 0x0f84c3d, 0x0f84e79, 0x0f8556f, 0x0f87013, 0x0f87e14, 0x0f88180,
+    0x0f8829e, 0x0f89a7d, 0x0f8e6bf, 0x0f8e83e, 0x0f8f6a3, 0x0f8f952, 0x0f8fb89, 0x0f91253, 0x0f92205, 0x0f924a5,
+    0x0f92af2, 0x0f92e32, 0x0f93178, 0x0f9393d, 0x0f93aa5, 0x0f93d50, 0x0f93f2f, 0x0f94589, 0x0f9496b, 0x0f94b80,
+    0x0f95453, 0x0f95ca8, 0x0f962a8, 0x0f96417, 0x0f96684, 0x0f97234, 0x0f978ab, 0x0f97b8a, 0x0f97c84, 0x0f98313,
+    0x0f98b0b, 0x0f98e74, 0x0f9915a, 0x0f99475, 0x0f9996f, 0x0f99a2f, 0x0f9aa5b, 0x0f9ad37, 0x0f9aefe, 0x0f9b219,
+    0x0f9b8bf, 0x0f9bf71, 0x0f9c08e, 0x0f9d080, 0x0f9dedf, 0x0f9f0bf, 0x0f9f750, 0x0fa154c, 0x0fa412f, 0x0fa4533,
+    0x0fa4e83, 0x0fa5789, 0x0fa5ea3, 0x0fadd5a, 0x0faef7e, 0x0fb4cf5, 0x0fb5cf5, 0x0fc76bf, 0x0fc8250, 0x0fc8f61,
+    0x0fd058d, 0x0fd363b, 0x0fd3f2c, 0x0fd4086, 0x0fd4369, 0x0fd4473, 0x0fd4780, 0x0fd4952, 0x0fd4a5c, 0x0fd4d6b,
+    0x0fd4e7d, 0x0fd5149, 0x0fd5299, 0x0fd547d, 0x0fd5707, 0x0fd594b, 0x0fd5b6c, 0x0fd5e2d, 0x0fd60ec, 0x0fd6319,
+    0x0fd645a, 0x0fd66ca, 0x0fd6b8a, 0x0fd6cb2, 0x0fd6e53, 0x0fd717e, 0x0fd734c, 0x0fd7451, 0x0fd7ada, 0x0fd7d24,
+    0x0fd7f52, 0x0fd8059, 0x0fd8355, 0x0fd8456, 0x0fd86a7, 0x0fd898c, 0x0fd8b20, 0x0fd8d50, 0x0fd8f7e, 0x0fd917f,
+    0x0fd9380, 0x0fd9407, 0x0fd9656, 0x0fd9828, 0x0fd9b1d, 0x0fd9d63, 0x0fd9e84, 0x0fda038, 0x0fda208, 0x0fda50a,
+    0x0fda682, 0x0fda895, 0x0fdab05, 0x0fdae6d, 0x0fdb07a, 0x0fdb25d, 0x0fdb55b, 0x0fdb680, 0x0fdb8b3, 0x0fdba89,
+    0x0fdbc81, 0x0fdbf40, 0x0fdc05f, 0x0fdc354, 0x0fdc488, 0x0fdc759, 0x0fdcb31, 0x0fdcd38, 0x0fdce7d, 0x0fdd13b,
+    0x0fdd27d, 0x0fdd55a, 0x0fdd6ac, 0x0fddb5a, 0x0fddcf5, 0x0fdde52, 0x0fde02e, 0x0fde31c, 0x0fde468, 0x0fde721,
+    0x0fde94b, 0x0fdeac0, 0x0fded23, 0x0fdee0c, 0x0fdf027, 0x0fdf4ad, 0x0fdf700, 0x0fdf98a, 0x0fdfb78, 0x0fdfd49,
+    0x0fdfeb4, 0x0fe0186, 0x0fe0389, 0x0fe0490, 0x0fe0753, 0x0fe087f, 0x0fe0ac0, 0x0fe0c9f, 0x0fe0f3b, 0x0fe10c1,
+    0x0fe127d, 0x0fe167a, 0x0fe192c, 0x0fe1a4a, 0x0fe1c47, 0x0fe1e0e, 0x0fe2261, 0x0fe2586, 0x0fe2678, 0x0fe283e,
+    0x0fe2ab4, 0x0fe2c0e, 0x0fe2ec3, 0x0fe316a, 0x0fe3283, 0x0fe3456, 0x0fe370c, 0x0fe397c, 0x0fe3a54, 0x0fe3e5b,
+    0x0fe401f, 0x0fe42a5, 0x0fe4563, 0x0fe467f, 0x0fe4811, 0x0fe4aee, 0x0fe4cb8, 0x0fe4ea3, 0x0fe5165, 0x0fe5333,
+    0x0fe54c7, 0x0fe5715, 0x0fe5955, 0x0fe5aa9, 0x0fe5d1b, 0x0fe5f75, 0x0fe6080, 0x0fe62f7, 0x0fe64f9, 0x0fe6678,
+    0x0fe6881, 0x0fe6b8d, 0x0fe6c55, 0x0fe705a, 0x0fe7501, 0x0fe8565, 0x0fe88fc, 0x0fe8b51, 0x0fea065, 0x0fea34a,
+    0x0fea94a, 0x0feaa6c, 0x0feaeb3, 0x0feb056, 0x0feb44f, 0x0febe62, 0x0fec25a, 0x0fec405, 0x0fed15f, 0x0fed37a,
+    0x0fed58e, 0x0fedd7e, 0x0fee29f, 0x0fee524, 0x0fee8ec, 0x0fef2a5, 0x0fefd75, 0x0ff027d, 0x0ff1560, 0x0ff18f8,
+    0x0ff1cbc, 0x0ff285b, 0x0ff34ac, 0x0ff3a3e, 0x0ff3d59, 0x0ff3ef8, 0x0ff4352, 0x0ff4902, 0x0ff4f33, 0x0ff5e82,
+    0x0ff6137, 0x0ff6550, 0x0ff70a3, 0x0ff725f, 0x0ff781f, 0x0ff7b69, 0x0ff7f63, 0x0ff834d, 0x0ff8a25, 0x0ff9563,
+    0x0ff9963, 0x0ff9cac, 0x0ffa953, 0x0ffab50, 0x0ffb0f9, 0x0ffbe3e, 0x0ffc034, 0x0ffc252, 0x0ffcb81, 0x0ffcc7f,
+    0x0ffd2ed, 0x0ffdc6f, 0x0ffe06c, 0x0ffe204, 0x0ffe763, 0x0fff650, 0x0fff963, 0x1000161, 0x10002a1, 0x100068f,
+    0x10008ba, 0x1000b7b, 0x1000cf5, 0x1001641, 0x100184e, 0x1001b25, 0x10020cb, 0x10024a3, 0x1002989, 0x1002a5f,
+    0x1002c21, 0x1002e6e, 0x100316c, 0x1003205, 0x100392c, 0x100407c, 0x10044a1, 0x1004b37, 0x1004ce3, 0x1004eaf,
+    0x10050dc, 0x1005280, 0x10054e7, 0x10062c6, 0x100664e, 0x1006a42, 0x1006d62, 0x1006e37, 0x100712d, 0x1007625,
+    0x1007a39, 0x1007e5f, 0x10084d7, 0x1008639, 0x1008cac, 0x10094a9, 0x10096ae, 0x100997e, 0x1009ad9, 0x100a463,
+    0x100a8a7, 0x100b0f0, 0x100b487, 0x100d29a, 0x100d430, 0x100e204, 0x100ff69, 0x1010169, 0x101072f, 0x1010963,
+    0x1010d2c, 0x1010f7a, 0x101130b, 0x10116a2, 0x101187d, 0x1012679, 0x1012d54, 0x1013180, 0x1013446, 0x101365a,
+    0x101390a, 0x1013a59, 0x1013f4e, 0x1014020, 0x1014262, 0x101457e, 0x1014856, 0x1014a52, 0x101527f, 0x1015451,
+    0x1015787, 0x1015aca, 0x1015c03, 0x1015e91, 0x1016260, 0x1016569, 0x1016961, 0x1016ef7, 0x1017452, 0x1017884,
+    0x1017b35, 0x1017d20, 0x1017f7f, 0x1018179, 0x1018355, 0x1018520, 0x101874b, 0x1018980, 0x1018c39, 0x101980a,
+    0x1019a63, 0x1019d35, 0x101ace7, 0x101af7c, 0x101b390, 0x101b4e9, 0x101b67e, 0x101b921, 0x101bb7e, 0x101bc09,
+    0x101c275, 0x101c964, 0x101cb5a, 0x101ceae, 0x101d044, 0x101d28b, 0x101d4b0, 0x101d684, 0x101d8dd, 0x101db5f,
+    0x101de96, 0x101e163, 0x101e266, 0x101e46b, 0x101e65c, 0x101e844, 0x101ec81, 0x101f158, 0x101f402, 0x101f8ed,
+    0x101fad2, 0x102057e, 0x1020c34, 0x10212b7, 0x102147d, 0x1021a97, 0x1021d11, 0x1021f70, 0x10220f5, 0x10222ce,
+    0x10224bf, 0x10226db, 0x10228b1, 0x1022c13, 0x1023149, 0x1023481, 0x1023c36, 0x10258e8, 0x1025ef4, 0x1026346,
+    0x10264d6, 0x1026cb3, 0x10270a7, 0x1027cec, 0x1028d3c, 0x1029084, 0x102949d, 0x1029762, 0x102995f, 0x102a056,
+    0x102a256, 0x102a652, 0x102a8f8, 0x102ab49, 0x102b38a, 0x102b442, 0x102c031, 0x102cb57, 0x102cf24, 0x102d2cc,
+    0x102da4b, 0x102dd12, 0x102e161, 0x102e27f, 0x102e969, 0x102f256, 0x102f552, 0x102f6d3, 0x102f8c0, 0x102fb47,
+    0x102fd3a, 0x102ff44, 0x1030008, 0x10304b4, 0x103105c, 0x1031413, 0x1031e5b, 0x1032211, 0x103300f, 0x1033737,
+    0x10338c6, 0x1033b50, 0x103477e, 0x1034cab, 0x10350eb, 0x1035429, 0x103671b, 0x1037565, 0x103771b, 0x1038145,
+    0x10382a7, 0x103840d, 0x1038767, 0x1038d63, 0x1039515, 0x1039862, 0x103c623, 0x103cf70, 0x103d589, 0x103d8d7,
+    0x103da27, 0x103e77e, 0x103e97e, 0x103f77c, 0x103f886, 0x103fd69, 0x1040161, 0x1040369, 0x1040426, 0x1040950,
+    0x1040a86, 0x1040d69, 0x104191e, 0x1041b1e, 0x1042122, 0x1042524, 0x104293c, 0x104362a, 0x104392a, 0x1043d4f,
+    0x1043f80, 0x104422a, 0x104451b, 0x1044763, 0x1045007, 0x104546d, 0x1045651, 0x1045807, 0x1045a0d, 0x1045f7f,
+    0x104607f, 0x1046218, 0x1046781, 0x1046972, 0x1046a4a, 0x1046c13, 0x1046f52, 0x104705c, 0x104722a, 0x10476b0,
+    0x1047d50, 0x104891d, 0x1048f3f, 0x104934b, 0x10496be, 0x1049f23, 0x104b12e, 0x104b419, 0x104be26, 0x104d0be,
+    0x104dc5e, 0x104dea8, 0x104e07f, 0x104e516, 0x104e75f, 0x104e856, 0x104f219, 0x104f563, 0x104fa81, 0x104fc01,
+    0x104fecb, 0x1050482, 0x1050949, 0x10510bf, 0x10514f7, 0x1051769, 0x1051b1d, 0x1051cfd, 0x1051e46, 0x10522f5,
+    0x10524b9, 0x1052f53, 0x10530ec, 0x1053256, 0x105394f, 0x1053b7e, 0x1053f1b, 0x10542f7, 0x1054894, 0x1054a82,
+    0x1054cb0, 0x105507d, 0x10552fb, 0x10554f5, 0x105575f, 0x1055853, 0x1055a05, 0x1055d0e, 0x1055f56, 0x105607d,
+    0x1056276, 0x1056651, 0x105694f, 0x1056f7e, 0x105716c, 0x10572fb, 0x1057b5e, 0x1057c52, 0x1058230, 0x105880e,
+    0x1058f4b, 0x10590a5, 0x105944b, 0x1059752, 0x1059820, 0x1059a18, 0x1059d81, 0x1059f2f, 0x105a36a, 0x105a503,
+    0x105a6ac, 0x105a935, 0x105ab1d, 0x105aec1, 0x105b0fc, 0x105b690, 0x105b8c8, 0x105bc09, 0x105be61, 0x105c0c3,
+    0x105c363, 0x105c687, 0x105c8ef, 0x105cb10, 0x105cc95, 0x105d71b, 0x105de0b, 0x105e365, 0x105e887, 0x105ee59,
+    0x105f2f1, 0x105f656, 0x1060388, 0x10604ba, 0x1060650, 0x106087e, 0x1060aba, 0x1060cba, 0x1060e05, 0x106102f,
+    0x10612c6, 0x1061825, 0x1061c84, 0x1061eae, 0x10622d6, 0x1062965, 0x1062afd, 0x1062ec4, 0x1063564, 0x106365e,
+    0x10638f7, 0x1064e7f, 0x106502f, 0x10656b9, 0x106581d, 0x1065a81, 0x1065e56, 0x1066381, 0x1066680, 0x106687a,
+    0x1066b64, 0x1066c1d, 0x106710a, 0x106730c, 0x1067426, 0x1067940, 0x106815d, 0x1068700, 0x1068c84, 0x1068f57,
+    0x1069219, 0x1069f07, 0x106a07f, 0x106a33b, 0x106a479, 0x106a8a5, 0x106b47e, 0x106b705, 0x106b80d, 0x106bcf9,
+    0x106be7a, 0x106c07d, 0x106c23a, 0x106c70a, 0x106c87b, 0x106cb57, 0x106ccb3, 0x106cf65, 0x106d15d, 0x106d283,
+    0x106d532, 0x106d764, 0x106d8b7, 0x106da73, 0x106dd80, 0x106df61, 0x106ee6f, 0x106f00d, 0x106f63e, 0x106f942,
+    0x106fb31, 0x1070aa5, 0x1070cf4, 0x10712a5, 0x1071d19, 0x1072487, 0x10726bc, 0x1073120, 0x107373f, 0x1073968,
+    0x1073c65, 0x1074168, 0x10750a0, 0x1075256, 0x107544b, 0x10756c6, 0x107608d, 0x107629e, 0x10764a7, 0x1076722,
+    0x107694e, 0x1076d52, 0x1076e7c, 0x1077168, 0x1077365, 0x1077565, 0x107782d, 0x1077ab9, 0x1078149, 0x1078284,
+    0x1078a7f, 0x1078e62, 0x1079487, 0x107988a, 0x1079e6f, 0x107a856, 0x107ac20, 0x107b12d, 0x107b816, 0x107ba05,
+    0x107bf42, 0x107c013, 0x107c26c, 0x107cb50, 0x107d2f4, 0x107d43a, 0x107e062, 0x107e2ac, 0x107e452, 0x107f15f,
+    0x107f287, 0x107fb24, 0x10802f5, 0x1080634, 0x1080938, 0x1080c0d, 0x10816f5, 0x10818be, 0x1081af1, 0x1081d4b,
+    0x1081e39, 0x1082278, 0x10830cb, 0x108393e, 0x1083ab3, 0x1084965, 0x1084b65, 0x1084d65, 0x1084f54, 0x1085111,
+    0x108635b, 0x1087169, 0x108784b, 0x1087ab3, 0x1088c09, 0x108a254, 0x108af7b, 0x108b353, 0x108b507, 0x108b65c,
+    0x108b8f6, 0x108c2f4, 0x108c644, 0x108d2e4, 0x108d675, 0x108d970, 0x108da7e, 0x108e230, 0x108e74b, 0x108ea9a,
+    0x108ed3f, 0x108f150, 0x108f4f5, 0x109043e, 0x1090e1f, 0x109108c, 0x109129a, 0x1091680, 0x10918af, 0x1091ce5,
+    0x1092ea0, 0x10932be, 0x1093930, 0x1094208, 0x1095e97, 0x10964f4, 0x109692b, 0x109717d, 0x109727f, 0x109747d,
+    0x1097a4d, 0x1097e6e, 0x109837c, 0x109895a, 0x109930a, 0x109954d, 0x1099b22, 0x109a10c, 0x109a333, 0x109a60a,
+    0x109ac0d, 0x109ba9f, 0x109be7d, 0x109c0a5, 0x109c769, 0x109cb65, 0x109ccc6, 0x109d8eb, 0x109e150, 0x109f8a9,
+    0x109ff5a, 0x10a192f, 0x10a22c2, 0x10a26b8, 0x10a2f7b, 0x10a354b, 0x10a3e32, 0x10a4216, 0x10a56d4, 0x10a5924,
+    0x10a6ef8, 0x10a7045, 0x10a72a7, 0x10a74ab, 0x10a7694, 0x10a7801, 0x10a7a0d, 0x10a8650, 0x10a915d, 0x10a9281,
+    0x10a950e, 0x10aacff, 0x10ab27a, 0x10abd8e, 0x10ac90e, 0x10ad089, 0x10ae4f5, 0x10ae96c, 0x10af34d, 0x10af47d,
+    0x10af673, 0x10afca3, 0x10b0809, 0x10b0a6e, 0x10b0f4b, 0x10b1f63, 0x10b375c, 0x10b380d, 0x10b4955, 0x10b5073,
+    0x10b5556, 0x10b5d2e, 0x10b5f24, 0x10b615d, 0x10b6f0c, 0x10b7335, 0x10b825b, 0x10b927d, 0x10b9e18, 0x10ba0c1,
+    0x10ba752, 0x10baae3, 0x10bb8a5, 0x10bc93a, 0x10bd250, 0x10bf771, 0x10bfe7c, 0x10c0a72, 0x10c22c6, 0x10c2cd7,
+    0x10c4eff, 0x10c5250, 0x10c7178, 0x10c78bf, 0x10c9a75, 0x10c9c75, 0x10c9eb0, 0x10ca0e1, 0x10ca2b4, 0x10ca8f7,
+    0x10cb55a, 0x10cbd69, 0x10cc469, 0x10cd626, 0x10cd8fe, 0x10cdc7d, 0x10ce322, 0x10cf273, 0x10cf47a, 0x10cf6be,
+    0x10cf85c, 0x10cfb31, 0x10cfd51, 0x10cfe1e, 0x10d0122, 0x10d0363, 0x10d04b6, 0x10d154c, 0x10d170e, 0x10d1808,
+    0x10d1aec, 0x10d2764, 0x10d2a17, 0x10d395e, 0x10d3a6e, 0x10d4660, 0x10d4971, 0x10d4e82, 0x10d5056, 0x10d5225,
+    0x10d5445, 0x10d5952, 0x10d5efe, 0x10d6168, 0x10d6376, 0x10d6968, 0x10d6a6f, 0x10d6c6c, 0x10d7503, 0x10d8181,
+    0x10d8862, 0x10d8cff, 0x10d8f1e, 0x10d92ac, 0x10d9462, 0x10d9639, 0x10d9ca5, 0x10d9e24, 0x10da0ff, 0x10da2c7,
+    0x10da87a, 0x10db160, 0x10db347, 0x10db781, 0x10dbc9c, 0x10dbe81, 0x10dc86a, 0x10dd2fd, 0x10ddb7e, 0x10ddcb8,
+    0x10de17b, 0x10de27e, 0x10de4ce, 0x10de72c, 0x10de8f5, 0x10df11d, 0x10df367, 0x10dfc4b, 0x10e0124, 0x10e0454,
+    0x10e0720, 0x10e0f7b, 0x10e114f, 0x10e1256, 0x10e14a5, 0x10e1a28, 0x10e255f, 0x10e273f, 0x10e2b44, 0x10e2f4e,
+    0x10e317e, 0x10e3452, 0x10e38bf, 0x10e3cf5, 0x10e429d, 0x10e44be, 0x10e46f8, 0x10e4b50, 0x10e533d, 0x10e5d69,
+    0x10e62ec, 0x10e6963, 0x10e6f00, 0x10e76fc, 0x10e7c69, 0x10e7f49, 0x10e8f65, 0x10e9069, 0x10e921f, 0x10e9890,
+    0x10e9d55, 0x10ea769, 0x10eae79, 0x10eb20e, 0x10ec056, 0x10ec768, 0x10ec8fe, 0x10ecaba, 0x10edc56, 0x10ee09a,
+    0x10ee875, 0x10eec41, 0x10ef6cc, 0x10ef8af, 0x10efa2d, 0x10efd0a, 0x10f04a0, 0x10f06e7, 0x10f0b50, 0x10f116a,
+    0x10f172e, 0x10f1b0a, 0x10f26fb, 0x10f2f37, 0x10f3ec4, 0x10f50b8, 0x10f5722, 0x10f5819, 0x10f5a25, 0x10f5e04,
+    0x10f6737, 0x10f6aee, 0x10f74b3, 0x10f7b7f, 0x10f8126, 0x10f8cb6, 0x10f94ba, 0x10f9750, 0x10fa379, 0x10fa4b9,
+    0x10fa753, 0x10fb6eb, 0x10fc0e6, 0x10fca79, 0x10fd47a, 0x10fdd1b, 0x10ff355, 0x10ffc1f, 0x11006b3, 0x11014a7,
+    0x11026be, 0x1102b0c, 0x1102c7c, 0x11036c2, 0x11042a5, 0x110442d, 0x1106488, 0x1107246, 0x11078ff, 0x110815c,
+    0x11088e0, 0x1108b56, 0x1109957, 0x1109b5f, 0x110a952, 0x110ae82, 0x110b35e, 0x110c272, 0x110c4ff, 0x110c763,
+    0x110c963, 0x110ca14, 0x110d00f, 0x110d21d, 0x110d71b, 0x110d823, 0x110dc68, 0x110e126, 0x110e4ca, 0x110ef7f,
+    0x110fb07, 0x110fcfb, 0x110fe83, 0x111036a, 0x11104bc, 0x1110804, 0x1110ad6, 0x111107e, 0x1111638, 0x1111ae8,
+    0x1112536, 0x1112d59, 0x1113947, 0x11144e6, 0x11148ba, 0x111560a, 0x1115b50, 0x1116256, 0x1116ef6, 0x111785c,
+    0x1118216, 0x11184aa, 0x1118b85, 0x1118c3a, 0x1119291, 0x1119c24, 0x111a4f3, 0x111a963, 0x111ab69, 0x111b0fe,
+    0x111b302, 0x111bf19, 0x111c4a7, 0x111c6a7, 0x111c895, 0x111ca7f, 0x111d00d, 0x111e04a, 0x111e20f, 0x111e71c,
+    0x111e8e9, 0x111f0b3, 0x111f269, 0x111f93b, 0x111fc87, 0x1120463, 0x112140e, 0x112206f, 0x1122409, 0x1122609,
+    0x112320a, 0x1123428, 0x11236b4, 0x1124237, 0x1124b0c, 0x1125544, 0x1125625, 0x11260f7, 0x112689f, 0x1126d7b,
+    0x11282f8, 0x1128953, 0x112bc0d, 0x112be83, 0x112cd0c, 0x112f6e6, 0x112ff50, 0x1130361, 0x1130736, 0x1130c56,
+    0x113827f, 0x1138465, 0x1138867, 0x1138abf, 0x1138d22, 0x1138e1f, 0x113909f, 0x1139289, 0x113947d, 0x1139750,
+    0x113983e, 0x1139d69, 0x1139e61, 0x113a083, 0x113a2ff, 0x113a481, 0x113ac89, 0x113b462, 0x113b989, 0x113bd1c,
+    0x113c682, 0x113ca60, 0x113cc28, 0x113d72f, 0x113df7e, 0x113e675, 0x114015f, 0x1140e73, 0x1147d89, 0x11490a5,
+    0x114f378, 0x1151369, 0x115153a, 0x1152722, 0x1160e7f, 0x1164cfc, 0x116cc84, 0x116d8ec, 0x117415f, 0x117427d,
+    0x1174442, 0x1174656, 0x1174907, 0x1174a7d, 0x1174c82, 0x1174e73, 0x1175138, 0x1175304, 0x117551b, 0x11756f5,
+    0x1175b5d, 0x1175d63, 0x1175f5d, 0x117607d, 0x1176480, 0x117667a, 0x11768e3, 0x1176a87, 0x1176d5e, 0x1176ecf,
+    0x117715a, 0x117724b, 0x11774b2, 0x117792d, 0x1177a54, 0x1177d1e, 0x1177e51, 0x1178089, 0x117837d, 0x1178462,
+    0x117866f, 0x11788f1, 0x1178b8c, 0x1178d22, 0x1179176, 0x117932f, 0x117957c, 0x117963e, 0x1179980, 0x1179a2f,
+    0x1179cff, 0x1179f7a, 0x117a363, 0x117a563, 0x117a699, 0x117a8a3, 0x117ab22, 0x117ac63, 0x117af22, 0x117b07d,
+    0x117b27a, 0x117b424, 0x117b781, 0x117b920, 0x117ba76, 0x117bc39, 0x117be61, 0x117c100, 0x117c267, 0x117c55d,
+    0x117c763, 0x117c97d, 0x117ca58, 0x117cd53, 0x117ce1d, 0x117d07b, 0x117d35a, 0x117d682, 0x117d94f, 0x117db69,
+    0x117dcf9, 0x117df4f, 0x117e05b, 0x117e368, 0x117e47a, 0x117e699, 0x117e92b, 0x117eb2d, 0x117ec4c, 0x117eefc,
+    0x117f181, 0x117f38b, 0x117f4df, 0x117f646, 0x117f988, 0x117fa52, 0x117fc90, 0x117ff4b, 0x1180169, 0x118031f,
+    0x1180520, 0x1180640, 0x118081f, 0x1180aa8, 0x1180d87, 0x1180f31, 0x1181136, 0x1181563, 0x11816c7, 0x1181823,
+    0x1181a41, 0x1181c79, 0x1181e7f, 0x1182155, 0x118235c, 0x1182562, 0x118274b, 0x118284b, 0x1182b69, 0x1182d5b,
+    0x1182e1f, 0x1183189, 0x1183202, 0x118355f, 0x118363e, 0x11838bf, 0x1183aed, 0x1183ec6, 0x118403a, 0x118432f,
+    0x1184555, 0x1184761, 0x1184808, 0x1184b22, 0x1184cf7, 0x1184ebf, 0x1185083, 0x11852b8, 0x118557b, 0x118567f,
+    0x11858c5, 0x1185b36, 0x1185d74, 0x1185ef9, 0x118609f, 0x11862f4, 0x1186489, 0x118675f, 0x11868f7, 0x1186b78,
+    0x1186c23, 0x1186e62, 0x118827c, 0x1188c45, 0x1188e80, 0x1189322, 0x1189949, 0x118ab22, 0x118b545, 0x118c353,
+    0x118c478, 0x118d46e, 0x118d769, 0x118e611, 0x118f17e, 0x118f209, 0x118f41e, 0x1190440, 0x1190b59, 0x119126e,
+    0x11914c6, 0x11918ba, 0x11928ec, 0x11930c6, 0x11a3a0a, 0x11a3d7c, 0x11a3e56, 0x11a4260, 0x11a4416, 0x11a4772,
+    0x11a4952, 0x11a4a06, 0x11a4d79, 0x11a4e7c, 0x11a517e, 0x11a5250, 0x11a5536, 0x11a56f0, 0x11a580e, 0x11a5a61,
+    0x11a5d81, 0x11a5e65, 0x11a604e, 0x11a627f, 0x11a640b, 0x11a6722, 0x11a693e, 0x11a6a67, 0x11a6c99, 0x11a6e38,
+    0x11a70ba, 0x11a7252, 0x11a746f, 0x11a7763, 0x11a7973, 0x11a7b7e, 0x11a7c7e, 0x11a7e7a, 0x11a8189, 0x11a82ab,
+    0x11a84b0, 0x11a8770, 0x11a8989, 0x11a8a58, 0x11a8c83, 0x11a8efe, 0x11a917c, 0x11a929e, 0x11a951e, 0x11a9656,
+    0x11a9846, 0x11a9a7d, 0x11a9d24, 0x11a9f1c, 0x11aa02f, 0x11aa65f, 0x11aa8e9, 0x11aaa39, 0x11aac9e, 0x11ab186,
+    0x11ab256, 0x11ab584, 0x11ab712, 0x11ab972, 0x11abb5f, 0x11abd6f, 0x11ac175, 0x11ac31b, 0x11ac565, 0x11ac659,
+    0x11ac825, 0x11acd1e, 0x11acecc, 0x11ad66f, 0x11adb7b, 0x11ae18b, 0x11ae686, 0x11ae856, 0x11aeb7a, 0x11aec59,
+    0x11aeef5, 0x11b0223, 0x11b0887, 0x11b0a21, 0x11b156b, 0x11b16ff, 0x11b2389, 0x11b28aa, 0x11b3f37, 0x11b46ff,
+    0x11b636f, 0x11b678c, 0x11b68e4, 0x11b6a09, 0x11b7049, 0x11b7456, 0x11b787f, 0x11b7d7e, 0x11b7f34, 0x11b876b,
+    0x11b88f8, 0x11b8d35, 0x11b9605, 0x11b9841, 0x11b9d46, 0x11b9e7e, 0x11ba2e8, 0x11bad7e, 0x11bae56, 0x11bb51b,
+    0x11bb613, 0x11bba87, 0x11bbca5, 0x11bbe5e, 0x11bc752, 0x11bc881, 0x11bd096, 0x11bd467, 0x11bd6fd, 0x11bd89a,
+    0x11bdeb0, 0x11be73d, 0x11bea7f, 0x11beef9, 0x11bf00d, 0x11bf352, 0x11bf44a, 0x11bf67d, 0x11bfa7d, 0x11c0b5c,
+    0x11c12a8, 0x11c1567, 0x11c1827, 0x11c1f34, 0x11c282e, 0x11c3a77, 0x11c3c87, 0x11c3e25, 0x11c453b, 0x11c4613,
+    0x11c5216, 0x11c558a, 0x11c597e, 0x11c5c3f, 0x11c5f7e, 0x11c624a, 0x11c6b7f, 0x11c7229, 0x11c747f, 0x11c7a87,
+    0x11c8041, 0x11c82ed, 0x11c850b, 0x11c893b, 0x11c8e7f, 0x11c903b, 0x11c9236, 0x11c94f5, 0x11c9734, 0x11ca2d7,
+    0x11ca4b8, 0x11cb232, 0x11ccc0c, 0x11cd210, 0x11cd83d, 0x11cda1c, 0x11cde50, 0x11ce028, 0x11ce449, 0x11ce832,
+    0x11cec89, 0x11cf8f4, 0x11cfe33, 0x11d0371, 0x11d0b81, 0x11d0e28, 0x11d1eab, 0x11d20aa, 0x11d281f, 0x11d398d,
+    0x11d3d55, 0x11d5720, 0x11d5860, 0x11d5eff, 0x11d644a, 0x11d7537, 0x11d9d4b, 0x11ecc22, 0x11ecf5e, 0x11ed067,
+    0x11ed35b, 0x11ed707, 0x11ed984, 0x11eda4b, 0x11edcb2, 0x11edf0d, 0x11ee073, 0x11ee262, 0x11ee490, 0x11ee6b0,
+    0x11ee980, 0x11eeb7e, 0x11eed63, 0x11eee75, 0x11ef17c, 0x11ef2a5, 0x11ef561, 0x11ef6fc, 0x11ef922, 0x11efb6e,
+    0x11efd7e, 0x11efe81, 0x11f0300, 0x11f04b0, 0x11f0681, 0x11f097b, 0x11f0a56, 0x11f0ca8, 0x11f0ed4, 0x11f100a,
+    0x11f127a, 0x11f1468, 0x11f174a, 0x11f1a2e, 0x11f1d89, 0x11f1e31, 0x11f2056, 0x11f227d, 0x11f2724, 0x11f28e9,
+    0x11f2b6a, 0x11f2d51, 0x11f2ed4, 0x11f30b0, 0x11f337b, 0x11f34ab, 0x11f3756, 0x11f3862, 0x11f3c2f, 0x11f3eec,
+    0x11f469d, 0x11f500e, 0x11f520e, 0x11f560e, 0x11f6023, 0x11f630c, 0x11f6c2e, 0x11f720e, 0x11f7aa9, 0x11f7c37,
+    0x11f82f7, 0x11f8569, 0x11f88f5, 0x11f8b5d, 0x11f8e69, 0x11f90b7, 0x11f9d65, 0x11fa16c, 0x11fa283, 0x11fa75e,
+    0x11fa850, 0x11fab4f, 0x11fb06b, 0x11fb37b, 0x11fb683, 0x11fb96a, 0x11fbb4b, 0x11fbca7, 0x11fbe25, 0x11fc53d,
+    0x11fc963, 0x11fca85, 0x11fcc7e, 0x11fd038, 0x11fd24e, 0x11fd43e, 0x11fd6f2, 0x11fda41, 0x11fdd72, 0x11fe124,
+    0x11fe684, 0x11feebf, 0x11ff00c, 0x11ff27d, 0x11ffb86, 0x1200144, 0x120032d, 0x1200522, 0x1200738, 0x12008e7,
+    0x1200a74, 0x1200cd3, 0x120135b, 0x120155d, 0x1201614, 0x1201b54, 0x1201f41, 0x1202181, 0x12022fe, 0x120243e,
+    0x1202942, 0x1202d3b, 0x1202e45, 0x1203540, 0x1203666, 0x1203b22, 0x1203c24, 0x1203f2f, 0x1204171, 0x1204302,
+    0x1204454, 0x1204ca5, 0x1205a78, 0x1205c38, 0x1205eb0, 0x1206a9a, 0x1206d4b, 0x1207163, 0x12076b3, 0x120780d,
+    0x1207d69, 0x1208249, 0x1208531, 0x120882a, 0x1208f69, 0x1209a0e, 0x1209e4b, 0x120a151, 0x120a279, 0x120a4fe,
+    0x120a63b, 0x120af63, 0x120b061, 0x120b6ad, 0x120c534, 0x120c6f7, 0x120cb61, 0x120d004, 0x120db71, 0x120dd7b,
+    0x120e8ab, 0x120eb8f, 0x120fa87, 0x120fe0d, 0x1210161, 0x1210555, 0x1210731, 0x12110c1, 0x121169d, 0x1212363,
+    0x121263d, 0x1212b67, 0x1212e6c, 0x12132b9, 0x12136fd, 0x1213a99, 0x1214251, 0x1214557, 0x12146ca, 0x1214c08,
+    0x1215555, 0x121594f, 0x1215d68, 0x1215e6c, 0x1216135, 0x12162fe, 0x12166ec, 0x1216812, 0x1216b1d, 0x1216c0a,
+    0x121703e, 0x121738b, 0x1217562, 0x12176ab, 0x1217d81, 0x1218369, 0x12188fa, 0x1218b7e, 0x1218e78, 0x1219481,
+    0x1219ca0, 0x1219e7e, 0x121a097, 0x121a37d, 0x121a76c, 0x121af50, 0x121b656, 0x121b85b, 0x121ba6e, 0x121c28a,
+    0x121c565, 0x121cca5, 0x121cf6c, 0x121d014, 0x121d6ec, 0x121da69, 0x121df36, 0x121e823, 0x121f039, 0x121fa45,
+    0x121fd5f, 0x122044b, 0x1220888, 0x122320d, 0x1223d64, 0x122455f, 0x1224779, 0x1225f1b, 0x12262f2, 0x122738b,
+    0x12286ac, 0x1228c54, 0x1229368, 0x1229442, 0x12296fe, 0x1229988, 0x1229ae9, 0x1229d80, 0x1229f63, 0x122a059,
+    0x122a486, 0x122af5a, 0x122b453, 0x122bb6c, 0x122bd35, 0x122c346, 0x122c432, 0x122c66c, 0x122c862, 0x122cb2f,
+    0x122d2c4, 0x122d4a1, 0x122d827, 0x122dd40, 0x122df7e, 0x122e152, 0x122e280, 0x122e424, 0x122e942, 0x122ea81,
+    0x122ecbc, 0x122ee95, 0x122f130, 0x122f2a3, 0x122fb5f, 0x122fd1a, 0x122fed5, 0x1230ae9, 0x1230e2d, 0x123138e,
+    0x1231632, 0x123189b, 0x1231b3b, 0x1232075, 0x123235a, 0x1232557, 0x12334bf, 0x1233700, 0x123446b, 0x1234737,
+    0x12354a1, 0x1235a14, 0x1235c81, 0x1235f50, 0x12368a5, 0x1236a87, 0x123755d, 0x1238e16, 0x1239368, 0x1239522,
+    0x12398a5, 0x1239b7f, 0x1239d62, 0x1239ea8, 0x123a283, 0x123b856, 0x124e87f, 0x1251cfd, 0x1255cb1, 0x125914f,
+    0x1267d6f, 0x126d4c7, 0x1271ead, 0x1279404, 0x127ac04, 0x1287c0a, 0x128d756, 0x1290a83, 0x1290c57, 0x1290f63,
+    0x129117c, 0x1291242, 0x129157a, 0x12916f2, 0x12918a9, 0x1291b42, 0x1291cf7, 0x1291e2a, 0x129211b, 0x1292450,
+    0x1292640, 0x12928bd, 0x1292ae0, 0x1292e1e, 0x1293258, 0x1293414, 0x1293735, 0x1293887, 0x1293a49, 0x1293c21,
+    0x1293f7f, 0x12940ca, 0x129420a, 0x129445a, 0x1294607, 0x12948f7, 0x1294b61, 0x1294cfb, 0x1294e8a, 0x129514f,
+    0x1295261, 0x129548e, 0x1295651, 0x129587c, 0x1295b41, 0x1295cda, 0x1295e05, 0x1296169, 0x12962f7, 0x129657d,
+    0x12966f7, 0x1296862, 0x1296a13, 0x1296c90, 0x1296ef2, 0x1297014, 0x1297213, 0x129756b, 0x129778d, 0x12978c8,
+    0x1297b36, 0x1297c7e, 0x1297e3f, 0x1298168, 0x129833e, 0x1298413, 0x12986ac, 0x129892b, 0x1298af7, 0x1298cba,
+    0x1299122, 0x129935b, 0x1299534, 0x129960d, 0x12998d3, 0x1299aec, 0x1299c4a, 0x129a08f, 0x129a2a1, 0x129a44e,
+    0x129ab68, 0x129ac24, 0x129ae7e, 0x129b162, 0x129b2ce, 0x129b63a, 0x129b940, 0x129bab4, 0x129bc40, 0x129bf64,
+    0x129c08c, 0x129c376, 0x129c581, 0x129c750, 0x129c842, 0x129ca43, 0x129ce76, 0x129d100, 0x129d319, 0x129d46a,
+    0x129d640, 0x129d85c, 0x129dac4, 0x129dd7d, 0x129df16, 0x129e081, 0x129e363, 0x129e41f, 0x129e626, 0x129e937,
+    0x129ea02, 0x129ed64, 0x129ef0c, 0x129f181, 0x129f2a1, 0x129f4f4, 0x129f89e, 0x129fb39, 0x129fca7, 0x129fe92,
+    0x12a0154, 0x12a0333, 0x12a04a5, 0x12a0775, 0x12a0828, 0x12a0a69, 0x12a0c5b, 0x12a0e4b, 0x12a1159, 0x12a1236,
+    0x12a14b5, 0x12a1654, 0x12a1956, 0x12a1aad, 0x12a1c8c, 0x12a1e7f, 0x12a210e, 0x12a233b, 0x12a24a0, 0x12a26fb,
+    0x12a2887, 0x12a2a00, 0x12a2cf8, 0x12a2f7b, 0x12a30df, 0x12a3236, 0x12a34ba, 0x12a360b, 0x12a3a3c, 0x12a3c90,
+    0x12a3e9b, 0x12a4350, 0x12a4462, 0x12a46b3, 0x12a482c, 0x12a4b86, 0x12a4c83, 0x12a5152, 0x12a5288, 0x12a547c,
+    0x12a56e9, 0x12a5936, 0x12a5a42, 0x12a5c7f, 0x12a5e87, 0x12a60be, 0x12a6389, 0x12a64fa, 0x12a688c, 0x12a6af8,
+    0x12a6d2c, 0x12a6e4b, 0x12a701d, 0x12a72f9, 0x12a757f, 0x12a7647, 0x12a792e, 0x12a7c78, 0x12a7e01, 0x12a8046,
+    0x12a82bc, 0x12a84af, 0x12a8852, 0x12a8abc, 0x12a8cc6, 0x12a8f7c, 0x12a925c, 0x12a94d7, 0x12a9888, 0x12a9ad7,
+    0x12a9cca, 0x12a9ead, 0x12aa05b, 0x12aa208, 0x12aa563, 0x12aa67e, 0x12aa811, 0x12aac0f, 0x12aaf37, 0x12ab0b8,
+    0x12ab2b3, 0x12ab767, 0x12ab884, 0x12aba3e, 0x12abd8c, 0x12abf5b, 0x12ac21f, 0x12ac489, 0x12ac6a9, 0x12ac8f4,
+    0x12acab0, 0x12acc48, 0x12ace9f, 0x12ad0f4, 0x12ad233, 0x12ad4f8, 0x12ad63d, 0x12ad87c, 0x12adaa3, 0x12adf88,
+    0x12ae0a7, 0x12ae363, 0x12ae41d, 0x12ae60f, 0x12aed53, 0x12aff79, 0x12bd0bd, 0x12bd327, 0x12bd51b, 0x12bd75f,
+    0x12bda0d, 0x12bdd4c, 0x12bde2b, 0x12be10f, 0x12be34b, 0x12be552, 0x12be673, 0x12be87f, 0x12beac3, 0x12bec8e,
+    0x12beebd, 0x12bf176, 0x12bf2ce, 0x12bf467, 0x12bf74c, 0x12bf934, 0x12bfac3, 0x12bfcb4, 0x12c004f, 0x12c025c,
+    0x12c046f, 0x12c069b, 0x12c0886, 0x12c0b6b, 0x12c0ca0, 0x12c1169, 0x12c135f, 0x12c1420, 0x12c1750, 0x12c194c,
+    0x12c1a7b, 0x12c1d5f, 0x12c1e4b, 0x12c201f, 0x12c229f, 0x12c24ff, 0x12c289c, 0x12c2b01, 0x12c2c6f, 0x12c2f3c,
+    0x12c3301, 0x12c346c, 0x12c3856, 0x12c3a56, 0x12c3e48, 0x12c42f7, 0x12c454f, 0x12c5407, 0x12c5d0d, 0x12c6284,
+    0x12c6451, 0x12c6760, 0x12c6964, 0x12c6b7c, 0x12c6c82, 0x12c778c, 0x12c7990, 0x12c7a3f, 0x12c7e00, 0x12c8146,
+    0x12c840a, 0x12c8856, 0x12c8a7d, 0x12c8cb0, 0x12c8eae, 0x12c9023, 0x12c9357, 0x12c96af, 0x12c98c6, 0x12c9a80,
+    0x12ca152, 0x12ca858, 0x12cab1b, 0x12cb60d, 0x12cbf7e, 0x12cc245, 0x12cc56a, 0x12cc828, 0x12cced7, 0x12cd16c,
+    0x12cd352, 0x12cd4e9, 0x12cd98b, 0x12ce42c, 0x12ce8ec, 0x12ceaac, 0x12ced38, 0x12cef52, 0x12d0b69, 0x12d0cae,
+    0x12d114b, 0x12d1731, 0x12d1a79, 0x12d1f31, 0x12d2164, 0x12d285c, 0x12d2e9a, 0x12d3001, 0x12d3350, 0x12d3979,
+    0x12d4f31, 0x12d6150, 0x12d667a, 0x12d6ca5, 0x12d7386, 0x12d7932, 0x12d7a88, 0x12d7ccc, 0x12d8101, 0x12d835f,
+    0x12d8958, 0x12d8b5e, 0x12d8c7d, 0x12d8e62, 0x12d937e, 0x12d982f, 0x12d9b67, 0x12d9c87, 0x12d9e28, 0x12da4b3,
+    0x12daa40, 0x12dc027, 0x12dd169, 0x12dd369, 0x12dd55c, 0x12ddf4c, 0x12de6a5, 0x12decac, 0x12deea3, 0x12df209,
+    0x12dfd4f, 0x12e015a, 0x12e027d, 0x12e0954, 0x12e0d3f, 0x12e0f7c, 0x12e10e9, 0x12e12bc, 0x12e1a7c, 0x12e1d19,
+    0x12e1e52, 0x12e26d3, 0x12e2cab, 0x12e3928, 0x12e3d51, 0x12e5564, 0x12e5a01, 0x12e6152, 0x12e64b0, 0x12e7005,
+    0x12e72ec, 0x12e7cb7, 0x12ea4fc, 0x12ea684, 0x12eac84, 0x12eb284, 0x12eb63f, 0x12ebc52, 0x12ec08f, 0x12ec2bf,
+    0x12ec4c0, 0x12ecb62, 0x12ed25c, 0x12ee683, 0x12ee95c, 0x12eec05, 0x12ef837, 0x12f0b60, 0x12f1755, 0x12f1a02,
+    0x12f2237, 0x12f24f9, 0x12f28b8, 0x12f30f9, 0x12f4087, 0x12f470b, 0x12f5687, 0x12f5a0e, 0x12f5e7f, 0x12f6461,
+    0x12f680a, 0x12fcd4b, 0x12fcf07, 0x12fd26c, 0x12fd54b, 0x12fd76c, 0x12fd938, 0x12fda86, 0x12fe764, 0x12feb6c,
+    0x12fed1d, 0x130eb62, 0x130ec42, 0x130eefc, 0x130f06c, 0x130f353, 0x130f52a, 0x130f75a, 0x130f95a, 0x130fb49,
+    0x130fc62, 0x130fe49, 0x13100f5, 0x1310207, 0x131052d, 0x131066d, 0x1310969, 0x1310ab0, 0x1310cac, 0x1310ef2,
+    0x1311084, 0x1311282, 0x131147e, 0x131186f, 0x1311b65, 0x1311e90, 0x1312163, 0x13122f0, 0x1312744, 0x131286c,
+    0x1312d65, 0x1312e90, 0x131313b, 0x131344b, 0x1313784, 0x131395f, 0x1313a4b, 0x1313cd7, 0x1313eb8, 0x131403f,
+    0x1314314, 0x131446e, 0x131481f, 0x1314b0c, 0x1314cf0, 0x1314f00, 0x1319c54, 0x131a20f, 0x131a511, 0x131a687,
+    0x131ab2e, 0x131b0ee, 0x131b20f, 0x131b40f, 0x131bc52, 0x131bf22, 0x131cf32, 0x131d153, 0x1321b5f, 0x1322017,
+    0x1325d3e, 0x132a967, 0x132ab38, 0x132c722, 0x132ca7d, 0x132cf37, 0x132d145, 0x132d350, 0x132d507, 0x132d769,
+    0x132d825, 0x132da50, 0x132dd64, 0x132de7f, 0x132e122, 0x132e209, 0x132e52c, 0x132e963, 0x132ea4e, 0x132ed05,
+    0x132ef53, 0x132f481, 0x132f812, 0x132fa13, 0x132fe4b, 0x1330169, 0x13302d0, 0x133087b, 0x1330b52, 0x1330c65,
+    0x1330e1d, 0x133109a, 0x133152e, 0x133161f, 0x1331ac6, 0x1331ead, 0x1332159, 0x1332283, 0x13324b8, 0x1332713,
+    0x1332984, 0x1332acd, 0x1332d23, 0x1332e9a, 0x1333069, 0x1333353, 0x1334a56, 0x1335156, 0x134d8b6, 0x134db69,
+    0x134dd46, 0x134df5d, 0x134e025, 0x134e2ff, 0x134e613, 0x134e8b4, 0x134eb70, 0x134ed22, 0x134ef2c, 0x134f056,
+    0x134f287, 0x134f58b, 0x134f781, 0x134f946, 0x134fadd, 0x134fc7e, 0x134ff63, 0x1350038, 0x1350354, 0x13504b6,
+    0x1350881, 0x1350a76, 0x1350cb3, 0x1350e6b, 0x13510ed, 0x13514a5, 0x1351624, 0x135195f, 0x1351e8a, 0x13520f5,
+    0x13522f5, 0x1352490, 0x1352786, 0x1352c17, 0x1352eed, 0x135317e, 0x1353515, 0x135374f, 0x1353804, 0x1353aad,
+    0x1353cf7, 0x1353f1b, 0x135400f, 0x13542b3, 0x1354430, 0x135461f, 0x1354980, 0x1354a7d, 0x1354f53, 0x1355062,
+    0x1356141, 0x1356282, 0x1356c3e, 0x1356e95, 0x135706b, 0x1357474, 0x135785c, 0x135800d, 0x1358290, 0x13584f6,
+    0x1358aaf, 0x1359698, 0x1359811, 0x135a246, 0x135a731, 0x135b05b, 0x135be0f, 0x135c29b, 0x135ccba, 0x135d73d,
+    0x135db89, 0x135df03, 0x135f359, 0x135f67d, 0x136078a, 0x1361100, 0x1361e86, 0x1362611, 0x1363e78, 0x13646aa,
+    0x1365e20, 0x136645c, 0x1367769, 0x1367867, 0x136829a, 0x136847b, 0x1368605, 0x13688f2, 0x1368abc, 0x1368f5f,
+    0x1369154, 0x13692a8, 0x1369b4a, 0x1369f4b, 0x136a225, 0x136a8c6, 0x138f969, 0x138ff68, 0x13902b0, 0x1390451,
+    0x1390a05, 0x1390cf1, 0x1390ed4, 0x13910b0, 0x1391656, 0x1391a09, 0x1391c74, 0x1392135, 0x1392267, 0x1392482,
+    0x139294b, 0x1392a4e, 0x139347d, 0x1393681, 0x1393952, 0x1393d53, 0x1393f5d, 0x139405f, 0x13942a5, 0x13944a7,
+    0x139467f, 0x13948a5, 0x1394b22, 0x1394d3d, 0x1394e68, 0x1395119, 0x1395278, 0x139567d, 0x1395afc, 0x1395cac,
+    0x139618b, 0x1396252, 0x139649b, 0x1396620, 0x1396862, 0x1396ad3, 0x1396cd4, 0x1396e40, 0x1397084, 0x1397522,
+    0x1397789, 0x1397853, 0x1397a41, 0x1398712, 0x139884b, 0x1398afe, 0x1398c56, 0x1398e79, 0x139940e, 0x1399715,
+    0x1399804, 0x1399af5, 0x1399d34, 0x1399e65, 0x139a161, 0x139a6a2, 0x139a80f, 0x139ab5c, 0x139ac10, 0x139aeb8,
+    0x139b0c3, 0x139b367, 0x139b867, 0x139bb1b, 0x139bcab, 0x139bf8f, 0x139c4a5, 0x13c3ed6, 0x13c4086, 0x13c427d,
+    0x13c456a, 0x13c46c4, 0x13c4ae3, 0x13c4d5e, 0x13c5009, 0x13c537c, 0x13c5462, 0x13c5644, 0x13c58b0, 0x13c5b5e,
+    0x13c5f60, 0x13c6225, 0x13c64ff, 0x13c676a, 0x13c6b46, 0x13c6d2c, 0x13c6f7e, 0x13c704e, 0x13c7263, 0x13c7559,
+    0x13c7a5c, 0x13c7cb1, 0x13c7e73, 0x13c8213, 0x13c84a5, 0x13c8688, 0x13c8862, 0x13c8a4b, 0x13c8d69, 0x13c8f52,
+    0x13c913b, 0x13c934f, 0x13c9501, 0x13c96c1, 0x13c9802, 0x13c9c0a, 0x13c9eeb, 0x13ca22d, 0x13caa75, 0x13cae4b,
+    0x13cb062, 0x13cb42f, 0x13cb6bc, 0x13cb94f, 0x13cbd61, 0x13cc67f, 0x13cc86f, 0x13ccd65, 0x13ccf7b, 0x13cd0ad,
+    0x13cd2a9, 0x13cd481, 0x13cd686, 0x13cd969, 0x13cdab0, 0x13ce165, 0x13ce275, 0x13ce665, 0x13cfc36, 0x13cfeb0,
+    0x13d047d, 0x13d0e8a, 0x13d1181, 0x13d16bf, 0x13d24f5, 0x13d26b0, 0x13d3b1e, 0x13d3eab, 0x13d4cb7, 0x13d68ff,
+    0x13d7056, 0x13d76b6, 0x13d7ac6, 0x13d7c7a, 0x13d8879, 0x13d9273, 0x13d9b24, 0x13d9ca5, 0x13d9ed4, 0x13da270,
+    0x13da8f7, 0x13db0c6, 0x13db638, 0x13db828, 0x13dbb68, 0x13dbf63, 0x13dc151, 0x13dc4ff, 0x13dcafc, 0x13dcea5,
+    0x13dd246, 0x13dd417, 0x13dde02, 0x13df37e, 0x13df656, 0x13df856, 0x13dfcc0, 0x13e176a, 0x13e1b46, 0x13e1c42,
+    0x13e20cb, 0x13e2662, 0x13e2f38, 0x13e32ec, 0x13e4124, 0x13e4453, 0x13e5968, 0x13e5f4f, 0x13e6f50, 0x13e735f,
+    0x13e760d, 0x13e7afe, 0x13e7c6c, 0x13e8976, 0x13ea0f5, 0x13ea27d, 0x13efe25, 0x13f0023, 0x13f0687, 0x13f08ac,
+    0x13f0a09, 0x13f0d3d, 0x13f0f89, 0x13f1091, 0x13f1369, 0x13f142e, 0x13f16ff, 0x13f194e, 0x13f32ae, 0x13f3460,
+    0x13f368d, 0x13f3e67, 0x13f416b,
+};
+extern const size_t kCharSyllableCount = sizeof(kCharSyllables) / sizeof(kCharSyllables[0]);
+
+} // namespace pinyin_data
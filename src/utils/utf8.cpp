@@ -0,0 +1,143 @@
+// =============================================
+// 文件: utf8.cpp
+// 描述: UTF-8 工具实现。
+// =============================================
+#include "utf8.hpp"
+
+std::u32string Utf8::Decode(const std::string& str) {
+    std::u32string out;
+    out.reserve(str.size());
+
+    size_t i = 0;
+    while (i < str.size()) {
+        unsigned char lead = static_cast<unsigned char>(str[i]);
+        char32_t codePoint = 0;
+        size_t length = 0;
+        if (lead < 0x80) {
+            codePoint = lead;
+            length = 1;
+        } else if ((lead & 0xE0) == 0xC0) {
+            codePoint = lead & 0x1F;
+            length = 2;
+        } else if ((lead & 0xF0) == 0xE0) {
+            codePoint = lead & 0x0F;
+            length = 3;
+        } else if ((lead & 0xF8) == 0xF0) {
+            codePoint = lead & 0x07;
+            length = 4;
+        } else {
+            out.push_back(U'�');
+            ++i;
+            continue;
+        }
+
+        if (i + length > str.size()) {
+            out.push_back(U'�');
+            break;
+        }
+
+        bool valid = true;
+        for (size_t k = 1; k < length; ++k) {
+            unsigned char next = static_cast<unsigned char>(str[i + k]);
+            if ((next & 0xC0) != 0x80) {
+                valid = false;
+                break;
+            }
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+
+        if (!valid) {
+            out.push_back(U'�');
+            ++i;
+            continue;
+        }
+
+        out.push_back(codePoint);
+        i += length;
+    }
+    return out;
+}
+
+void Utf8::Append(std::string& out, char32_t codePoint) {
+    if (codePoint < 0x80) {
+        out.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+std::string Utf8::Encode(const std::u32string& codePoints) {
+    std::string out;
+    out.reserve(codePoints.size());
+    for (char32_t codePoint : codePoints) {
+        Append(out, codePoint);
+    }
+    return out;
+}
+
+char32_t Utf8::FoldCase(char32_t c) {
+    // ASCII
+    if (c < 0x80) {
+        return (c >= U'A' && c <= U'Z') ? c + 0x20 : c;
+    }
+    // Latin-1：À-Þ（除 ×）
+    if (c >= 0xC0 && c <= 0xDE && c != 0xD7) {
+        return c + 0x20;
+    }
+    // 拉丁扩展 A：大小写成对相邻（0x130/0x131 与 0x178 除外）
+    if (c >= 0x100 && c <= 0x137 && c != 0x130) {
+        return c | 1;
+    }
+    if (c >= 0x139 && c <= 0x148) {
+        return (c & 1) ? c + 1 : c;
+    }
+    if (c >= 0x14A && c <= 0x177) {
+        return c | 1;
+    }
+    if (c == 0x178) {
+        return 0xFF;
+    }
+    if (c >= 0x179 && c <= 0x17E) {
+        return (c & 1) ? c + 1 : c;
+    }
+    // 希腊字母
+    if (c >= 0x391 && c <= 0x3A9 && c != 0x3A2) {
+        return c + 0x20;
+    }
+    // 西里尔字母
+    if (c >= 0x400 && c <= 0x40F) {
+        return c + 0x50;
+    }
+    if (c >= 0x410 && c <= 0x42F) {
+        return c + 0x20;
+    }
+    // 全角数字与拉丁字母（中文输入法常见）
+    if (c >= 0xFF10 && c <= 0xFF19) {
+        return c - 0xFF10 + U'0';
+    }
+    if (c >= 0xFF21 && c <= 0xFF3A) {
+        return c - 0xFF21 + U'a';
+    }
+    if (c >= 0xFF41 && c <= 0xFF5A) {
+        return c - 0xFF41 + U'a';
+    }
+    return c;
+}
+
+std::u32string Utf8::DecodeFolded(const std::string& str) {
+    std::u32string out = Decode(str);
+    for (auto& codePoint : out) {
+        codePoint = FoldCase(codePoint);
+    }
+    return out;
+}
@@ -0,0 +1,27 @@
+// =============================================
+// 文件: utf8.hpp
+// 描述: UTF-8 解码/编码与大小写折叠工具，供搜索等按字符处理文本的模块使用。
+// =============================================
+
+#ifndef CPP_MUD_OUC_UTF8_HPP
+#define CPP_MUD_OUC_UTF8_HPP
+#include <string>
+
+class Utf8 {
+public:
+    // 解码为码点序列；非法字节按 U+FFFD 处理
+    static std::u32string Decode(const std::string& str);
+
+    // 编码单个码点
+    static void Append(std::string& out, char32_t codePoint);
+    static std::string Encode(const std::u32string& codePoints);
+
+    // 大小写折叠：拉丁（含 Latin-1 / 扩展 A）、希腊、西里尔字母转小写，
+    // 全角拉丁字母与数字折叠为对应的 ASCII 字符；其余码点原样返回
+    static char32_t FoldCase(char32_t codePoint);
+
+    // 解码并折叠
+    static std::u32string DecodeFolded(const std::string& str);
+};
+
+#endif //CPP_MUD_OUC_UTF8_HPP